@@ -0,0 +1,417 @@
+/* Relative Path: bench/antnet_bench.c */
+/*
+ * End-to-end benchmark: seeded hop-map topologies, pub_run_all_solvers swept over node,
+ * ant and worker thread counts. Reports iterations/s, per-phase times from the perf
+ * counters, peak RSS and best latency over time as CSV (default) or JSON on stdout.
+*/
+
+#include "../include/rendering/heatmap_renderer_api.h"
+#include "../include/core/backend_topology.h"
+#include "../include/managers/hop_map_manager.h"
+#include "../include/types/antnet_aco_v1_types.h"
+#include "../include/types/antnet_brute_force_types.h"
+#include "../include/consts/error_codes.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
+
+#define BENCH_MAX_SWEEP   16
+#define BENCH_MAX_SAMPLES 32 /* best latency samples per run, at powers of two */
+
+static const char* const k_phase_names[ANTNET_PERF_PHASES] = {
+    "aco_construct", "aco_weighting", "aco_sampling", "aco_merge", "sasa_update",
+    "brute_step", "random_step", "topology_update", "lock_wait", "iteration"
+};
+
+typedef struct BenchOptions {
+    int nodes[BENCH_MAX_SWEEP];
+    int node_points;
+    int ants[BENCH_MAX_SWEEP];
+    int ant_points;
+    int threads[BENCH_MAX_SWEEP];
+    int thread_points;
+    int iterations;
+    int warmup;        /* unmeasured iterations first, they include solver allocation */
+    int min_hops;
+    int max_hops;
+    int construction;  /* ACO_CONSTRUCT_* */
+    int brute_mode;    /* BRUTE_MODE_* */
+    unsigned long long seed;
+    int json;
+} BenchOptions;
+
+typedef struct BenchSample {
+    int    iteration;
+    double elapsed_ms;
+    int    latency;
+} BenchSample;
+
+typedef struct BenchResult {
+    int    nodes, edges, ants, threads, iterations, failures;
+    double seconds;
+    long   peak_rss_kb;
+    int    best_latency;
+    AntNetPerfCounters perf;
+    BenchSample samples[BENCH_MAX_SAMPLES];
+    int    sample_count;
+} BenchResult;
+
+static double now_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/*
+ * Peak resident set size in KiB. reset_peak_rss() restarts VmHWM where the kernel allows
+ * it, so each run reports its own peak; otherwise this is the process-wide maximum.
+ */
+static void reset_peak_rss(void)
+{
+    FILE* f = fopen("/proc/self/clear_refs", "w");
+    if (f) {
+        fputs("5", f);
+        fclose(f);
+    }
+}
+
+static long peak_rss_kb(void)
+{
+    FILE* f = fopen("/proc/self/status", "r");
+    if (f) {
+        char line[256];
+        long kb = -1;
+        while (fgets(line, sizeof(line), f)) {
+            if (strncmp(line, "VmHWM:", 6) == 0) {
+                kb = strtol(line + 6, NULL, 10);
+                break;
+            }
+        }
+        fclose(f);
+        if (kb >= 0) {
+            return kb;
+        }
+    }
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+/* Parses "a,b,c" into out; returns the count, or 0 on a bad or non-positive entry. */
+static int parse_list(const char* text, int* out)
+{
+    int count = 0;
+    const char* p = text;
+    while (*p && count < BENCH_MAX_SWEEP) {
+        char* end = NULL;
+        long v = strtol(p, &end, 10);
+        if (end == p || v <= 0) {
+            return 0;
+        }
+        out[count++] = (int)v;
+        p = (*end == ',') ? end + 1 : end;
+        if (*end && *end != ',') {
+            return 0;
+        }
+    }
+    return count;
+}
+
+static void usage(const char* prog)
+{
+    fprintf(stderr,
+            "usage: %s [--nodes 100,1000,5000,20000] [--ants 1,16] [--threads 1,4]\n"
+            "          [--iterations 200] [--warmup 1] [--hops 2,10] [--seed 42] [--edge-walk]\n"
+            "          [--brute permutation|branch|parallel] [--json]\n",
+            prog);
+}
+
+static int parse_options(int argc, char** argv, BenchOptions* opt)
+{
+    memset(opt, 0, sizeof(*opt));
+    opt->node_points   = parse_list("100,1000,5000,20000", opt->nodes);
+    opt->ant_points    = parse_list("1,16", opt->ants);
+    opt->thread_points = parse_list("1,4", opt->threads);
+    opt->iterations    = 200;
+    opt->warmup        = 1;
+    opt->min_hops      = 2;
+    opt->max_hops      = 10;
+    opt->construction  = ACO_CONSTRUCT_SUBSET;
+    opt->brute_mode    = BRUTE_MODE_BRANCH_BOUND;
+    opt->seed          = 42;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* val = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (strcmp(arg, "--json") == 0) {
+            opt->json = 1;
+        } else if (strcmp(arg, "--edge-walk") == 0) {
+            opt->construction = ACO_CONSTRUCT_EDGE_WALK;
+        } else if (!val) {
+            return 0;
+        } else if (strcmp(arg, "--nodes") == 0) {
+            opt->node_points = parse_list(val, opt->nodes);
+            i++;
+        } else if (strcmp(arg, "--ants") == 0) {
+            opt->ant_points = parse_list(val, opt->ants);
+            i++;
+        } else if (strcmp(arg, "--threads") == 0) {
+            opt->thread_points = parse_list(val, opt->threads);
+            i++;
+        } else if (strcmp(arg, "--iterations") == 0) {
+            opt->iterations = atoi(val);
+            i++;
+        } else if (strcmp(arg, "--warmup") == 0) {
+            opt->warmup = atoi(val);
+            i++;
+        } else if (strcmp(arg, "--hops") == 0) {
+            if (sscanf(val, "%d,%d", &opt->min_hops, &opt->max_hops) != 2) {
+                return 0;
+            }
+            i++;
+        } else if (strcmp(arg, "--seed") == 0) {
+            opt->seed = strtoull(val, NULL, 10);
+            i++;
+        } else if (strcmp(arg, "--brute") == 0) {
+            if (strcmp(val, "permutation") == 0) {
+                opt->brute_mode = BRUTE_MODE_PERMUTATION;
+            } else if (strcmp(val, "branch") == 0) {
+                opt->brute_mode = BRUTE_MODE_BRANCH_BOUND;
+            } else if (strcmp(val, "parallel") == 0) {
+                opt->brute_mode = BRUTE_MODE_PARALLEL;
+            } else {
+                return 0;
+            }
+            i++;
+        } else {
+            return 0;
+        }
+    }
+    return opt->node_points > 0 && opt->ant_points > 0 && opt->thread_points > 0
+        && opt->iterations > 0 && opt->warmup >= 0
+        && opt->min_hops >= 0 && opt->max_hops >= opt->min_hops;
+}
+
+/*
+ * build_topology
+ * Lays out nodes with the hop-map generator (seeded delays), keeps its default
+ * start-to-end chain and adds its grid edges so an edge walk has choices everywhere.
+ * Returns the edge count, 0 on failure.
+ */
+static int build_topology(int context_id, int total_nodes, unsigned long long seed)
+{
+    HopMapManager* mgr = hop_map_manager_create();
+    if (!mgr) {
+        return 0;
+    }
+    hop_map_manager_set_seed(mgr, seed);
+    hop_map_manager_initialize_map(mgr, total_nodes);
+    hop_map_manager_create_default_edges(mgr);
+    hop_map_manager_add_grid_edges(mgr);
+
+    size_t node_count = 0, edge_count = 0;
+    hop_map_manager_export_topology(mgr, NULL, &node_count, NULL, &edge_count);
+
+    NodeData* nodes = (NodeData*)malloc(node_count * sizeof(NodeData));
+    EdgeData* edges = (EdgeData*)malloc(edge_count * sizeof(EdgeData));
+    int result = 0;
+    if (nodes && edges) {
+        hop_map_manager_export_topology(mgr, nodes, &node_count, edges, &edge_count);
+        if (pub_update_topology(context_id, nodes, (int)node_count, edges, (int)edge_count)
+            == ERR_SUCCESS) {
+            result = (int)edge_count;
+        }
+    }
+
+    free(nodes);
+    free(edges);
+    hop_map_manager_destroy(mgr);
+    return result;
+}
+
+static int run_point(const BenchOptions* opt, int nodes, int ants, int threads,
+                     BenchResult* res)
+{
+    memset(res, 0, sizeof(*res));
+    res->nodes   = nodes;
+    res->ants    = ants;
+    res->threads = threads;
+    res->best_latency = -1;
+
+    int ctx = pub_initialize(nodes, opt->min_hops, opt->max_hops);
+    if (ctx < 0) {
+        return ctx;
+    }
+
+    float alpha, beta, q, evaporation;
+    int current_ants;
+    pub_set_seed(ctx, opt->seed);
+    pub_get_aco_params(ctx, &alpha, &beta, &q, &evaporation, &current_ants);
+    pub_set_aco_params(ctx, alpha, beta, q, evaporation, ants);
+    pub_set_aco_construction_mode(ctx, opt->construction);
+    pub_set_brute_force_mode(ctx, opt->brute_mode, BRUTE_DEFAULT_STEP_CANDIDATES, 0);
+    pub_set_worker_threads(ctx, threads);
+
+    reset_peak_rss();
+    res->edges = build_topology(ctx, nodes, opt->seed);
+    if (res->edges == 0) {
+        pub_shutdown(ctx);
+        return ERR_MEMORY_ALLOCATION;
+    }
+
+    int max_size = opt->max_hops + 2;
+    int* buffers = (int*)malloc(3 * (size_t)max_size * sizeof(int));
+    if (!buffers) {
+        pub_shutdown(ctx);
+        return ERR_MEMORY_ALLOCATION;
+    }
+    int* aco_nodes   = buffers;
+    int* rand_nodes  = buffers + max_size;
+    int* brute_nodes = buffers + 2 * max_size;
+
+    /*
+     * Iterations 1 - warmup .. 0 are not timed; the peak RSS still covers them. Best
+     * latency keeps improving through the warmup, so the trace starts where it left off.
+     */
+    int next_sample = 1;
+    double t0 = now_seconds();
+    for (int it = 1 - opt->warmup; it <= opt->iterations; it++) {
+        if (it == 1) {
+            pub_reset_perf_counters(ctx);
+            t0 = now_seconds();
+        }
+        int aco_len = 0, aco_lat = 0, rand_len = 0, rand_lat = 0, brute_len = 0, brute_lat = 0;
+        int rc = pub_run_all_solvers(ctx,
+                                     aco_nodes, max_size, &aco_len, &aco_lat,
+                                     rand_nodes, max_size, &rand_len, &rand_lat,
+                                     brute_nodes, max_size, &brute_len, &brute_lat);
+        if (rc != ERR_SUCCESS) {
+            res->failures += (it > 0);
+            continue;
+        }
+        int lats[3] = { aco_len > 0 ? aco_lat : -1, rand_len > 0 ? rand_lat : -1,
+                        brute_len > 0 ? brute_lat : -1 };
+        for (int s = 0; s < 3; s++) {
+            if (lats[s] >= 0 && (res->best_latency < 0 || lats[s] < res->best_latency)) {
+                res->best_latency = lats[s];
+            }
+        }
+        if (it > 0 && (it == next_sample || it == opt->iterations) && res->sample_count < BENCH_MAX_SAMPLES) {
+            BenchSample* sample = &res->samples[res->sample_count++];
+            sample->iteration  = it;
+            sample->elapsed_ms = (now_seconds() - t0) * 1e3;
+            sample->latency    = res->best_latency;
+            if (it == next_sample) {
+                next_sample *= 2;
+            }
+        }
+    }
+    res->seconds     = now_seconds() - t0;
+    res->iterations  = opt->iterations;
+    res->peak_rss_kb = peak_rss_kb();
+    pub_get_perf_counters(ctx, &res->perf);
+
+    free(buffers);
+    pub_shutdown(ctx);
+    return ERR_SUCCESS;
+}
+
+static void print_csv_header(void)
+{
+    printf("nodes,edges,ants,threads,iterations,failures,seconds,iter_per_s,peak_rss_kb,best_latency");
+    for (int p = 0; p < ANTNET_PERF_PHASES; p++) {
+        printf(",%s_us_per_iter", k_phase_names[p]);
+    }
+    printf(",best_latency_trace\n");
+}
+
+/* Phase columns are microseconds per iteration; the trace is iteration:ms:latency items. */
+static void print_csv_row(const BenchResult* r)
+{
+    printf("%d,%d,%d,%d,%d,%d,%.6f,%.3f,%ld,%d", r->nodes, r->edges, r->ants, r->threads,
+           r->iterations, r->failures, r->seconds, r->iterations / r->seconds,
+           r->peak_rss_kb, r->best_latency);
+    for (int p = 0; p < ANTNET_PERF_PHASES; p++) {
+        printf(",%.3f", (double)r->perf.total_ns[p] * 1e-3 / r->iterations);
+    }
+    printf(",");
+    for (int s = 0; s < r->sample_count; s++) {
+        printf("%s%d:%.3f:%d", s ? ";" : "", r->samples[s].iteration,
+               r->samples[s].elapsed_ms, r->samples[s].latency);
+    }
+    printf("\n");
+    fflush(stdout);
+}
+
+static void print_json_run(const BenchResult* r, int first)
+{
+    printf("%s\n    {\"nodes\": %d, \"edges\": %d, \"ants\": %d, \"threads\": %d,"
+           " \"iterations\": %d, \"failures\": %d, \"seconds\": %.6f, \"iter_per_s\": %.3f,"
+           " \"peak_rss_kb\": %ld, \"best_latency\": %d,\n     \"phases\": {",
+           first ? "" : ",", r->nodes, r->edges, r->ants, r->threads, r->iterations,
+           r->failures, r->seconds, r->iterations / r->seconds, r->peak_rss_kb,
+           r->best_latency);
+    for (int p = 0; p < ANTNET_PERF_PHASES; p++) {
+        printf("%s\"%s\": {\"calls\": %llu, \"total_us\": %.3f, \"max_us\": %.3f}",
+               p ? ", " : "", k_phase_names[p], (unsigned long long)r->perf.calls[p],
+               (double)r->perf.total_ns[p] * 1e-3, (double)r->perf.max_ns[p] * 1e-3);
+    }
+    printf("},\n     \"best_latency_trace\": [");
+    for (int s = 0; s < r->sample_count; s++) {
+        printf("%s{\"iteration\": %d, \"ms\": %.3f, \"latency\": %d}", s ? ", " : "",
+               r->samples[s].iteration, r->samples[s].elapsed_ms, r->samples[s].latency);
+    }
+    printf("]}");
+    fflush(stdout);
+}
+
+int main(int argc, char** argv)
+{
+    BenchOptions opt;
+    if (!parse_options(argc, argv, &opt)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if (opt.json) {
+        printf("{\"seed\": %llu, \"min_hops\": %d, \"max_hops\": %d, \"construction\": \"%s\","
+               " \"brute_mode\": %d,\n \"runs\": [",
+               opt.seed, opt.min_hops, opt.max_hops,
+               opt.construction == ACO_CONSTRUCT_EDGE_WALK ? "edge_walk" : "subset",
+               opt.brute_mode);
+    } else {
+        print_csv_header();
+    }
+
+    int printed = 0;
+    int errors = 0;
+    for (int n = 0; n < opt.node_points; n++) {
+        for (int a = 0; a < opt.ant_points; a++) {
+            for (int t = 0; t < opt.thread_points; t++) {
+                BenchResult res;
+                int rc = run_point(&opt, opt.nodes[n], opt.ants[a], opt.threads[t], &res);
+                if (rc != ERR_SUCCESS) {
+                    fprintf(stderr, "nodes=%d ants=%d threads=%d: failed with code %d\n",
+                            opt.nodes[n], opt.ants[a], opt.threads[t], rc);
+                    errors++;
+                    continue;
+                }
+                if (opt.json) {
+                    print_json_run(&res, printed == 0);
+                } else {
+                    print_csv_row(&res);
+                }
+                printed++;
+            }
+        }
+    }
+
+    if (opt.json) {
+        printf("\n]}\n");
+    }
+    return errors ? 2 : 0;
+}
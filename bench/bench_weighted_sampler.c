@@ -0,0 +1,154 @@
+/* Relative Path: bench/bench_weighted_sampler.c */
+/*
+ * Microbenchmark: Fenwick-tree WeightedSampler against the former linear cumulative scan.
+ * Both draw k items without replacement from n weighted candidates, as one ACO ant does.
+ * Usage: bench_weighted_sampler [k] [rounds]. Prints one line per candidate count.
+*/
+
+#include "../include/algo/cpu/cpu_weighted_sampler.h"
+#include "../include/core/backend_rng.h"
+#include "../include/consts/error_codes.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static double now_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/*
+ * linear_scan_pick
+ * The loop formerly used by aco_build_path_for_one_ant: cumulative scan with a
+ * division per candidate, then swap-with-last removal.
+ */
+static int linear_scan_pick(AntNetRng* rng, const float* base, int n, int k,
+                            int* node_list, float* node_weight, int* out)
+{
+    float total_weight = 0.0f;
+    for (int c = 0; c < n; c++) {
+        node_list[c]   = c;
+        node_weight[c] = base[c];
+        total_weight  += base[c];
+    }
+
+    int chosen_count = 0;
+    int remain = n;
+    for (int pick = 0; pick < k; pick++) {
+        if (remain <= 0 || total_weight <= 1e-9f) {
+            break;
+        }
+        float r = antnet_rng_next_float(rng);
+        float accum = 0.0f;
+        int chosen_index = -1;
+        for (int c = 0; c < remain; c++) {
+            accum += node_weight[c] / total_weight;
+            if (r <= accum) {
+                chosen_index = c;
+                break;
+            }
+        }
+        if (chosen_index < 0) {
+            chosen_index = remain - 1;
+        }
+        out[chosen_count++] = node_list[chosen_index];
+        total_weight -= node_weight[chosen_index];
+        node_list[chosen_index]   = node_list[remain - 1];
+        node_weight[chosen_index] = node_weight[remain - 1];
+        remain--;
+    }
+    return chosen_count;
+}
+
+static int fenwick_pick(AntNetRng* rng, WeightedSampler* sampler, const double* base,
+                        int n, int k, int* out)
+{
+    weighted_sampler_build(sampler, base, n);
+    int chosen_count = 0;
+    for (int pick = 0; pick < k; pick++) {
+        int idx = weighted_sampler_draw(sampler, antnet_rng_next_float(rng));
+        if (idx < 0) {
+            break;
+        }
+        out[chosen_count++] = idx;
+        weighted_sampler_remove(sampler, idx);
+    }
+    return chosen_count;
+}
+
+int main(int argc, char** argv)
+{
+    int k      = (argc > 1) ? atoi(argv[1]) : 120;
+    int rounds = (argc > 2) ? atoi(argv[2]) : 2000;
+    if (k <= 0 || rounds <= 0) {
+        fprintf(stderr, "usage: %s [k > 0] [rounds > 0]\n", argv[0]);
+        return 1;
+    }
+
+    static const int sizes[] = { 128, 512, 2048, 8192, 32768 };
+    const int nb_sizes = (int)(sizeof(sizes) / sizeof(sizes[0]));
+
+    printf("%8s %6s %14s %14s %8s\n", "n", "k", "scan_us/ant", "fenwick_us/ant", "speedup");
+
+    for (int s = 0; s < nb_sizes; s++) {
+        int n = sizes[s];
+        int picks = (k < n) ? k : n;
+
+        float*  base_f      = (float*)malloc(sizeof(float) * (size_t)n);
+        double* base_d      = (double*)malloc(sizeof(double) * (size_t)n);
+        int*    node_list   = (int*)malloc(sizeof(int) * (size_t)n);
+        float*  node_weight = (float*)malloc(sizeof(float) * (size_t)n);
+        int*    out         = (int*)malloc(sizeof(int) * (size_t)n);
+        WeightedSampler sampler;
+        if (!base_f || !base_d || !node_list || !node_weight || !out ||
+            weighted_sampler_init(&sampler, n) != ERR_SUCCESS) {
+            fprintf(stderr, "allocation failed for n=%d\n", n);
+            return 1;
+        }
+
+        /* Row-sum-like weights: around n, with a few strongly reinforced nodes. */
+        AntNetRng rng;
+        antnet_rng_seed_stream(&rng, 12345u, (uint64_t)n);
+        for (int i = 0; i < n; i++) {
+            float w = (float)n * (0.5f + antnet_rng_next_float(&rng));
+            if (antnet_rng_next_int(&rng, 64) == 0) {
+                w *= 20.0f;
+            }
+            base_f[i] = w;
+            base_d[i] = (double)w;
+        }
+
+        long checksum = 0;
+        double t0 = now_seconds();
+        for (int r = 0; r < rounds; r++) {
+            int got = linear_scan_pick(&rng, base_f, n, picks, node_list, node_weight, out);
+            checksum += out[got - 1];
+        }
+        double t_scan = now_seconds() - t0;
+
+        t0 = now_seconds();
+        for (int r = 0; r < rounds; r++) {
+            int got = fenwick_pick(&rng, &sampler, base_d, n, picks, out);
+            checksum += out[got - 1];
+        }
+        double t_fenwick = now_seconds() - t0;
+
+        printf("%8d %6d %14.2f %14.2f %7.1fx   (checksum %ld)\n",
+               n, picks,
+               t_scan * 1e6 / rounds,
+               t_fenwick * 1e6 / rounds,
+               (t_fenwick > 0.0) ? t_scan / t_fenwick : 0.0,
+               checksum);
+
+        weighted_sampler_free(&sampler);
+        free(out);
+        free(node_weight);
+        free(node_list);
+        free(base_d);
+        free(base_f);
+    }
+    return 0;
+}
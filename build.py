@@ -98,6 +98,9 @@ def main() -> None:
             "include/types/antnet_aco_v1_types.h",
             "include/types/antnet_sasa_types.h",
             "include/types/antnet_ranking_types.h",
+            "include/types/antnet_log_types.h",
+            "include/types/antnet_perf_types.h",
+            "include/types/antnet_results_types.h",
         "--output", "src/python/structs/_generated/auto_structs.py"])
 
     # Preprocess headers for CFFI
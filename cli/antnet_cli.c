@@ -0,0 +1,570 @@
+/* Relative Path: cli/antnet_cli.c */
+/*
+ * Headless runner for batch jobs on hosts without Qt or Python. Loads an .ini through
+ * pub_init_from_config, builds a hop-map topology or reads one from a file, runs solver
+ * iterations on several contexts in parallel and prints per-solver convergence
+ * statistics as CSV (default) or JSON on stdout.
+*/
+
+#include "../include/rendering/heatmap_renderer_api.h"
+#include "../include/core/backend_topology.h"
+#include "../include/managers/config_manager.h"
+#include "../include/managers/hop_map_manager.h"
+#include "../include/consts/error_codes.h"
+
+#include <limits.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define CLI_MAX_CONTEXTS 256
+#define CLI_CHUNK        64  /* iterations per pub_run_solvers_batch call */
+#define CLI_SOLVERS      ANTNET_BATCH_TRACE_WIDTH
+
+static const char* const k_solver_names[CLI_SOLVERS] = { "aco", "random", "brute" };
+
+typedef struct CliOptions {
+    const char* config_path;
+    const char* topology_path;      /* NULL: generate with the hop map */
+    const char* save_topology_path; /* NULL: do not save */
+    int nodes;                      /* hop-map node count, 0 = set_nb_nodes of the config */
+    int iterations;                 /* per context */
+    int time_ms;                    /* per context, 0 = no limit */
+    int contexts;
+    unsigned long long seed;        /* 0 = seed of the config; 0 there too = clock seeds */
+    int json;
+    int verbose;                    /* backend log lines to stderr */
+} CliOptions;
+
+typedef struct CliTopology {
+    NodeData* nodes;
+    int       node_count;
+    EdgeData* edges;
+    int       edge_count;
+} CliTopology;
+
+/*
+ * CliSolverStats
+ * Convergence of one solver on one context. The time to best is estimated from the
+ * duration of the batch call that found it, spread evenly over its iterations.
+ */
+typedef struct CliSolverStats {
+    int    best_latency;   /* -1 while no path was found */
+    int    improvements;   /* iterations that lowered the best, the first path included */
+    int    best_iteration; /* first iteration at best_latency */
+    double best_ms;
+} CliSolverStats;
+
+typedef struct CliRun {
+    const CliOptions*  opt;
+    const CliTopology* topo;
+    int                index;
+    pthread_t          thread;
+    int                started;
+
+    int                rc;
+    unsigned long long seed;          /* effective seed, replays the run */
+    int                iterations;
+    double             seconds;
+    int                exact_latency; /* -1 unless the exact solver is enabled */
+    CliSolverStats     solvers[CLI_SOLVERS];
+} CliRun;
+
+static double now_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void usage(const char* prog)
+{
+    fprintf(stderr,
+            "usage: %s [--config config/settings.ini] [--topology FILE | --nodes N]\n"
+            "          [--save-topology FILE] [--iterations 1000] [--time-ms 0]\n"
+            "          [--contexts 1] [--seed 0] [--json] [--verbose]\n"
+            "Runs --iterations, or until --time-ms if only that is given, on each context.\n",
+            prog);
+}
+
+static int parse_options(int argc, char** argv, CliOptions* opt)
+{
+    memset(opt, 0, sizeof(*opt));
+    opt->config_path = "config/settings.ini";
+    opt->contexts    = 1;
+    int iterations_set = 0;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* val = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (strcmp(arg, "--json") == 0) {
+            opt->json = 1;
+        } else if (strcmp(arg, "--verbose") == 0) {
+            opt->verbose = 1;
+        } else if (!val) {
+            return 0;
+        } else if (strcmp(arg, "--config") == 0) {
+            opt->config_path = val;
+            i++;
+        } else if (strcmp(arg, "--topology") == 0) {
+            opt->topology_path = val;
+            i++;
+        } else if (strcmp(arg, "--save-topology") == 0) {
+            opt->save_topology_path = val;
+            i++;
+        } else if (strcmp(arg, "--nodes") == 0) {
+            opt->nodes = atoi(val);
+            i++;
+        } else if (strcmp(arg, "--iterations") == 0) {
+            opt->iterations = atoi(val);
+            iterations_set = 1;
+            i++;
+        } else if (strcmp(arg, "--time-ms") == 0) {
+            opt->time_ms = atoi(val);
+            i++;
+        } else if (strcmp(arg, "--contexts") == 0) {
+            opt->contexts = atoi(val);
+            i++;
+        } else if (strcmp(arg, "--seed") == 0) {
+            opt->seed = strtoull(val, NULL, 10);
+            i++;
+        } else {
+            return 0;
+        }
+    }
+    if (!iterations_set) {
+        opt->iterations = (opt->time_ms > 0) ? INT_MAX : 1000;
+    }
+    return opt->iterations > 0 && opt->time_ms >= 0 && opt->nodes >= 0
+        && opt->contexts > 0 && opt->contexts <= CLI_MAX_CONTEXTS
+        && !(opt->topology_path && opt->nodes > 0);
+}
+
+/*
+ * generate_topology
+ * Hop-map nodes with delays drawn from the config range, the default chain plus the
+ * grid edges. seed 0 keeps the clock seed of the hop map.
+ */
+static int generate_topology(const AppConfig* cfg, int total_nodes, unsigned long long seed,
+                             CliTopology* topo)
+{
+    HopMapManager* mgr = hop_map_manager_create();
+    if (!mgr) {
+        return ERR_MEMORY_ALLOCATION;
+    }
+    if (seed != 0) {
+        hop_map_manager_set_seed(mgr, seed);
+    }
+    hop_map_manager_set_delay_range(mgr, cfg->default_min_delay, cfg->default_max_delay);
+    hop_map_manager_initialize_map(mgr, total_nodes);
+    hop_map_manager_create_default_edges(mgr);
+    hop_map_manager_add_grid_edges(mgr);
+
+    size_t node_count = 0, edge_count = 0;
+    hop_map_manager_export_topology(mgr, NULL, &node_count, NULL, &edge_count);
+    topo->nodes = (NodeData*)malloc(node_count * sizeof(NodeData));
+    topo->edges = (EdgeData*)malloc((edge_count ? edge_count : 1) * sizeof(EdgeData));
+    int rc = ERR_MEMORY_ALLOCATION;
+    if (topo->nodes && topo->edges) {
+        hop_map_manager_export_topology(mgr, topo->nodes, &node_count, topo->edges, &edge_count);
+        topo->node_count = (int)node_count;
+        topo->edge_count = (int)edge_count;
+        rc = ERR_SUCCESS;
+    }
+    hop_map_manager_destroy(mgr);
+    return rc;
+}
+
+/*
+ * load_topology
+ * Reads "node <id> <delay_ms>" and "edge <from> <to>" lines; blank lines and lines
+ * starting with '#' are skipped. Node ids must cover 0 .. count-1, node 0 being the
+ * start and node 1 the end, as in a generated hop map.
+ */
+static int load_topology(const char* path, CliTopology* topo)
+{
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "%s: cannot open\n", path);
+        return ERR_INVALID_ARGS;
+    }
+
+    int node_cap = 64, edge_cap = 256;
+    topo->nodes = (NodeData*)malloc((size_t)node_cap * sizeof(NodeData));
+    topo->edges = (EdgeData*)malloc((size_t)edge_cap * sizeof(EdgeData));
+    int rc = (topo->nodes && topo->edges) ? ERR_SUCCESS : ERR_MEMORY_ALLOCATION;
+
+    char line[256];
+    int line_no = 0;
+    while (rc == ERR_SUCCESS && fgets(line, sizeof(line), f)) {
+        line_no++;
+        char kind[8];
+        int a, b;
+        if (sscanf(line, " %7s", kind) != 1 || kind[0] == '#') {
+            continue;
+        }
+        if (sscanf(line, " %7s %d %d", kind, &a, &b) != 3 || a < 0 || b < 0) {
+            rc = ERR_INVALID_ARGS;
+        } else if (strcmp(kind, "node") == 0) {
+            if (topo->node_count == node_cap) {
+                node_cap *= 2;
+                NodeData* grown = (NodeData*)realloc(topo->nodes, (size_t)node_cap * sizeof(NodeData));
+                if (!grown) {
+                    rc = ERR_MEMORY_ALLOCATION;
+                    break;
+                }
+                topo->nodes = grown;
+            }
+            NodeData* n = &topo->nodes[topo->node_count++];
+            memset(n, 0, sizeof(*n));
+            n->node_id  = a;
+            n->delay_ms = b;
+        } else if (strcmp(kind, "edge") == 0) {
+            if (topo->edge_count == edge_cap) {
+                edge_cap *= 2;
+                EdgeData* grown = (EdgeData*)realloc(topo->edges, (size_t)edge_cap * sizeof(EdgeData));
+                if (!grown) {
+                    rc = ERR_MEMORY_ALLOCATION;
+                    break;
+                }
+                topo->edges = grown;
+            }
+            topo->edges[topo->edge_count].from_id = a;
+            topo->edges[topo->edge_count].to_id   = b;
+            topo->edge_count++;
+        } else {
+            rc = ERR_INVALID_ARGS;
+        }
+        if (rc == ERR_INVALID_ARGS) {
+            fprintf(stderr, "%s:%d: expected 'node <id> <delay_ms>' or 'edge <from> <to>'\n",
+                    path, line_no);
+        }
+    }
+    fclose(f);
+    if (rc != ERR_SUCCESS) {
+        return rc;
+    }
+
+    /* Ids index the solver arrays: each of 0 .. count-1 exactly once, edges between them. */
+    int n = topo->node_count;
+    char* seen = (char*)calloc(n > 0 ? (size_t)n : 1, 1);
+    if (!seen) {
+        return ERR_MEMORY_ALLOCATION;
+    }
+    for (int i = 0; i < n && rc == ERR_SUCCESS; i++) {
+        int id = topo->nodes[i].node_id;
+        if (id >= n || seen[id]) {
+            rc = ERR_INVALID_ARGS;
+        } else {
+            seen[id] = 1;
+        }
+    }
+    for (int e = 0; e < topo->edge_count && rc == ERR_SUCCESS; e++) {
+        if (topo->edges[e].from_id >= n || topo->edges[e].to_id >= n) {
+            rc = ERR_INVALID_ARGS;
+        }
+    }
+    free(seen);
+    if (rc == ERR_SUCCESS && n < 2) {
+        rc = ERR_INVALID_ARGS;
+    }
+    if (rc != ERR_SUCCESS) {
+        fprintf(stderr, "%s: node ids must be 0 .. count-1 (at least 2), edges between them\n",
+                path);
+    }
+    return rc;
+}
+
+static int save_topology(const char* path, const CliTopology* topo)
+{
+    FILE* f = fopen(path, "w");
+    if (!f) {
+        fprintf(stderr, "%s: cannot write\n", path);
+        return ERR_INVALID_ARGS;
+    }
+    fprintf(f, "# antnet topology: node <id> <delay_ms>, edge <from> <to>; 0 start, 1 end\n");
+    for (int i = 0; i < topo->node_count; i++) {
+        fprintf(f, "node %d %d\n", topo->nodes[i].node_id, topo->nodes[i].delay_ms);
+    }
+    for (int e = 0; e < topo->edge_count; e++) {
+        fprintf(f, "edge %d %d\n", topo->edges[e].from_id, topo->edges[e].to_id);
+    }
+    return fclose(f) == 0 ? ERR_SUCCESS : ERR_INVALID_ARGS;
+}
+
+/*
+ * run_context
+ * Runs the iterations of one context in pub_run_solvers_batch chunks, folding each
+ * chunk's trace into the convergence statistics.
+ */
+static int run_context(CliRun* run, int ctx)
+{
+    const CliOptions* opt = run->opt;
+    if (opt->seed != 0) {
+        pub_set_seed(ctx, opt->seed + (unsigned long long)run->index);
+    }
+    uint64_t seed = 0;
+    pub_get_seed(ctx, &seed);
+    run->seed = seed;
+
+    int rc = pub_update_topology(ctx, run->topo->nodes, run->topo->node_count,
+                                 run->topo->edges, run->topo->edge_count);
+    if (rc != ERR_SUCCESS) {
+        return rc;
+    }
+
+    AppConfig cfg;
+    pub_get_config(ctx, &cfg);
+    int max_size = (cfg.max_hops > 0) ? cfg.max_hops + 2 : 2;
+    int* buffers = (int*)malloc(3 * (size_t)max_size * sizeof(int));
+    if (!buffers) {
+        return ERR_MEMORY_ALLOCATION;
+    }
+    int trace[CLI_CHUNK * CLI_SOLVERS];
+    int lens[CLI_SOLVERS], lats[CLI_SOLVERS];
+
+    double t0 = now_seconds();
+    double deadline = t0 + opt->time_ms * 1e-3;
+    while (run->iterations < opt->iterations) {
+        int chunk = opt->iterations - run->iterations;
+        if (chunk > CLI_CHUNK) {
+            chunk = CLI_CHUNK;
+        }
+        int budget_us = 0;
+        if (opt->time_ms > 0) {
+            double left = deadline - now_seconds();
+            if (left <= 0.0) {
+                break;
+            }
+            budget_us = (left * 1e6 < (double)INT_MAX) ? (int)(left * 1e6) + 1 : INT_MAX;
+        }
+
+        int done = 0, stop = 0;
+        double start = now_seconds();
+        rc = pub_run_solvers_batch(ctx, chunk, budget_us, 0,
+                                   buffers, max_size, &lens[0], &lats[0],
+                                   buffers + max_size, max_size, &lens[1], &lats[1],
+                                   buffers + 2 * max_size, max_size, &lens[2], &lats[2],
+                                   trace, chunk, &done, &stop);
+        double per_iteration_ms = (done > 0) ? (now_seconds() - start) * 1e3 / done : 0.0;
+        for (int r = 0; r < done; r++) {
+            for (int s = 0; s < CLI_SOLVERS; s++) {
+                CliSolverStats* st = &run->solvers[s];
+                int latency = trace[r * CLI_SOLVERS + s];
+                if (latency >= 0 && (st->best_latency < 0 || latency < st->best_latency)) {
+                    st->best_latency   = latency;
+                    st->best_iteration = run->iterations + r + 1;
+                    st->best_ms        = (start - t0) * 1e3 + (r + 1) * per_iteration_ms;
+                    st->improvements++;
+                }
+            }
+        }
+        run->iterations += done;
+        if (rc != ERR_SUCCESS || stop == ANTNET_BATCH_STOP_DEADLINE) {
+            break;
+        }
+    }
+    run->seconds = now_seconds() - t0;
+
+    int exact_len = 0, exact_latency = 0, lower_bound = 0;
+    if (rc == ERR_SUCCESS && cfg.exact_solver &&
+        pub_get_exact_path(ctx, buffers, max_size, &exact_len, &exact_latency, &lower_bound)
+            == ERR_SUCCESS && exact_len > 0) {
+        run->exact_latency = exact_latency;
+    }
+    free(buffers);
+    return rc;
+}
+
+static void* run_thread(void* arg)
+{
+    CliRun* run = (CliRun*)arg;
+    run->exact_latency = -1;
+    for (int s = 0; s < CLI_SOLVERS; s++) {
+        run->solvers[s].best_latency = -1;
+    }
+
+    int ctx = pub_init_from_config(run->opt->config_path);
+    if (ctx < 0) {
+        run->rc = ctx;
+        return NULL;
+    }
+    run->rc = run_context(run, ctx);
+    pub_shutdown(ctx);
+    return NULL;
+}
+
+/* Relative gap of latency to the exact optimum, or a negative value without one. */
+static double exact_gap(const CliRun* run, int s)
+{
+    if (run->exact_latency <= 0 || run->solvers[s].best_latency < 0) {
+        return -1.0;
+    }
+    return (double)(run->solvers[s].best_latency - run->exact_latency) / run->exact_latency;
+}
+
+static void print_csv(const CliRun* runs, int count)
+{
+    printf("context,seed,iterations,seconds,iter_per_s,solver,best_latency,improvements,"
+           "best_iteration,ms_to_best,exact_latency,gap_to_exact\n");
+    for (int i = 0; i < count; i++) {
+        const CliRun* r = &runs[i];
+        if (r->rc != ERR_SUCCESS) {
+            continue;
+        }
+        for (int s = 0; s < CLI_SOLVERS; s++) {
+            const CliSolverStats* st = &r->solvers[s];
+            printf("%d,%llu,%d,%.6f,%.3f,%s,%d,%d,%d,%.3f,%d,", r->index, r->seed,
+                   r->iterations, r->seconds, r->seconds > 0 ? r->iterations / r->seconds : 0.0,
+                   k_solver_names[s], st->best_latency, st->improvements, st->best_iteration,
+                   st->best_ms, r->exact_latency);
+            if (exact_gap(r, s) >= 0.0) {
+                printf("%.6f", exact_gap(r, s));
+            }
+            printf("\n");
+        }
+    }
+}
+
+/*
+ * print_json
+ * Per-context statistics, then per-solver aggregates over the contexts that found a path:
+ * best latency range and mean, and mean iterations and milliseconds to the best.
+ */
+static void print_json(const CliOptions* opt, const CliTopology* topo, const CliRun* runs,
+                       int count)
+{
+    printf("{\"config\": \"%s\", \"nodes\": %d, \"edges\": %d, \"time_ms\": %d,\n \"runs\": [",
+           opt->config_path, topo->node_count, topo->edge_count, opt->time_ms);
+    int printed = 0;
+    for (int i = 0; i < count; i++) {
+        const CliRun* r = &runs[i];
+        if (r->rc != ERR_SUCCESS) {
+            continue;
+        }
+        printf("%s\n    {\"context\": %d, \"seed\": %llu, \"iterations\": %d, \"seconds\": %.6f,"
+               " \"exact_latency\": %d, \"solvers\": {", printed++ ? "," : "", r->index,
+               r->seed, r->iterations, r->seconds, r->exact_latency);
+        for (int s = 0; s < CLI_SOLVERS; s++) {
+            const CliSolverStats* st = &r->solvers[s];
+            printf("%s\"%s\": {\"best_latency\": %d, \"improvements\": %d,"
+                   " \"best_iteration\": %d, \"ms_to_best\": %.3f, \"gap_to_exact\": %.6f}",
+                   s ? ", " : "", k_solver_names[s], st->best_latency, st->improvements,
+                   st->best_iteration, st->best_ms, exact_gap(r, s));
+        }
+        printf("}}");
+    }
+    printf("\n ],\n \"summary\": {");
+    for (int s = 0; s < CLI_SOLVERS; s++) {
+        int found = 0, best_min = -1, best_max = -1;
+        double best_sum = 0.0, iteration_sum = 0.0, ms_sum = 0.0;
+        for (int i = 0; i < count; i++) {
+            const CliSolverStats* st = &runs[i].solvers[s];
+            if (runs[i].rc != ERR_SUCCESS || st->best_latency < 0) {
+                continue;
+            }
+            found++;
+            best_min = (best_min < 0 || st->best_latency < best_min) ? st->best_latency : best_min;
+            best_max = (st->best_latency > best_max) ? st->best_latency : best_max;
+            best_sum      += st->best_latency;
+            iteration_sum += st->best_iteration;
+            ms_sum        += st->best_ms;
+        }
+        double div = found ? (double)found : 1.0;
+        printf("%s\n    \"%s\": {\"contexts\": %d, \"best_min\": %d, \"best_mean\": %.3f,"
+               " \"best_max\": %d, \"best_iteration_mean\": %.3f, \"ms_to_best_mean\": %.3f}",
+               s ? "," : "", k_solver_names[s], found, best_min, best_sum / div, best_max,
+               iteration_sum / div, ms_sum / div);
+    }
+    printf("\n }}\n");
+}
+
+static void drain_logs_to_stderr(void)
+{
+    AntNetLogEntry entries[64];
+    int count;
+    while ((count = pub_drain_logs(entries, 64)) > 0) {
+        for (int i = 0; i < count; i++) {
+            fprintf(stderr, "%s\n", entries[i].message);
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    CliOptions opt;
+    if (!parse_options(argc, argv, &opt)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    AppConfig cfg;
+    pub_config_set_defaults(&cfg);
+    if (!pub_config_load(&cfg, opt.config_path)) {
+        fprintf(stderr, "%s: cannot load config\n", opt.config_path);
+        return 1;
+    }
+
+    if (opt.seed == 0) {
+        opt.seed = cfg.seed;
+    }
+
+    CliTopology topo;
+    memset(&topo, 0, sizeof(topo));
+    int rc = opt.topology_path
+           ? load_topology(opt.topology_path, &topo)
+           : generate_topology(&cfg, opt.nodes > 0 ? opt.nodes : cfg.set_nb_nodes, opt.seed,
+                               &topo);
+    if (rc == ERR_SUCCESS && opt.save_topology_path) {
+        rc = save_topology(opt.save_topology_path, &topo);
+    }
+    if (rc != ERR_SUCCESS) {
+        fprintf(stderr, "topology setup failed with code %d\n", rc);
+        free(topo.nodes);
+        free(topo.edges);
+        return 2;
+    }
+
+    /* Contexts share the topology; each derives its solver seed from --seed and its index. */
+    CliRun* runs = (CliRun*)calloc((size_t)opt.contexts, sizeof(CliRun));
+    if (!runs) {
+        free(topo.nodes);
+        free(topo.edges);
+        return 2;
+    }
+    for (int i = 0; i < opt.contexts; i++) {
+        runs[i].opt   = &opt;
+        runs[i].topo  = &topo;
+        runs[i].index = i;
+        runs[i].started = (pthread_create(&runs[i].thread, NULL, run_thread, &runs[i]) == 0);
+        if (!runs[i].started) {
+            runs[i].rc = ERR_INTERNAL_FAILURE;
+        }
+    }
+    int errors = 0;
+    for (int i = 0; i < opt.contexts; i++) {
+        if (runs[i].started) {
+            pthread_join(runs[i].thread, NULL);
+        }
+        if (runs[i].rc != ERR_SUCCESS) {
+            fprintf(stderr, "context %d: failed with code %d\n", i, runs[i].rc);
+            errors++;
+        }
+    }
+    if (opt.verbose) {
+        drain_logs_to_stderr();
+    }
+
+    if (opt.json) {
+        print_json(&opt, &topo, runs, opt.contexts);
+    } else {
+        print_csv(runs, opt.contexts);
+    }
+
+    free(runs);
+    free(topo.nodes);
+    free(topo.edges);
+    return errors ? 2 : 0;
+}
@@ -12,8 +12,18 @@
 extern "C" {
 #endif
 
+#include <stddef.h>
 #include "../../rendering/heatmap_renderer_api.h"
 
+/* Lowest pheromone value a cell may hold, so no edge becomes unreachable. */
+#define ACO_PHEROMONE_FLOOR 1e-6f
+
+/* Entries of the lazy evaporation power table; older cells fall back to pow(). */
+#define ACO_LAZY_DECAY_TABLE_SIZE 1024
+
+/* Cells converted at a time by row sweeps over 16-bit storage, on the stack (multiple of 8). */
+#define ACO_STORAGE_CHUNK 256
+
 /*
  * aco_v1_init: to be implemented with actual pheromone and ant structure setups.
  * Returns 0 on success, negative on error.
@@ -21,6 +31,103 @@ extern "C" {
  */
 int aco_v1_init(AntNetContext* ctx);
 
+/*
+ * aco_v1_alloc_pheromones: (re)allocates the n*n matrix in state->storage_mode with every
+ * cell at 1.0. Row sums are left to the caller. Returns 0 or ERR_MEMORY_ALLOCATION.
+ */
+int aco_v1_alloc_pheromones(AcoV1State* state, int n);
+
+/*
+ * aco_v1_grow_pheromones: widens the matrix, row sums and lazy stamps of state to n nodes,
+ * keeping every learned value; new cells start at 1.0. Adjacency and neighbour lists are
+ * left alone. No-op if n <= pheromone_size. Returns 0 or ERR_MEMORY_ALLOCATION.
+ */
+int aco_v1_grow_pheromones(AcoV1State* state, int n);
+
+/*
+ * aco_v1_sync_topology: patches an initialized solver after ctx->nodes, ctx->edges or the
+ * disabled flags changed in place. Grows the matrices to ctx->num_nodes, rebuilds adjacency
+ * and neighbour lists, and re-points the colonies; pheromones are kept. A shrunk node set
+ * drops the state instead. No-op before the first iteration. Caller holds ctx->lock.
+ */
+int aco_v1_sync_topology(AntNetContext* ctx);
+
+/*
+ * aco_v1_has_pheromones: non-zero once a matrix is allocated, whatever its storage format.
+ */
+int aco_v1_has_pheromones(const AcoV1State* state);
+
+/*
+ * aco_v1_load_cells / aco_v1_store_cells: raw stored values of cells [first, first+count),
+ * without lazy decay, converted from or to the storage format with the vector kernels.
+ * store_cells returns the sum of the values as stored, i.e. after rounding; keeping
+ * row_sums in step is up to the caller.
+ */
+void   aco_v1_load_cells(const AcoV1State* state, size_t first, int count, float* out);
+double aco_v1_store_cells(AcoV1State* state, size_t first, int count, const float* in);
+
+/*
+ * aco_v1_evaporate_row: multiplies every stored cell of row by keep, floored, and returns
+ * the new row sum. The caller stores it in row_sums.
+ */
+double aco_v1_evaporate_row(AcoV1State* state, int row, float keep);
+
+/*
+ * aco_v1_set_storage_mode: converts the matrix to an ACO_STORAGE_* format, or only records
+ * the format when no matrix is allocated yet. Caller holds ctx->lock.
+ */
+int aco_v1_set_storage_mode(AcoV1State* state, int mode);
+
+/*
+ * aco_v1_free_buffers: releases adjacency, pheromones, row_sums, the edge-walk
+ * neighbour lists, lazy stamps and extra colonies, and clears is_initialized, so the
+ * next iteration re-runs aco_v1_init. Caller holds ctx->lock.
+ */
+void aco_v1_free_buffers(AcoV1State* state);
+
+/*
+ * aco_v1_set_pheromone: writes pheromones[index] clamped to >= ACO_PHEROMONE_FLOOR and applies the
+ * same change to row_sums. Every pheromone write must go through it.
+ */
+void aco_v1_set_pheromone(AcoV1State* state, int index, float value);
+
+/*
+ * aco_v1_get_pheromone: current value of pheromones[index]. In ACO_EVAPORATE_LAZY mode the
+ * pending evaporation is applied on the fly; otherwise this is a plain read.
+ */
+float aco_v1_get_pheromone(const AcoV1State* state, int index);
+
+/*
+ * aco_v1_get_row_sum: current row_sums[row], decayed on the fly in lazy mode.
+ * Lazy row sums only see the per-cell floor as a lower bound of n*floor for the row,
+ * so a partly floored row may read up to n*ACO_PHEROMONE_FLOOR low.
+ */
+double aco_v1_get_row_sum(const AcoV1State* state, int row);
+
+/*
+ * aco_v1_lazy_advance: starts a new evaporation step in lazy mode, i.e. every cell
+ * loses (1-evaporation) without being touched. Rebuilds the power table when the
+ * evaporation rate changed. Caller holds ctx->lock.
+ */
+int aco_v1_lazy_advance(AcoV1State* state);
+
+/*
+ * aco_v1_materialize: writes the current value of every cell back into pheromones and
+ * resets all stamps to the clock. O(n*n); a no-op outside lazy mode.
+ */
+void aco_v1_materialize(AcoV1State* state);
+
+/*
+ * aco_v1_export_pheromones: copies the current n*n values into out without changing state.
+ */
+void aco_v1_export_pheromones(const AcoV1State* state, float* out);
+
+/*
+ * aco_v1_set_evaporation_mode: switches ACO_EVAPORATE_* mode, allocating the lazy stamps
+ * or materializing and freeing them as needed. Caller holds ctx->lock.
+ */
+int aco_v1_set_evaporation_mode(AcoV1State* state, int mode);
+
 /*
  * aco_v1_run_iteration: performs one iteration of the ACO logic,
  * e.g., ants traveling and updating pheromones.
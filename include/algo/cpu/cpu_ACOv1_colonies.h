@@ -0,0 +1,50 @@
+/* Relative Path: include/algo/cpu/cpu_ACOv1_colonies.h */
+/*
+ * Declares the multi-colony ACO v1 iteration: K colonies with private pheromone matrices,
+ * each running its ants as one worker pool task without touching the others' memory.
+ * Colonies exchange best paths or blend matrices every migration_interval iterations.
+*/
+
+#ifndef CPU_ACOV1_COLONIES_H
+#define CPU_ACOV1_COLONIES_H
+
+#include "../../rendering/heatmap_renderer_api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Upper bound accepted by pub_set_aco_colonies. */
+#define ACO_MAX_COLONIES 64
+
+/* Fraction of the all-colony mean mixed into each matrix by ACO_MIGRATE_BLEND. */
+#define ACO_COLONY_BLEND_WEIGHT 0.25f
+
+/*
+ * aco_v1_run_iteration_colonies
+ * One iteration over ctx->aco_v1.colony_count colonies. Colony 0 is ctx->aco_v1 itself,
+ * so pub_get_pheromone_matrix and the heatmap keep showing a live matrix. The best path of
+ * all colonies goes to ctx->aco_best_*. Returns 0 on success, negative on error.
+ */
+int aco_v1_run_iteration_colonies(AntNetContext* ctx);
+
+/*
+ * aco_v1_colonies_sync
+ * Called by aco_v1_sync_topology once main has its new matrices and neighbour lists:
+ * grows every colony to main's size and re-points the borrowed topology. Colony best
+ * paths are dropped. Caller holds ctx->lock. Returns 0 or ERR_MEMORY_ALLOCATION.
+ */
+int aco_v1_colonies_sync(AcoV1State* main);
+
+/*
+ * aco_v1_colonies_free
+ * Frees the extra colonies. Borrowed adjacency and neighbour lists are left alone.
+ * NULL is accepted and ignored.
+ */
+void aco_v1_colonies_free(AcoColonySet* set);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CPU_ACOV1_COLONIES_H */
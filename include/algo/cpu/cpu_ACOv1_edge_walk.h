@@ -0,0 +1,45 @@
+/* Relative Path: include/algo/cpu/cpu_ACOv1_edge_walk.h */
+/*
+ * Declares the edge-walking tour construction of ACO v1 (ACO_CONSTRUCT_EDGE_WALK).
+ * Ants follow the adjacency from node 0 to node 1 using a per-iteration choice_info table.
+ * Produces routable paths only, unlike the unordered subset construction.
+*/
+
+#ifndef CPU_ACOV1_EDGE_WALK_H
+#define CPU_ACOV1_EDGE_WALK_H
+
+#include "../../rendering/heatmap_renderer_api.h"
+#include "../../types/antnet_rng_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * aco_v1_edge_walk_build_graph
+ * Builds nbr_offsets/nbr_targets from the adjacency bitset and allocates choice_info.
+ * Called by aco_v1_init once adjacency is filled. Returns 0 on success, negative on error.
+ */
+int aco_v1_edge_walk_build_graph(AcoV1State* state);
+
+/*
+ * aco_v1_edge_walk_refresh_choice_info
+ * Recomputes state->choice_info from its pheromones, alpha, beta and the node delays of ctx.
+ * Must run before the ants of an iteration start; ants only read the table.
+ */
+void aco_v1_edge_walk_refresh_choice_info(AntNetContext* ctx, AcoV1State* state);
+
+/*
+ * aco_v1_edge_walk_construct
+ * Walks one ant over state's neighbour lists from node 0 to node 1 with between min_hops and max_hops intermediate
+ * nodes, never revisiting a node. Writes the path into out_path (room for max_len ints).
+ * Returns 0 on success, ERR_NO_PATH_FOUND if the ant reaches a dead end.
+ */
+int aco_v1_edge_walk_construct(AntNetContext* ctx, const AcoV1State* state, AntNetRng* rng,
+                               int* out_path, int max_len, int* out_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CPU_ACOV1_EDGE_WALK_H */
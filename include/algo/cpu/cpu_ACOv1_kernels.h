@@ -0,0 +1,90 @@
+/* Relative Path: include/algo/cpu/cpu_ACOv1_kernels.h */
+/*
+ * Declares the vectorized pheromone kernels (evaporate, clamp, row sum, 16-bit codecs) of ACO v1.
+ * AVX2 and SSE4.1 variants are picked at runtime; a scalar fallback covers other targets.
+ * Every variant returns bit-identical results, so replays do not depend on the host CPU.
+*/
+
+#ifndef CPU_ACOV1_KERNELS_H
+#define CPU_ACOV1_KERNELS_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Instruction sets a kernel may run with, in increasing order of preference. */
+#define ACO_KERNEL_ISA_SCALAR 0
+#define ACO_KERNEL_ISA_SSE41  1
+#define ACO_KERNEL_ISA_AVX2   2
+
+/*
+ * aco_kernel_detect_isa
+ * Returns the best ACO_KERNEL_ISA_* supported by both the build and the running CPU.
+ * Detection runs once; later calls return the cached value.
+ */
+int aco_kernel_detect_isa(void);
+
+/*
+ * aco_kernel_isa_name
+ * Returns "scalar", "sse4.1" or "avx2".
+ */
+const char* aco_kernel_isa_name(int isa);
+
+/*
+ * aco_kernel_evaporate_row_isa
+ * row[i] = max(row[i] * keep, floor_value) for i in [0..count-1], with the given isa
+ * (clamped to what the CPU supports). Returns the sum of the new values in double,
+ * accumulated in 4 interleaved lanes so that all variants round the same way.
+ */
+double aco_kernel_evaporate_row_isa(int isa, float* row, int count, float keep, float floor_value);
+
+/*
+ * aco_kernel_evaporate_row
+ * aco_kernel_evaporate_row_isa with aco_kernel_detect_isa().
+ */
+double aco_kernel_evaporate_row(float* row, int count, float keep, float floor_value);
+
+/*
+ * aco_kernel_row_sum
+ * Sum of row[0..count-1] in double, same lane order as the evaporate kernel.
+ */
+double aco_kernel_row_sum(const float* row, int count);
+
+/*
+ * aco_kernel_encode_one / aco_kernel_decode_one
+ * Scalar conversion between a pheromone value and its 16-bit code, for format
+ * ACO_STORAGE_FP16 or ACO_STORAGE_LOG16. Values are clamped to the code range before
+ * rounding; both agree bit for bit with the row kernels below.
+ */
+uint16_t aco_kernel_encode_one(int format, float value);
+float    aco_kernel_decode_one(int format, uint16_t code);
+
+/*
+ * aco_kernel_decode_row_isa
+ * out[i] = aco_kernel_decode_one(format, in[i]) for i in [0..count-1], with the given isa
+ * (clamped to what the CPU supports). FP16 needs AVX2 with F16C, LOG16 uses integer
+ * SSE4.1/AVX2 ops; other combinations run the scalar loop.
+ */
+void aco_kernel_decode_row_isa(int isa, int format, const uint16_t* in, float* out, int count);
+
+/*
+ * aco_kernel_encode_row_isa
+ * out[i] = aco_kernel_encode_one(format, in[i]) for i in [0..count-1]. Returns the sum
+ * of the decoded codes, i.e. of what is now stored, in the aco_kernel_row_sum lane order.
+ */
+double aco_kernel_encode_row_isa(int isa, int format, const float* in, uint16_t* out, int count);
+
+/*
+ * aco_kernel_decode_row / aco_kernel_encode_row
+ * The _isa variants with aco_kernel_detect_isa().
+ */
+void   aco_kernel_decode_row(int format, const uint16_t* in, float* out, int count);
+double aco_kernel_encode_row(int format, const float* in, uint16_t* out, int count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CPU_ACOV1_KERNELS_H */
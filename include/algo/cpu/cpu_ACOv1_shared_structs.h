@@ -10,25 +10,40 @@
 #define CPU_ACOv1_SHARED_STRUCTS_H
 
 #include "../../rendering/heatmap_renderer_api.h"
+#include "cpu_weighted_sampler.h"
 
 /*
  * AcoThreadLocalData
  * Holds local pheromone increments and any intermediate best path info for one ant thread.
+ * Increments are kept sparse: an ant touches at most path_length-1 edges, so only
+ * (edge index, delta) pairs are stored instead of a dense n*n matrix.
  */
 typedef struct AcoThreadLocalData
 {
-    float *delta_pheromones; /* local pheromone increments, size = n*n where n=ctx->aco_v1.pheromone_size */
-    int    best_path[1024];
+    int   *delta_index;      /* flat edge index from*n+to, n = ctx->aco_v1.pheromone_size */
+    float *delta_value;      /* increment to add at delta_index[k] */
+    int    delta_count;      /* number of pairs in use */
+    int    delta_capacity;   /* allocated pairs, max_hops+1 covers the longest path */
+    int   *best_path;        /* delta_capacity + 1 entries, the longest path */
     int    best_length;
     int    best_latency;
+    AntNetRng rng;           /* this ant's private stream, seeded per iteration */
 } AcoThreadLocalData;
 
 /*
  * aco_shared_create_local_data
- * Allocates and initializes AcoThreadLocalData for one ant thread.
+ * Allocates and initializes AcoThreadLocalData for one ant thread, with room for
+ * max_deltas (edge, increment) pairs and a best path of max_deltas + 1 nodes.
  * Returns pointer on success, or NULL on allocation failure.
  */
-AcoThreadLocalData *aco_shared_create_local_data(int pheromone_size);
+AcoThreadLocalData *aco_shared_create_local_data(int max_deltas);
+
+/*
+ * aco_shared_add_delta
+ * Appends one (edge index, increment) pair. Returns 0 on success,
+ * ERR_ARRAY_TOO_SMALL if the buffer is full.
+ */
+int aco_shared_add_delta(AcoThreadLocalData *data, int index, float delta);
 
 /*
  * aco_shared_free_local_data
@@ -37,12 +52,58 @@ AcoThreadLocalData *aco_shared_create_local_data(int pheromone_size);
  */
 void aco_shared_free_local_data(AcoThreadLocalData *data);
 
+/*
+ * aco_shared_load_candidate_sampler
+ * Initializes *sampler over node_list[0..candidate_count-1], each node weighted by its
+ * pheromone row sum in state. On success the caller releases it with weighted_sampler_free.
+ */
+int aco_shared_load_candidate_sampler(const AcoV1State *state, const int *node_list,
+                                      int candidate_count, WeightedSampler *sampler);
+
+/*
+ * aco_shared_construct_path
+ * Builds one ant's path [0, ..., 1] into out_path according to state->construction_mode,
+ * reading the pheromones of state (ctx->aco_v1 or a colony) and drawing only from rng.
+ * out_path must hold max_len >= max_hops+2 ints.
+ * Returns 0 on success, ERR_NO_PATH_FOUND if an edge-walking ant got stuck.
+ */
+int aco_shared_construct_path(AntNetContext *ctx, const AcoV1State *state, AntNetRng *rng,
+                              int *out_path, int max_len, int *out_len);
+
+/*
+ * aco_shared_build_ant
+ * Runs one ant against state without modifying it: builds the path, records it in
+ * local_data if it beats the ant's best, and queues the pheromone deltas of its edges.
+ * Returns 0 on success, negative on error (ERR_NO_PATH_FOUND for a lost ant).
+ */
+int aco_shared_build_ant(AntNetContext *ctx, const AcoV1State *state, AcoThreadLocalData *local_data);
+
+/*
+ * aco_shared_apply_local
+ * Serial merge into a state nobody else reads: evaporates (global or lazy mode) and adds
+ * the deltas of thread_locals[0..count-1]. Used by colonies, which run inside one pool task.
+ */
+int aco_shared_apply_local(AcoV1State *state, AcoThreadLocalData **thread_locals, int count);
+
+/*
+ * Below this many cells (swept plus deltas) the merge stays on the calling thread.
+ */
+#define ACO_MERGE_PARALLEL_MIN_CELLS (1L << 15)
+
 /*
  * aco_shared_merge_deltas
- * Merges each thread's delta_pheromones into ctx->aco_v1.pheromones under a single lock.
- * Also updates the global best path if a thread found a better one.
- * Returns 0 on success, negative on error.
+ * Merges each thread's sparse deltas into ctx->aco_v1.pheromones under a single lock,
+ * evaporating every row first in ACO_EVAPORATE_GLOBAL mode. Large merges are split by
+ * row range over the worker pool. Also updates the global best path if a thread found
+ * a better one. Returns 0 on success, negative on error.
  */
 int aco_shared_merge_deltas(AntNetContext *ctx, AcoThreadLocalData **thread_locals, int count);
 
+/*
+ * aco_shared_evaporate_global
+ * Multiplies every pheromone by (1 - evaporation), floored at ACO_PHEROMONE_FLOOR, and
+ * recomputes row_sums. Used by the single-ant iteration in ACO_EVAPORATE_GLOBAL mode.
+ */
+int aco_shared_evaporate_global(AntNetContext *ctx);
+
 #endif /* CPU_ACOv1_SHARED_STRUCTS_H */
@@ -1,6 +1,6 @@
 /* Relative Path: include/algo/cpu/cpu_ACOv1_threaded.h */
 /*
- * Declares a multi-threaded ACO iteration manager, spinning up one thread per ant.
+ * Declares a multi-threaded ACO iteration manager, running ants on the context's worker pool.
  * Each ant computes its path and local delta, merging results after completion.
  * Enhances performance by reducing lock contention.
 */
@@ -13,8 +13,8 @@
 
 /*
  * aco_v1_run_iteration_threaded
- * Spawns one thread per ant (ctx->aco_v1.num_ants), each computing its own path 
- * and local pheromone deltas. Merges everything into ctx->aco_v1.pheromones at the end.
+ * Runs ctx->aco_v1.num_ants ants on the persistent worker pool, each computing its own
+ * path and local pheromone deltas. Merges everything into ctx->aco_v1.pheromones at the end.
  * Returns 0 on success, negative on error.
  */
 int aco_v1_run_iteration_threaded(AntNetContext *ctx);
@@ -11,16 +11,18 @@
 #include "../../rendering/heatmap_renderer_api.h"  /* for AntNetContext */
 
 /*
- * brute_force_search_step: enumerates exactly one new path in ascending order
- * of path length L in [ctx->min_hops..ctx->max_hops], considering permutations
- * and combinations of candidate internal nodes. If a better path is found,
- * it updates ctx->brute_best_*.
+ * brute_force_search_step: in BRUTE_MODE_PERMUTATION, enumerates exactly one new path
+ * in ascending order of path length L in [ctx->min_hops..ctx->max_hops], considering
+ * permutations and combinations of candidate internal nodes. In BRUTE_MODE_BRANCH_BOUND
+ * and BRUTE_MODE_PARALLEL, runs brute_force_search_budget with the budgets stored in
+ * ctx->brute_state.
+ * If a better path is found, it updates ctx->brute_best_*.
  *
  * The best path found so far (if any) is immediately copied into:
  * out_nodes, out_path_len, out_total_latency.
  *
- * Returns 0 on success, ERR_NO_PATH_FOUND if no valid path exists,
- * or a negative error code on other errors.
+ * Returns 0 on success, ERR_NO_PATH_FOUND if no valid path exists, ERR_ARRAY_TOO_SMALL
+ * if the best path does not fit max_size, or a negative error code on other errors.
  */
 int brute_force_search_step(
     AntNetContext* ctx,
@@ -32,11 +34,55 @@ int brute_force_search_step(
     int* out_total_latency
 );
 
+/*
+ * brute_force_search_budget: advances the enumeration until max_candidates candidates
+ * were visited or time_budget_us elapsed (<= 0 disables either limit; with both
+ * disabled, BRUTE_DEFAULT_STEP_CANDIDATES applies), or until it is done.
+ *
+ * In branch-and-bound mode a candidate is one node of the combination tree: orderings
+ * are skipped since latency does not depend on them, and a subtree is cut as soon as its
+ * partial latency plus the smallest remaining delays cannot beat the incumbent. Once
+ * ctx->brute_state.done is set, bb_best is the proven optimum of the current topology.
+ * BRUTE_MODE_PARALLEL spreads each batch over the rank ranges of the current length
+ * (see cpu_brute_force_parallel.h); the budget is shared between the ranges.
+ *
+ * Outputs and return codes as brute_force_search_step.
+ */
+int brute_force_search_budget(
+    AntNetContext* ctx,
+    int start_id,
+    int end_id,
+    int* out_nodes,
+    int max_size,
+    int* out_path_len,
+    int* out_total_latency,
+    int max_candidates,
+    int time_budget_us
+);
+
+/*
+ * brute_force_clock_us: monotonic microseconds where available, processor time otherwise.
+ * The time base of the brute-force budgets.
+ */
+long long brute_force_clock_us(void);
+
 /*
  * brute_force_reset_state: restarts the enumeration from scratch (min_hops),
  * resetting permutation and combination states but preserving the best path
- * found so far. Should be called if the topology changes.
+ * found so far. Keeps the mode and budgets. Should be called if the topology changes.
  */
 void brute_force_reset_state(AntNetContext* ctx);
 
+/*
+ * brute_force_reserve: sizes the BruteForceState buffers for num_nodes nodes and the
+ * context's max_hops. Reallocates only when a size changes, in which case the caller
+ * resets the enumeration. Returns ERR_MEMORY_ALLOCATION with the old buffers intact.
+ */
+int brute_force_reserve(AntNetContext* ctx, int num_nodes);
+
+/*
+ * brute_force_free_buffers: releases the buffers of brute_force_reserve.
+ */
+void brute_force_free_buffers(BruteForceState* st);
+
 #endif /* CPU_BRUTE_FORCE_H */
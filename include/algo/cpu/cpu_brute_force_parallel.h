@@ -0,0 +1,49 @@
+/* Relative Path: include/algo/cpu/cpu_brute_force_parallel.h */
+/*
+ * Declares the parallel branch-and-bound brute force: the combinations of each length are
+ * numbered in lexicographic order and split into rank ranges, one cursor per range.
+ * Ranges run as tasks on the context's worker pool and merge their local bests in order.
+*/
+
+#ifndef CPU_BRUTE_FORCE_PARALLEL_H
+#define CPU_BRUTE_FORCE_PARALLEL_H
+
+#include "../../rendering/heatmap_renderer_api.h"  /* for AntNetContext */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * brute_parallel_step
+ * Runs one batch over the ranges of ctx->brute_state.current_L, splitting the length
+ * first if needed: every range visits up to max_candidates / ranges candidates (0 = no
+ * limit) or stops at deadline_us (brute_force_clock_us time, 0 = none). Range bests
+ * are merged into ctx->brute_best_*; a length whose ranges are all exhausted moves on.
+ * *out_visited receives the candidates visited.
+ *
+ * Returns 1 after a batch, 0 if C(candidate_count, current_L) is too large to rank
+ * (the caller then uses the sequential cursor for this length), or a negative error.
+ */
+int brute_parallel_step(AntNetContext* ctx, int start_id, int end_id, int max_size,
+                        int max_candidates, long long deadline_us, int* out_visited);
+
+/*
+ * brute_parallel_split
+ * Resets the cursors of length L: its C(candidate_count, L) ranks are divided into up
+ * to BRUTE_PARALLEL_RANGES equal ranges. Returns 0 (with par_ranges = 0) if the length
+ * is too large to rank, 1 otherwise.
+ */
+int brute_parallel_split(AntNetContext* ctx, int L);
+
+/*
+ * brute_parallel_signature
+ * Hash of the sorted candidate list, the delays and the hop range of ctx.
+ */
+uint64_t brute_parallel_signature(const AntNetContext* ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CPU_BRUTE_FORCE_PARALLEL_H */
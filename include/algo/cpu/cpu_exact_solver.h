@@ -0,0 +1,51 @@
+/* Relative Path: include/algo/cpu/cpu_exact_solver.h */
+/*
+ * Exact minimum-latency 0 -> 1 route with min_hops..max_hops intermediate nodes.
+ * Subset mode picks the cheapest nodes directly; edge mode searches simple paths by branch
+ * and bound, pruned by a layered walk DP over the edge list. Gives the reference optimum
+ * the heuristics are ranked against.
+*/
+
+#ifndef CPU_EXACT_SOLVER_H
+#define CPU_EXACT_SOLVER_H
+
+#include "../../rendering/heatmap_renderer_api.h"  /* for AntNetContext */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * exact_solver_mode: EXACT_MODE_EDGES when the ACO walks edges, EXACT_MODE_SUBSET otherwise,
+ * so the reference matches the problem the ants solve.
+ */
+int exact_solver_mode(const AntNetContext* ctx);
+
+/*
+ * exact_solver_search: solves the current topology unless the cached solve in
+ * ctx->exact_state still matches it, then stores the result in ctx->exact_best_* and
+ * copies it to out_nodes, out_path_len, out_total_latency.
+ *
+ * Path cost is the sum of delay_ms over every node, 0 and 1 included. Disabled nodes are
+ * skipped. In edge mode the search visits each node at most once per route; the walk DP
+ * that prunes it also gives ctx->exact_state.lower_bound, the cheapest walk in the hop
+ * range, which is below the latency when that walk repeats a node.
+ *
+ * Returns 0 on success, ERR_NO_PATH_FOUND if no simple route exists in the hop range,
+ * or a negative error code on other errors.
+ */
+int exact_solver_search(
+    AntNetContext* ctx,
+    int start_id,
+    int end_id,
+    int* out_nodes,
+    int max_size,
+    int* out_path_len,
+    int* out_total_latency
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CPU_EXACT_SOLVER_H */
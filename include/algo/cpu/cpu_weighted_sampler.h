@@ -0,0 +1,67 @@
+/* Relative Path: include/algo/cpu/cpu_weighted_sampler.h */
+/*
+ * Declares a Fenwick-tree sampler for weighted draws without replacement.
+ * Each draw and each removal costs O(log n) instead of a linear cumulative scan.
+ * Shared by the ACO ant builders; any solver picking weighted candidates can reuse it.
+*/
+
+#ifndef CPU_WEIGHTED_SAMPLER_H
+#define CPU_WEIGHTED_SAMPLER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * WeightedSampler
+ * tree is 1-based (tree[0] unused): tree[i] holds the weight sum of items
+ * (i - lowbit(i), i]. weights keeps each item's current weight, 0 once removed.
+ */
+typedef struct WeightedSampler
+{
+    double* tree;
+    double* weights;
+    int     count;     /* items in the current build */
+    int     capacity;  /* allocated items */
+    int     top_step;  /* highest power of two <= count, start of the descent */
+    double  total;     /* sum of the remaining weights */
+} WeightedSampler;
+
+/*
+ * weighted_sampler_init
+ * Allocates room for 'capacity' items. Returns 0 on success, negative on error.
+ */
+int weighted_sampler_init(WeightedSampler* sampler, int capacity);
+
+/*
+ * weighted_sampler_free
+ * Releases the sampler buffers. The struct itself belongs to the caller.
+ */
+void weighted_sampler_free(WeightedSampler* sampler);
+
+/*
+ * weighted_sampler_build
+ * Loads count weights (count <= capacity) in O(n). Negative weights count as 0.
+ * 'weights' may be sampler->weights itself, filled in place by the caller.
+ * Returns 0 on success, negative on error.
+ */
+int weighted_sampler_build(WeightedSampler* sampler, const double* weights, int count);
+
+/*
+ * weighted_sampler_draw
+ * Picks an item with probability weight/total, u being uniform in [0, 1).
+ * Returns its index, or -1 if every weight is 0. The item stays in the sampler.
+ */
+int weighted_sampler_draw(const WeightedSampler* sampler, float u);
+
+/*
+ * weighted_sampler_remove
+ * Sets the weight of item 'index' to 0 so later draws skip it.
+ */
+void weighted_sampler_remove(WeightedSampler* sampler, int index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CPU_WEIGHTED_SAMPLER_H */
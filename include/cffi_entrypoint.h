@@ -35,6 +35,7 @@ extern "C" {
 #include "./consts/error_codes.h"
 #include "./types/antnet_sasa_types.h"
 #include "./types/antnet_ranking_types.h"
+#include "./types/antnet_rng_types.h"
 
 
 /* 3) The main backend headers that declare the functions Python needs */
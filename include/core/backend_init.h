@@ -1,8 +1,8 @@
 /* Relative Path: include/core/backend_init.h */
 /*
  * Declares internal functions for creating, retrieving, and shutting down AntNet contexts.
- * Provides priv_get_context_by_id for safely accessing a context by index.
- * Used as the backbone for managing global context arrays and concurrency.
+ * Provides priv_get_context_by_id for safely accessing a context by handle.
+ * Used as the backbone for managing the global context registry and concurrency.
 */
 
 
@@ -17,10 +17,60 @@ extern "C" {
 
 /*
  * get_context_by_id
- * Retrieves the pointer to the context if in range and in use, else returns NULL.
+ * Retrieves the pointer to the context if the handle is live, else returns NULL.
+ * Lock free. The calling thread pins the context until its next lookup of another
+ * one, so a concurrent pub_shutdown never hands the memory to a new context under it.
  */
 AntNetContext* priv_get_context_by_id(int context_id);
 
+/*
+ * priv_get_context_id
+ * Returns the id of ctx, for log lines written where only the pointer is at hand.
+ */
+int priv_get_context_id(const AntNetContext* ctx);
+
+/*
+ * priv_get_worker_pool
+ * Returns the context's worker pool, creating it on first use or rebuilding it
+ * if ctx->worker_threads changed. Intended for the thread that runs the solvers.
+ * Returns NULL if the pool cannot be created.
+ */
+WorkerPool* priv_get_worker_pool(AntNetContext* ctx);
+
+/* Threads of the solver pool: one per solver of pub_run_all_solvers. */
+#define ANTNET_SOLVER_POOL_THREADS 4
+
+/*
+ * priv_get_solver_pool
+ * Returns the pool pub_run_all_solvers runs its solvers on, creating it on first use.
+ * The caller holds ctx->run_lock. Returns NULL if the pool cannot be created.
+ */
+WorkerPool* priv_get_solver_pool(AntNetContext* ctx);
+
+/*
+ * priv_lock_solvers / priv_unlock_solvers
+ * Take (release) aco_lock, random_lock, brute_lock and exact_lock in order. Callers
+ * take them before ctx->lock, never while holding it.
+ */
+void priv_lock_solvers(AntNetContext* ctx);
+void priv_unlock_solvers(AntNetContext* ctx);
+
+/*
+ * priv_seed_context
+ * Stores seed (0 = clock-based) as ctx->rng_seed and derives the random, ACO and
+ * hop map streams from it. The caller holds ctx->lock.
+ */
+void priv_seed_context(AntNetContext* ctx, uint64_t seed);
+
+/*
+ * priv_reserve_solver_buffers
+ * Sizes the four *_best_nodes buffers to min(max_hops + 2, num_nodes) entries, keeping
+ * stored paths that still fit, and the brute force buffers to num_nodes. Called before
+ * a topology of num_nodes nodes is installed, with every solver lock and ctx->lock held.
+ * Returns ERR_MEMORY_ALLOCATION with the previous buffers intact.
+ */
+int priv_reserve_solver_buffers(AntNetContext* ctx, int num_nodes);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,67 @@
+/* Relative Path: include/core/backend_log.h */
+/*
+ * Declares the backend log: each thread formats into its own fixed-size ring without
+ * locks, pub_drain_logs merges the rings in sequence order. A full ring drops messages
+ * instead of blocking, so solver threads never wait on stdout or on a reader.
+*/
+
+#ifndef BACKEND_LOG_H
+#define BACKEND_LOG_H
+
+#include "../types/antnet_log_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Entries per thread ring (a power of two) and rings reused across thread lifetimes. */
+#define ANTNET_LOG_RING_SLOTS 256
+#define ANTNET_LOG_MAX_RINGS  64
+
+/*
+ * Levels above ANTNET_LOG_COMPILE_LEVEL compile to dead code: arguments are still
+ * type-checked but never evaluated, and no call is emitted.
+ * Build with -DANTNET_LOG_COMPILE_LEVEL=ANTNET_LOG_DEBUG to keep debug lines.
+ */
+#ifndef ANTNET_LOG_COMPILE_LEVEL
+#define ANTNET_LOG_COMPILE_LEVEL ANTNET_LOG_INFO
+#endif
+
+/*
+ * antnet_log_write
+ * Formats one message into the calling thread's ring. Messages above the runtime level
+ * (pub_set_log_level) are skipped; a full ring counts the message as dropped.
+ */
+#if defined(__GNUC__)
+__attribute__((format(printf, 3, 4)))
+#endif
+void antnet_log_write(int level, int context_id, const char* fmt, ...);
+
+#define ANTNET_LOG_STRIPPED(level, context_id, ...) \
+    do { if (0) antnet_log_write((level), (context_id), __VA_ARGS__); } while (0)
+
+#define ANTNET_LOGE(context_id, ...) antnet_log_write(ANTNET_LOG_ERROR, (context_id), __VA_ARGS__)
+
+#if ANTNET_LOG_COMPILE_LEVEL >= ANTNET_LOG_WARN
+#define ANTNET_LOGW(context_id, ...) antnet_log_write(ANTNET_LOG_WARN, (context_id), __VA_ARGS__)
+#else
+#define ANTNET_LOGW(context_id, ...) ANTNET_LOG_STRIPPED(ANTNET_LOG_WARN, context_id, __VA_ARGS__)
+#endif
+
+#if ANTNET_LOG_COMPILE_LEVEL >= ANTNET_LOG_INFO
+#define ANTNET_LOGI(context_id, ...) antnet_log_write(ANTNET_LOG_INFO, (context_id), __VA_ARGS__)
+#else
+#define ANTNET_LOGI(context_id, ...) ANTNET_LOG_STRIPPED(ANTNET_LOG_INFO, context_id, __VA_ARGS__)
+#endif
+
+#if ANTNET_LOG_COMPILE_LEVEL >= ANTNET_LOG_DEBUG
+#define ANTNET_LOGD(context_id, ...) antnet_log_write(ANTNET_LOG_DEBUG, (context_id), __VA_ARGS__)
+#else
+#define ANTNET_LOGD(context_id, ...) ANTNET_LOG_STRIPPED(ANTNET_LOG_DEBUG, context_id, __VA_ARGS__)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BACKEND_LOG_H */
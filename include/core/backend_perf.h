@@ -0,0 +1,41 @@
+/* Relative Path: include/core/backend_perf.h */
+/*
+ * Declares the phase timers behind pub_get_perf_counters. Samples are added to the
+ * context's counters with relaxed atomics, so any solver thread can record without a lock.
+*/
+
+#ifndef BACKEND_PERF_H
+#define BACKEND_PERF_H
+
+#include "../rendering/heatmap_renderer_api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * antnet_perf_now_ns
+ * Monotonic clock in nanoseconds, the start mark passed to antnet_perf_record.
+ */
+uint64_t antnet_perf_now_ns(void);
+
+/*
+ * antnet_perf_record
+ * Adds the time elapsed since start_ns to phase of ctx.
+ */
+void antnet_perf_record(AntNetContext* ctx, int phase, uint64_t start_ns);
+
+/*
+ * antnet_perf_lock_context
+ * Takes ctx->lock, timing the wait into ANTNET_PERF_LOCK_WAIT. An uncontended lock
+ * costs one trylock and no clock read. Only available with pthreads.
+ */
+#ifndef _WIN32
+void antnet_perf_lock_context(AntNetContext* ctx);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BACKEND_PERF_H */
@@ -0,0 +1,87 @@
+/* Relative Path: include/core/backend_results.h */
+/*
+ * Declares the results store: context-owned regions holding the pheromone matrix, node
+ * strengths and best paths, rewritten in place under a sequence lock after solver calls.
+ * Readers pin a region, so it is never reallocated while they wrap it.
+*/
+
+#ifndef BACKEND_RESULTS_H
+#define BACKEND_RESULTS_H
+
+#include <stdint.h>
+#include "../types/antnet_aco_v1_types.h"
+#include "../types/antnet_results_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Regions per context: the published one and one to switch to when the layout changes. */
+#define RESULTS_REGION_SLOTS 2
+
+/*
+ * ResultsStore: opaque handle, private to backend_results.c.
+ * Stored in AntNetContext as results.
+ */
+typedef struct ResultsStore ResultsStore;
+
+/* One best path as the solver stores it. */
+typedef struct ResultsPath
+{
+    const int* nodes;
+    int        length;
+    int        latency;
+} ResultsPath;
+
+/*
+ * results_store_create / results_store_destroy
+ * No region is allocated until the first publish. destroy frees the store at once when
+ * no region is pinned, otherwise with the last release.
+ */
+ResultsStore* results_store_create(void);
+void results_store_destroy(ResultsStore* store);
+
+/*
+ * results_store_retire
+ * Called by pub_shutdown once the handle is gone: pub_results_release then finds the
+ * store by region, without the handle. Publishing and acquiring still work until destroy.
+ */
+void results_store_retire(ResultsStore* store);
+
+/*
+ * results_store_active
+ * Non-zero once a reader acquired a region. Until then solver calls skip publishing.
+ */
+int results_store_active(const ResultsStore* store);
+
+/*
+ * results_store_has_region
+ * Non-zero once a region was published, i.e. acquire no longer returns ERR_NO_TOPOLOGY.
+ */
+int results_store_has_region(const ResultsStore* store);
+
+/*
+ * results_store_publish
+ * Rewrites the published region under its sequence lock. A new pheromone dimension or
+ * path capacity moves to a region nobody pins; if both are pinned nothing is published.
+ * Caller holds ctx->run_lock, the solver locks and ctx->lock, so nothing it reads changes.
+ * Returns 0 or ERR_MEMORY_ALLOCATION.
+ */
+int results_store_publish(ResultsStore* store, const AcoV1State* aco, int path_capacity,
+                          const ResultsPath paths[ANTNET_RESULTS_PATHS], uint64_t iteration);
+
+/*
+ * results_store_acquire / results_store_release
+ * Lock-free. acquire pins the published region and returns its header and size in bytes,
+ * or ERR_NO_TOPOLOGY before the first publish. release unpins the region at header;
+ * ERR_INVALID_ARGS if header is not a region of this store.
+ */
+int results_store_acquire(ResultsStore* store, AntNetResultsHeader** out_region,
+                          uint64_t* out_bytes);
+int results_store_release(ResultsStore* store, const AntNetResultsHeader* region);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BACKEND_RESULTS_H */
@@ -0,0 +1,58 @@
+/* Relative Path: include/core/backend_rng.h */
+/*
+ * Declares the seedable pseudo-random generator shared by all solvers (xoshiro256**).
+ * Replaces libc rand(), whose hidden global state serializes ant threads and prevents replay.
+ * Streams are derived from one context seed, so a run is reproducible from (seed, thread count).
+*/
+
+#ifndef BACKEND_RNG_H
+#define BACKEND_RNG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "../types/antnet_rng_types.h"
+
+/* Stream identifiers derived from the context seed, one per consumer. */
+#define ANTNET_RNG_STREAM_RANDOM   1
+#define ANTNET_RNG_STREAM_ACO      2
+#define ANTNET_RNG_STREAM_HOP_MAP  3
+
+/*
+ * antnet_rng_seed_stream
+ * Initializes rng from (seed, stream) through splitmix64. Distinct streams of the
+ * same seed are statistically independent, the same pair always yields the same sequence.
+ */
+void antnet_rng_seed_stream(AntNetRng* rng, uint64_t seed, uint64_t stream);
+
+/*
+ * antnet_rng_time_seed
+ * Returns a non-zero seed built from the wall clock, used when no seed is configured.
+ */
+uint64_t antnet_rng_time_seed(void);
+
+/*
+ * antnet_rng_next_u64
+ * Returns the next 64 random bits and advances the stream.
+ */
+uint64_t antnet_rng_next_u64(AntNetRng* rng);
+
+/*
+ * antnet_rng_next_int
+ * Returns a uniform integer in [0..bound-1] without modulo bias. bound <= 0 returns 0.
+ */
+int antnet_rng_next_int(AntNetRng* rng, int bound);
+
+/*
+ * antnet_rng_next_float
+ * Returns a uniform float in [0, 1).
+ */
+float antnet_rng_next_float(AntNetRng* rng);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BACKEND_RNG_H */
@@ -0,0 +1,69 @@
+/* Relative Path: include/core/backend_snapshot.h */
+/*
+ * Declares versioned pheromone snapshots, published by the solver after each iteration and
+ * read without ctx->lock. Readers pin a slot, writers only reuse slots nobody pins, so a
+ * copy never races with a merge and a merge never waits for a copy.
+*/
+
+#ifndef BACKEND_SNAPSHOT_H
+#define BACKEND_SNAPSHOT_H
+
+#include <stdint.h>
+#include "../types/antnet_aco_v1_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Slots per context: the published one, one a slow reader may still pin, one to write. */
+#define PHEROMONE_SNAPSHOT_SLOTS 3
+
+/*
+ * PheromoneSnapshots: opaque handle, private to backend_snapshot.c.
+ * Stored in AntNetContext as pheromone_snapshots.
+ */
+typedef struct PheromoneSnapshots PheromoneSnapshots;
+
+/*
+ * pheromone_snapshots_create / pheromone_snapshots_destroy
+ * No slot is allocated until the first publish. destroy must not race with readers.
+ */
+PheromoneSnapshots* pheromone_snapshots_create(void);
+void pheromone_snapshots_destroy(PheromoneSnapshots* snaps);
+
+/*
+ * pheromone_snapshots_active
+ * Non-zero once a reader asked for a snapshot. Until then solvers skip publishing.
+ */
+int pheromone_snapshots_active(const PheromoneSnapshots* snaps);
+
+/*
+ * pheromone_snapshots_publish
+ * Exports the current matrix of state into a free slot and makes it the published one
+ * with the next version. If every other slot is pinned, nothing is published and the
+ * previous snapshot stays current. Caller holds ctx->lock, which serializes writers.
+ * Returns 0, ERR_NO_TOPOLOGY or ERR_MEMORY_ALLOCATION.
+ */
+int pheromone_snapshots_publish(PheromoneSnapshots* snaps, const AcoV1State* state);
+
+/*
+ * pheromone_snapshots_invalidate
+ * Withdraws the published snapshot, e.g. after a topology change. Caller holds ctx->lock.
+ */
+void pheromone_snapshots_invalidate(PheromoneSnapshots* snaps);
+
+/*
+ * pheromone_snapshots_read
+ * Lock-free. Copies the published matrix into out and stores its version in out_version.
+ * Returns n*n, 0 if the published version equals known_version (nothing copied),
+ * ERR_NO_TOPOLOGY if nothing is published, or ERR_ARRAY_TOO_SMALL. With out NULL it
+ * only returns n*n.
+ */
+int pheromone_snapshots_read(PheromoneSnapshots* snaps, float* out, int max_count,
+                             uint64_t known_version, uint64_t* out_version);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BACKEND_SNAPSHOT_H */
@@ -0,0 +1,66 @@
+/* Relative Path: include/core/backend_solver_loop.h */
+/*
+ * Declares the solver loop: a native thread per context running solver iterations back
+ * to back and signalling a file descriptor on improvements and at a progress interval.
+*/
+
+#ifndef BACKEND_SOLVER_LOOP_H
+#define BACKEND_SOLVER_LOOP_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct AntNetContext;
+
+/*
+ * SolverLoop: opaque handle, private to backend_solver_loop.c.
+ * Stored in AntNetContext as solver_loop.
+ */
+typedef struct SolverLoop SolverLoop;
+
+/*
+ * solver_loop_create / solver_loop_destroy
+ * create starts nothing and opens no descriptor. destroy expects solver_loop_close
+ * to have run, as pub_shutdown does.
+ */
+SolverLoop* solver_loop_create(void);
+void solver_loop_destroy(SolverLoop* loop);
+
+/*
+ * solver_loop_start
+ * Starts the loop thread on ctx unless it runs already; either way sets the progress
+ * interval and returns the descriptor to watch in *out_fd. The descriptor stays open
+ * across stop and start until solver_loop_close.
+ * Returns ERR_INVALID_CONTEXT once closed, ERR_UNIMPLEMENTED without pthreads.
+ */
+int solver_loop_start(SolverLoop* loop, struct AntNetContext* ctx, int progress_interval_ms,
+                      int* out_fd);
+
+/*
+ * solver_loop_stop
+ * Stops the thread and waits for its iteration in progress. No-op when not running.
+ */
+int solver_loop_stop(SolverLoop* loop);
+
+/*
+ * solver_loop_close
+ * Stops the loop for good and closes its descriptor. Called by pub_shutdown before it
+ * takes the context locks, since the loop thread takes them too.
+ */
+void solver_loop_close(SolverLoop* loop);
+
+/*
+ * solver_loop_status
+ * Lock-free. Any output may be NULL.
+ */
+void solver_loop_status(const SolverLoop* loop, int* out_running, uint64_t* out_iterations,
+                        uint64_t* out_improvements);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BACKEND_SOLVER_LOOP_H */
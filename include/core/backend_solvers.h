@@ -16,6 +16,16 @@ extern "C" {
 #include "backend_init.h" /* ensures priv_get_context_by_id is visible */
 #include "../rendering/heatmap_renderer_api.h"      /* public API definitions */
 
+/*
+ * priv_run_solvers_step
+ * One pub_run_all_solvers iteration for the solver loop, writing the ACO, Random and
+ * Brute paths to three rows of capacity ints in scratch. *out_improved is set when any
+ * solver found a better path. The results region is refreshed only when publish is set,
+ * a solver improved, or no region was published yet. Takes ctx->run_lock itself.
+ */
+int priv_run_solvers_step(AntNetContext* ctx, int* scratch, int capacity, int publish,
+                          int* out_improved);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,6 +1,6 @@
 /* Relative Path: include/core/backend_topology.h */
 /*
- * Declares pub_update_topology for modifying graph structures in a context.
+ * Declares pub_update_topology and the incremental topology calls for a context.
  * Includes node and edge definitions, either inline for CFFI or via standard headers.
  * Central point for injecting new or modified network data into AntNet.
 */
@@ -55,6 +55,24 @@ int pub_update_topology(
     int num_edges
 );
 
+/*
+ * Incremental updates: unlike pub_update_topology they keep the learned ACO pheromones,
+ * growing the matrices when nodes are added. Node ids are indices into the node array.
+ * Each returns 0 on success, negative on error.
+ *
+ * pub_set_node_delay: sets the delay of node_id (delay_ms >= 0).
+ * pub_add_edge / pub_remove_edge: adds or removes the undirected edge from_id - to_id.
+ *   Both are no-ops when the edge already exists / does not exist.
+ * pub_disable_node: disabled != 0 takes node_id out of every solver, 0 brings it back
+ *   with its edges. Nodes 0 and 1 cannot be disabled.
+ * pub_add_nodes: appends count nodes whose ids must be num_nodes .. num_nodes+count-1.
+ */
+int pub_set_node_delay(int context_id, int node_id, int delay_ms);
+int pub_add_edge(int context_id, int from_id, int to_id);
+int pub_remove_edge(int context_id, int from_id, int to_id);
+int pub_disable_node(int context_id, int node_id, int disabled);
+int pub_add_nodes(int context_id, const NodeData* nodes, int count);
+
 #ifdef __cplusplus
 }
 #endif
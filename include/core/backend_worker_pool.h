@@ -0,0 +1,71 @@
+/* Relative Path: include/core/backend_worker_pool.h */
+/*
+ * Declares a persistent worker pool, sized to the core count, owned by one AntNet context.
+ * Threads are created once and parked on a condition variable between batches of indexed tasks.
+ * Replaces the former pthread_create/pthread_join per ant and per iteration.
+*/
+
+#ifndef BACKEND_WORKER_POOL_H
+#define BACKEND_WORKER_POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Upper bound on the number of threads a pool may hold, including the caller. */
+#define WORKER_POOL_MAX_THREADS 64
+
+/*
+ * WorkerPool: opaque handle, the structure is private to backend_worker_pool.c.
+ * Stored in AntNetContext as worker_pool.
+ */
+typedef struct WorkerPool WorkerPool;
+
+/*
+ * worker_pool_task_fn
+ * One unit of work. task_index runs over [0..task_count-1] of the current batch.
+ * Tasks of the same batch may run concurrently and in any order.
+ */
+typedef void (*worker_pool_task_fn)(void* arg, int task_index);
+
+/*
+ * worker_pool_default_thread_count
+ * Returns the number of online cores, clamped to [1..WORKER_POOL_MAX_THREADS].
+ */
+int worker_pool_default_thread_count(void);
+
+/*
+ * worker_pool_create
+ * Creates a pool able to run nb_threads tasks at once. The calling thread of
+ * worker_pool_run counts as one of them, so nb_threads-1 threads are spawned.
+ * nb_threads <= 0 selects worker_pool_default_thread_count().
+ * Returns NULL on allocation or thread creation failure.
+ */
+WorkerPool* worker_pool_create(int nb_threads);
+
+/*
+ * worker_pool_destroy
+ * Wakes and joins every worker, then frees the pool. Must not be called
+ * while a batch is running. NULL is accepted and ignored.
+ */
+void worker_pool_destroy(WorkerPool* pool);
+
+/*
+ * worker_pool_size
+ * Returns the number of tasks the pool runs concurrently (workers + caller).
+ */
+int worker_pool_size(const WorkerPool* pool);
+
+/*
+ * worker_pool_run
+ * Runs fn(arg, i) for every i in [0..task_count-1] and blocks until all are done.
+ * The caller takes part in the batch. Concurrent callers are serialized.
+ * Returns 0 (ERR_SUCCESS) on success or ERR_INVALID_ARGS.
+ */
+int worker_pool_run(WorkerPool* pool, int task_count, worker_pool_task_fn fn, void* arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BACKEND_WORKER_POOL_H */
@@ -0,0 +1,48 @@
+/* Relative Path: include/managers/cpu_exact_algo_manager.h */
+/*
+ * Acts as a manager for the exact minimum-latency solver in AntNet.
+ * Provides calls for initialization, running (a cached solve per topology), and cleanup.
+ * Supplies the reference optimum the heuristic solvers are measured against.
+*/
+
+#ifndef CPU_EXACT_ALGO_MANAGER_H
+#define CPU_EXACT_ALGO_MANAGER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "../rendering/heatmap_renderer_api.h"
+
+/* exact_algo_manager_init
+ * Initializes the exact solver (if needed).
+ * Returns 0 (ERR_SUCCESS) on success or negative error code on failure.
+ */
+int exact_algo_manager_init(AntNetContext* ctx);
+
+/* exact_algo_manager_run
+ * Returns the exact optimum for start_node -> end_node, solving only after a topology,
+ * hop range or mode change. Stores results in out_nodes, out_length, out_latency.
+ * Returns 0 (ERR_SUCCESS), ERR_NO_PATH_FOUND, or negative error code on failure.
+ */
+int exact_algo_manager_run(
+    AntNetContext* ctx,
+    int start_node,
+    int end_node,
+    int* out_nodes,
+    int max_size,
+    int* out_length,
+    int* out_latency
+);
+
+/* exact_algo_manager_cleanup
+ * Cleans up any allocated resources for the exact solver (if needed).
+ * Returns 0 (ERR_SUCCESS) on success or negative error code on failure.
+ */
+int exact_algo_manager_cleanup(AntNetContext* ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CPU_EXACT_ALGO_MANAGER_H */
@@ -15,6 +15,7 @@
 #endif
 
 #include "../types/antnet_network_types.h"  /* NodeData, EdgeData */
+#include "../types/antnet_rng_types.h"      /* AntNetRng */
 
 #ifdef __cplusplus
 extern "C" {
@@ -41,6 +42,9 @@ typedef struct {
     int default_min_delay;
     int default_max_delay;
 
+    /* private generator for node delays, see hop_map_manager_set_seed */
+    AntNetRng rng;
+
 } HopMapManager;
 
 /* Creates a new HopMapManager instance */
@@ -52,6 +56,9 @@ void hop_map_manager_destroy(HopMapManager *mgr);
 /* Allows setting the random delay range for node latencies. */
 void hop_map_manager_set_delay_range(HopMapManager *mgr, int min_delay, int max_delay);
 
+/* Reseeds the delay generator so a generated map can be replayed from a seed. */
+void hop_map_manager_set_seed(HopMapManager *mgr, uint64_t seed);
+
 /* Initializes the map with total_nodes (start node + end node + hop_count).
  * If total_nodes is unchanged, it skips reallocation. */
 void hop_map_manager_initialize_map(HopMapManager *mgr, int total_nodes);
@@ -59,6 +66,14 @@ void hop_map_manager_initialize_map(HopMapManager *mgr, int total_nodes);
 /* Creates default edges for up to 3 nearest hops, modifies mgr->edges */
 void hop_map_manager_create_default_edges(HopMapManager *mgr);
 
+/*
+ * hop_map_manager_add_grid_edges
+ * Appends edges following the hop grid, so a path has choices everywhere: each hop
+ * links to its right and lower neighbours, start feeds the first column and the last
+ * column feeds the end. Keeps the existing edges. Used by headless runs and benchmarks.
+ */
+void hop_map_manager_add_grid_edges(HopMapManager *mgr);
+
 /*
  * hop_map_manager_export_topology:
  * Exports the topology. The caller provides pointers. The function copies data out.
@@ -15,9 +15,17 @@
 #include "../consts/error_codes.h"
 #include "../core/backend_thread_defs.h"
 #include "../types/antnet_aco_v1_types.h"
+#include "../types/antnet_exact_types.h"
 #include "../rendering/heatmap_renderer.h"
 #include "../rendering/heatmap_renderer_async.h"
 #include "../managers/hop_map_manager.h"
+#include "../core/backend_worker_pool.h"
+#include "../core/backend_snapshot.h"
+#include "../core/backend_results.h"
+#include "../core/backend_solver_loop.h"
+#include "../types/antnet_rng_types.h"
+#include "../types/antnet_log_types.h"
+#include "../types/antnet_perf_types.h"
 
 /* NEW: include RankingEntry definition */
 #include "../types/antnet_ranking_types.h"
@@ -50,11 +58,23 @@ typedef struct AntNetContext
     int       num_edges;
     int       iteration;
 
-    /* thread safety */
+    /* num_nodes flags set by pub_disable_node, NULL while every node is enabled */
+    unsigned char *node_disabled;
+    unsigned int   topology_version; /* bumped by every topology change */
+
+    /* entries of each *_best_nodes buffer, min(max_hops + 2, num_nodes); 0 before a topology */
+    int path_capacity;
+
+    /* thread safety: run_lock, then the solver locks in this order, then lock */
     pthread_mutex_t lock;
+    pthread_mutex_t run_lock;    /* one pub_run_all_solvers at a time */
+    pthread_mutex_t aco_lock;    /* held while the ACO solver runs */
+    pthread_mutex_t random_lock; /* held while the random solver runs */
+    pthread_mutex_t brute_lock;  /* held while the brute force solver runs */
+    pthread_mutex_t exact_lock;  /* held while the exact solver runs */
 
     /* random solver best path */
-    int  random_best_nodes[1024];
+    int *random_best_nodes;
     int  random_best_length;
     int  random_best_latency;
 
@@ -62,21 +82,28 @@ typedef struct AntNetContext
     AppConfig config;
 
     /* brute force solver best path */
-    int  brute_best_nodes[1024];
+    int *brute_best_nodes;
     int  brute_best_length;
     int  brute_best_latency;
     BruteForceState brute_state; /* internal brute force state */
 
     /* aco solver best path */
-    int  aco_best_nodes[1024];
+    int *aco_best_nodes;
     int  aco_best_length;
     int  aco_best_latency;
     AcoV1State aco_v1; /* internal ACO v1 solver state */
 
+    /* exact solver optimum, recomputed when the topology changes */
+    int *exact_best_nodes;
+    int  exact_best_length;
+    int  exact_best_latency;
+    ExactSolverState exact_state;
+
     /* SASA addition: store the incremental scoring state for each solver */
     SasaState aco_sasa;
     SasaState random_sasa;
     SasaState brute_sasa;
+    SasaState exact_sasa;
 
     /* NEW: store SASA coefficients used in run_all_solvers, etc. */
     SasaCoeffs sasa_coeffs;
@@ -84,8 +111,36 @@ typedef struct AntNetContext
     /* NEW: pointer to the HopMapManager for node/edge arrangement. */
     HopMapManager *hop_map_mgr; /* Manages hop-based node layout inside this context */
 
+    /* Persistent worker pool for multi-ant iterations, created on first use. */
+    WorkerPool *worker_pool;
+    int         worker_threads; /* requested pool size, 0 = one thread per core */
+
+    /* Pool running the solvers of pub_run_all_solvers side by side, created on first use. */
+    WorkerPool *solver_pool;
+
+    /* Versioned pheromone copies for lock-free readers, published after each iteration. */
+    PheromoneSnapshots *pheromone_snapshots;
+
+    /* Zero-copy results region, refreshed by solver calls once a reader asked for it. */
+    ResultsStore *results;
+
+    /* Native thread running solver iterations until stopped, see pub_solver_loop_start. */
+    SolverLoop *solver_loop;
+
+    /* Seeded generators replacing rand(); ants derive their own streams from aco_rng. */
+    uint64_t  rng_seed;   /* effective seed, never 0 */
+    AntNetRng random_rng;
+    AntNetRng aco_rng;
+
+    /* Phase timings, updated with atomics by any solver thread (see backend_perf.h). */
+    AntNetPerfCounters perf;
+
 } AntNetContext;
 
+/* Non-zero unless pub_disable_node took node_id out of every solver. */
+#define ANTNET_NODE_ENABLED(ctx, node_id) \
+    (!(ctx)->node_disabled || !(ctx)->node_disabled[(node_id)])
+
 /* public API */
 
 int pub_initialize(int node_count, int min_hops, int max_hops);
@@ -119,6 +174,52 @@ int pub_run_all_solvers(
     int *out_latency_brute
 );
 
+/* Columns of a pub_run_solvers_batch trace row: ACO, Random, Brute best latency. */
+#define ANTNET_BATCH_TRACE_WIDTH     3
+
+/* Why pub_run_solvers_batch stopped. */
+#define ANTNET_BATCH_STOP_ITERATIONS 0
+#define ANTNET_BATCH_STOP_DEADLINE   1
+#define ANTNET_BATCH_STOP_CONVERGED  2
+
+/*
+ * pub_run_solvers_batch
+ * Runs up to max_iterations pub_run_all_solvers iterations in one call. Stops early once
+ * time_budget_us has elapsed (0 = no deadline) or after stall_iterations iterations in a
+ * row where no solver improved (0 = never). At least one iteration runs.
+ * The output paths are those of the last iteration. out_trace, if trace_rows > 0, gets
+ * ANTNET_BATCH_TRACE_WIDTH best latencies (-1 while a solver has no path) per iteration
+ * for the first trace_rows iterations. out_iterations receives the iteration count and
+ * out_stop_reason (may be NULL) an ANTNET_BATCH_STOP_* value.
+ * Returns the error of a failed iteration, which ends the batch.
+ */
+int pub_run_solvers_batch(
+    int  context_id,
+    int  max_iterations,
+    int  time_budget_us,
+    int  stall_iterations,
+    /* aco */
+    int *out_nodes_aco,
+    int  max_size_aco,
+    int *out_len_aco,
+    int *out_latency_aco,
+    /* random */
+    int *out_nodes_random,
+    int  max_size_random,
+    int *out_len_random,
+    int *out_latency_random,
+    /* brute */
+    int *out_nodes_brute,
+    int  max_size_brute,
+    int *out_len_brute,
+    int *out_latency_brute,
+    /* trace */
+    int *out_trace,
+    int  trace_rows,
+    int *out_iterations,
+    int *out_stop_reason
+);
+
 int pub_init_from_config(const char *config_path);
 
 /*
@@ -130,12 +231,23 @@ int pub_get_config(int context_id, AppConfig* out);
 /*
  * pub_get_pheromone_matrix
  * Thread-safe retrieval of the entire pheromone matrix of size n*n,
- * where n = ctx->aco_v1.pheromone_size.
+ * where n = ctx->aco_v1.pheromone_size, as of the last completed iteration.
  * Writes up to max_count floats into 'out'. Returns the number of floats (n*n)
- * on success, or negative on error.
+ * on success, or negative on error. With out NULL, only returns n*n to size the buffer.
+ * Does not take the solver lock once a snapshot exists.
  */
 int pub_get_pheromone_matrix(int context_id, float* out, int max_count);
 
+/*
+ * pub_get_pheromone_snapshot
+ * Lock-free versioned read of the matrix published after the last iteration. Stores the
+ * snapshot version in out_version (may be NULL) and copies it only if it differs from
+ * known_version: returns n*n after a copy, 0 if unchanged, negative on error.
+ * Pass known_version 0 to always copy, out NULL to only get n*n.
+ */
+int pub_get_pheromone_snapshot(int context_id, float* out, int max_count,
+                               uint64_t known_version, uint64_t* out_version);
+
 /*
  * pub_render_heatmap_rgba
  *
@@ -158,7 +270,8 @@ int pub_renderer_async_shutdown(void);
  * pub_get_algo_ranking
  * Returns the list of algorithms sorted by SASA score in descending order.
  * Writes up to max_count entries in out[]. Returns the actual count of
- * algorithms (e.g., 3) on success. If max_count < 3, returns a negative error.
+ * algorithms (3, or 4 with the exact solver enabled) on success. If max_count
+ * is below that count, returns a negative error.
  */
 int pub_get_algo_ranking(int context_id, RankingEntry* out, int max_count);
 
@@ -195,6 +308,182 @@ int pub_get_aco_params(
     int*  out_num_ants
 );
 
+/*
+ * pub_set_aco_construction_mode
+ * Selects how ants build paths: ACO_CONSTRUCT_SUBSET (pheromone-weighted node subset,
+ * ignores edges) or ACO_CONSTRUCT_EDGE_WALK (walk along existing edges). Thread-safe.
+ */
+int pub_set_aco_construction_mode(int context_id, int mode);
+
+/*
+ * pub_get_aco_construction_mode
+ * Reads the current ACO construction mode. Thread-safe.
+ */
+int pub_get_aco_construction_mode(int context_id, int* out_mode);
+
+/*
+ * pub_set_aco_evaporation_mode
+ * ACO_EVAPORATE_PATH evaporates only deposited edges; ACO_EVAPORATE_GLOBAL sweeps the
+ * whole matrix once per iteration (vectorized, split over the worker pool);
+ * ACO_EVAPORATE_LAZY gives the same decay at O(touched edges) using per-cell stamps. Thread-safe.
+ */
+int pub_set_aco_evaporation_mode(int context_id, int mode);
+
+/*
+ * pub_get_aco_evaporation_mode
+ * Reads the current ACO evaporation mode. Thread-safe.
+ */
+int pub_get_aco_evaporation_mode(int context_id, int* out_mode);
+
+/*
+ * pub_set_aco_storage_mode
+ * ACO_STORAGE_FLOAT keeps 32-bit pheromones; ACO_STORAGE_FP16 and ACO_STORAGE_LOG16 store
+ * 16-bit codes, halving the matrix, converted with vector kernels. pub_get_pheromone_matrix
+ * still returns floats. Converts a live matrix in place. Thread-safe.
+ */
+int pub_set_aco_storage_mode(int context_id, int mode);
+
+/*
+ * pub_get_aco_storage_mode
+ * Reads the current pheromone storage format. Thread-safe.
+ */
+int pub_get_aco_storage_mode(int context_id, int* out_mode);
+
+/*
+ * pub_set_aco_colonies
+ * Runs colony_count (1..64) independent ACO colonies, each with its own pheromone matrix
+ * and share of the ants, migrating every migration_interval iterations (0 = never) with
+ * ACO_MIGRATE_BEST_PATH or ACO_MIGRATE_BLEND. The exported matrix is colony 0. Thread-safe.
+ */
+int pub_set_aco_colonies(int context_id, int colony_count, int migration_interval, int migration_mode);
+
+/*
+ * pub_get_aco_colonies
+ * Reads the colony settings. Thread-safe.
+ */
+int pub_get_aco_colonies(int context_id, int* out_colony_count, int* out_migration_interval,
+                         int* out_migration_mode);
+
+/*
+ * pub_set_worker_threads
+ * Sets how many threads the context's worker pool runs (caller included).
+ * 0 selects one thread per online core. The pool is rebuilt on next use. Thread-safe.
+ */
+int pub_set_worker_threads(int context_id, int nb_threads);
+
+/*
+ * pub_set_seed
+ * Reseeds every solver stream of the context. 0 picks a clock-based seed.
+ * With the same seed, topology and worker count, runs are repeated bit-for-bit. Thread-safe.
+ */
+int pub_set_seed(int context_id, uint64_t seed);
+
+/*
+ * pub_get_seed
+ * Reads the effective seed, including one picked from the clock. Thread-safe.
+ */
+int pub_get_seed(int context_id, uint64_t* out_seed);
+
+/*
+ * pub_set_exact_solver / pub_get_exact_solver
+ * Enables the exact hop-constrained solver as a fourth ranked solver in
+ * pub_run_all_solvers. It re-solves only after topology, hop range or mode changes. Thread-safe.
+ */
+int pub_set_exact_solver(int context_id, int enabled);
+int pub_get_exact_solver(int context_id, int* out_enabled);
+
+/*
+ * pub_get_exact_path
+ * Returns the exact minimum-latency 0 -> 1 path for the current topology, enabled or not,
+ * and the cheapest walk cost in out_lower_bound (NULL allowed). Thread-safe.
+ * Returns 0, ERR_NO_PATH_FOUND or a negative error code.
+ */
+int pub_get_exact_path(int context_id, int* out_nodes, int max_size,
+                       int* out_len, int* out_latency, int* out_lower_bound);
+
+/*
+ * pub_set_brute_force_mode
+ * BRUTE_MODE_PERMUTATION tries one ordering per run. BRUTE_MODE_BRANCH_BOUND enumerates
+ * combinations only, pruned by a lower bound, visiting up to step_candidates candidates
+ * or step_time_us microseconds per run (0 = no limit). BRUTE_MODE_PARALLEL does the same
+ * over rank ranges on the worker pool. Thread-safe.
+ */
+int pub_set_brute_force_mode(int context_id, int mode, int step_candidates, int step_time_us);
+
+/*
+ * pub_get_brute_force_mode
+ * Reads the mode and budgets; out_done is 1 once the enumeration is complete.
+ * NULL outputs are skipped. Thread-safe.
+ */
+int pub_get_brute_force_mode(int context_id, int* out_mode, int* out_step_candidates,
+                             int* out_step_time_us, int* out_done);
+
+/*
+ * pub_get_brute_force_checkpoint / pub_restore_brute_force_checkpoint
+ * Save and resume a BRUTE_MODE_BRANCH_BOUND or BRUTE_MODE_PARALLEL enumeration, also
+ * across processes. Restore needs the same candidates, delays and hop range and returns
+ * ERR_INVALID_ARGS otherwise. out holds max_path best path nodes (BRUTE_CHECKPOINT_SIZE
+ * bytes); max_hops + 2 always suffices, ERR_ARRAY_TOO_SMALL if the best path is longer.
+ * Restore reads cp->best_length nodes. Thread-safe.
+ */
+int pub_get_brute_force_checkpoint(int context_id, BruteForceCheckpoint* out, int max_path);
+int pub_restore_brute_force_checkpoint(int context_id, const BruteForceCheckpoint* cp);
+
+/*
+ * pub_drain_logs
+ * Moves up to max_count backend log entries, oldest first across all threads and
+ * contexts, into out. Returns the number of entries, 0 when none are pending.
+ */
+int pub_drain_logs(AntNetLogEntry* out, int max_count);
+
+/*
+ * pub_set_log_level / pub_get_log_dropped
+ * Runtime filter (ANTNET_LOG_ERROR..ANTNET_LOG_DEBUG, default ANTNET_LOG_INFO) and the
+ * number of messages lost to full rings. Debug lines exist only in debug-level builds.
+ */
+int pub_set_log_level(int level);
+int pub_get_log_dropped(uint64_t* out_dropped);
+
+/*
+ * pub_get_perf_counters / pub_reset_perf_counters
+ * Per-phase sample counts, total and longest times (ANTNET_PERF_* indices) of the
+ * context since creation or the last reset. Lock-free, safe while solvers run.
+ */
+int pub_get_perf_counters(int context_id, AntNetPerfCounters* out);
+int pub_reset_perf_counters(int context_id);
+
+/*
+ * pub_results_acquire / pub_results_release
+ * acquire pins the context's results region (see AntNetResultsHeader) and returns its
+ * address and size for reading in place; release unpins it. The region is refreshed
+ * after every pub_run_all_solvers and pub_run_solvers_batch call once a first acquire
+ * asked for it, so that acquire returns ERR_NO_TOPOLOGY. Lock-free. Readers check seq
+ * around each read and must release before pub_shutdown.
+ */
+int pub_results_acquire(int context_id, void** out_region, uint64_t* out_bytes);
+int pub_results_release(int context_id, void* region);
+
+/*
+ * pub_solver_loop_start / pub_solver_loop_stop
+ * start runs pub_run_all_solvers iterations back to back on a native thread, refreshing
+ * the results region after each, and returns a non-blocking descriptor in *out_fd. It
+ * becomes readable after an iteration that improved a best path and at least every
+ * progress_interval_ms while iterations run (0 = improvements only); read it to re-arm.
+ * Calling start while running only changes the interval. stop waits for the iteration
+ * in progress. The descriptor stays valid until pub_shutdown, which stops the loop.
+ * ERR_UNIMPLEMENTED on builds without pthreads.
+ */
+int pub_solver_loop_start(int context_id, int progress_interval_ms, int* out_fd);
+int pub_solver_loop_stop(int context_id);
+
+/*
+ * pub_solver_loop_status
+ * Whether the loop runs, and the iterations and improving iterations it ran so far
+ * for this context. Lock-free; any output may be NULL.
+ */
+int pub_solver_loop_status(int context_id, int* out_running, uint64_t* out_iterations,
+                           uint64_t* out_improvements);
+
 
 #ifdef __cplusplus
 }
@@ -8,10 +8,61 @@
 #ifndef ANTNET_ACO_V1_TYPES_H
 #define ANTNET_ACO_V1_TYPES_H
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/*
+ * Tour construction modes (AcoV1State.construction_mode).
+ * SUBSET:    ants draw an unordered node subset weighted by pheromone row sums.
+ * EDGE_WALK: ants walk from node 0 to node 1 along existing edges, picking the next
+ *            hop with probability proportional to tau^alpha * eta^beta, eta = 1/delay_ms.
+ */
+#define ACO_CONSTRUCT_SUBSET     0
+#define ACO_CONSTRUCT_EDGE_WALK  1
+
+/*
+ * Evaporation modes (AcoV1State.evaporation_mode).
+ * PATH:   only the edges an ant deposits on evaporate, as part of the deposit.
+ * GLOBAL: every cell is multiplied by (1 - evaporation) once per iteration, then ants
+ *         deposit Q/cost. The sweep runs vectorized and row-partitioned on the worker pool.
+ * LAZY:   same values as GLOBAL, but a cell is only brought up to date when it is read or
+ *         written, using its stamp and a power table: O(touched edges) per iteration.
+ */
+#define ACO_EVAPORATE_PATH    0
+#define ACO_EVAPORATE_GLOBAL  1
+#define ACO_EVAPORATE_LAZY    2
+
+/*
+ * Colony migration modes (AcoV1State.migration_mode), applied every migration_interval
+ * iterations when colony_count > 1.
+ * BEST_PATH: colony c reinforces the best path of colony c-1 (ring order) with Q/latency.
+ * BLEND:     every colony matrix moves a fixed fraction toward the mean of all colonies.
+ */
+#define ACO_MIGRATE_BEST_PATH  0
+#define ACO_MIGRATE_BLEND      1
+
+/*
+ * Pheromone storage formats (AcoV1State.storage_mode).
+ * FLOAT: 32-bit floats in pheromones.
+ * FP16:  IEEE half floats in pheromones_q, clamped to 65504. Below 6.1e-5 values are
+ *        half subnormals, so cells near ACO_PHEROMONE_FLOOR keep only a few bits.
+ * LOG16: 16-bit codes in pheromones_q with 1024 steps per power of two over [2^-20, 2^44),
+ *        a piecewise-linear log2 scale with ~0.1% relative precision over the whole range.
+ * The 16-bit formats halve the matrix; cells are converted on every read and write.
+ */
+#define ACO_STORAGE_FLOAT  0
+#define ACO_STORAGE_FP16   1
+#define ACO_STORAGE_LOG16  2
+
+/*
+ * AcoColonySet: opaque, private to cpu_ACOv1_colonies.c. Holds colonies 1..colony_count-1;
+ * colony 0 is the AcoV1State that owns the set.
+ */
+typedef struct AcoColonySet AcoColonySet;
+
 /*
  * AcoV1State: holds internal data for the ACO solver,
  * including pheromone matrix, adjacency, and solver parameters.
@@ -20,13 +71,65 @@ extern "C" {
  */
 typedef struct AcoV1State
 {
-    /* adjacency matrix: 1 if an edge (i->j) exists, else 0 */
-    int* adjacency;
-    int  adjacency_size; /* number of nodes, used to index adjacency[i*size + j] */
+    /*
+     * adjacency bitset: edge (i->j) exists if bit (j % 64) of
+     * adjacency_bits[i*adjacency_words + j/64] is set. One bit per pair instead of an int.
+     */
+    uint64_t* adjacency_bits;
+    int       adjacency_words; /* 64-bit words per row */
+    int       adjacency_size;  /* number of nodes */
+
+    /*
+     * pheromone matrix, cell i*size + j holds the pheromone for i->j. Exactly one of
+     * pheromones (ACO_STORAGE_FLOAT) and pheromones_q (FP16, LOG16) is allocated;
+     * access goes through aco_v1_get_pheromone / aco_v1_set_pheromone.
+     */
+    float*    pheromones;
+    uint16_t* pheromones_q;
+    int       storage_mode;   /* ACO_STORAGE_* */
+    int       pheromone_size; /* same as adjacency_size, for convenience */
+
+    /*
+     * row_sums[i] = sum_k pheromones[i*size + k], the node attractiveness used to weight
+     * candidates. Kept in double and updated by every pheromone write, so ants read it
+     * in O(1) per node instead of summing a full row.
+     */
+    double* row_sums;
+
+    /*
+     * Neighbour lists in CSR form, built from adjacency by aco_v1_init:
+     * the neighbours of i are nbr_targets[nbr_offsets[i] .. nbr_offsets[i+1]-1].
+     * choice_info[e] caches tau(i, nbr_targets[e])^alpha * eta(nbr_targets[e])^beta,
+     * refreshed once per iteration in edge-walk mode.
+     */
+    int*   nbr_offsets;
+    int*   nbr_targets;
+    float* choice_info;
+    int    construction_mode; /* ACO_CONSTRUCT_SUBSET or ACO_CONSTRUCT_EDGE_WALK */
+    int    evaporation_mode;  /* ACO_EVAPORATE_PATH, ACO_EVAPORATE_GLOBAL or ACO_EVAPORATE_LAZY */
+
+    /*
+     * Lazy evaporation, allocated only in ACO_EVAPORATE_LAZY mode. pheromones[k] holds the
+     * value as of iteration cell_stamps[k]; its current value is
+     * pheromones[k] * (1-evaporation)^(evap_clock - cell_stamps[k]), floored.
+     * row_sums[i] is likewise the sum as of row_stamps[i].
+     * decay_table[d] = (1-decay_rate)^d for d < decay_table_size.
+     */
+    int*   cell_stamps;
+    int*   row_stamps;
+    int    evap_clock;
+    float* decay_table;
+    int    decay_table_size;
+    float  decay_rate;
 
-    /* pheromone matrix: pheromones[i*size + j] holds the pheromone for i->j */
-    float* pheromones;
-    int    pheromone_size; /* same as adjacency_size, for convenience */
+    /*
+     * Multi-colony mode: colony_count independent pheromone matrices, each fed by its own
+     * share of num_ants and run as one worker pool task. 0 or 1 disables it.
+     */
+    int    colony_count;
+    int    migration_interval; /* iterations between migrations, 0 = never */
+    int    migration_mode;     /* ACO_MIGRATE_BEST_PATH or ACO_MIGRATE_BLEND */
+    AcoColonySet* colonies;
 
     /* ACO hyper-parameters */
     float alpha;        /* importance of pheromone */
@@ -8,20 +8,38 @@
 #ifndef ANTNET_BRUTE_FORCE_TYPES_H
 #define ANTNET_BRUTE_FORCE_TYPES_H
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* Enumeration modes */
+#define BRUTE_MODE_PERMUTATION   0  /* every ordering of every combination, one path per call */
+#define BRUTE_MODE_BRANCH_BOUND  1  /* combinations only, pruned, budgeted batches per call */
+#define BRUTE_MODE_PARALLEL      2  /* branch and bound over rank ranges on the worker pool */
+
+/* Rank ranges each length is split into (fixed, so results do not depend on thread count). */
+#define BRUTE_PARALLEL_RANGES 64
+
+/* Candidates per call when neither a candidate nor a time budget is set. */
+#define BRUTE_DEFAULT_STEP_CANDIDATES 4096
+
 /*
  * BruteForceState: internal iteration state for the brute force solver
- * stored in the AntNetContext.
+ * stored in the AntNetContext. Its buffers are sized by brute_force_reserve at
+ * topology load: candidate_nodes, permutation and bb_prefix by the node count,
+ * combination, bb_partial and par_comb by the hop count.
  */
 typedef struct {
+    int candidate_capacity; /* entries of candidate_nodes and permutation */
+    int hop_capacity;       /* longest combination the buffers hold */
+
     /*
      * candidate_nodes: list of node IDs that are neither start_id nor end_id.
      * candidate_count: how many such nodes.
      */
-    int candidate_nodes[1024];
+    int *candidate_nodes;
     int candidate_count;
 
     /*
@@ -33,13 +51,13 @@ typedef struct {
      * permutation[]: an index-based permutation over [0..candidate_count-1].
      * The solver uses only the first current_L items to form a path.
      */
-    int permutation[1024];
+    int *permutation;
 
     /*
      * combination[]: an index-based combination over [0..candidate_count-1].
      * The solver uses this to select subsets of nodes before permuting them.
      */
-    int combination[1024];
+    int *combination;
 
     /*
      * at_first_permutation: indicates if the solver has not called next_permutation() yet
@@ -59,8 +77,81 @@ typedef struct {
      */
     int done;
 
+    /*
+     * mode: BRUTE_MODE_PERMUTATION or BRUTE_MODE_BRANCH_BOUND. Kept across resets.
+     * step_candidates / step_time_us: per-call budget of the branch-and-bound mode;
+     * 0 disables a limit, both 0 falls back to BRUTE_DEFAULT_STEP_CANDIDATES.
+     */
+    int mode;
+    int step_candidates;
+    int step_time_us;
+
+    /*
+     * Branch-and-bound cursor. candidate_nodes is sorted by delay, bb_prefix[i] sums the
+     * first i candidate delays, and combination[0..bb_depth] holds the chosen positions
+     * with combination[bb_depth] the next one to try. bb_partial[d] is the latency of
+     * start, end and the first d picks. bb_best is this pass's incumbent (-1 if none).
+     */
+    int bb_depth;
+    long long bb_best;
+    long long *bb_partial; /* hop_capacity + 1 entries */
+    long long *bb_prefix;  /* candidate_capacity + 1 entries */
+
+    /* evaluated: candidates (tree nodes) visited since the last reset. */
+    long long evaluated;
+
+    /*
+     * signature: hash of the sorted candidates, their delays and the hop range, set at
+     * reset. A checkpoint only restores into a state with the same signature.
+     */
+    uint64_t signature;
+
+    /*
+     * Parallel cursors. par_L is the length the ranges belong to (-1: not split yet);
+     * par_ranges is 0 when C(candidate_count, par_L) is too large to rank, in which case
+     * that length runs on the sequential branch-and-bound cursor. Range k covers
+     * combination ranks [par_next[k], par_end[k]); par_best[k] (-1 if none) and
+     * par_best_rank[k] are its local best.
+     */
+    int par_L;
+    int par_ranges;
+    uint64_t par_next[BRUTE_PARALLEL_RANGES];
+    uint64_t par_end[BRUTE_PARALLEL_RANGES];
+    long long par_best[BRUTE_PARALLEL_RANGES];
+    uint64_t par_best_rank[BRUTE_PARALLEL_RANGES];
+    int *par_comb; /* hop_capacity entries per range: the combination each range walks */
+
 } BruteForceState;
 
+/*
+ * BruteForceCheckpoint: resumable snapshot of a branch-and-bound or parallel enumeration.
+ * Plain data, so it can be written to disk and restored in another process. best_nodes
+ * is sized by the caller, see BRUTE_CHECKPOINT_SIZE.
+ */
+typedef struct {
+    uint64_t signature;     /* BruteForceState.signature it was taken from */
+    int mode;               /* BRUTE_MODE_* at the time of the checkpoint */
+    int current_L;
+    int done;
+    long long best_latency; /* pass incumbent, -1 if none */
+
+    /* cursors of current_L; range_count 0 means the length restarts from its first combination */
+    int range_count;
+    uint64_t range_next[BRUTE_PARALLEL_RANGES];
+    uint64_t range_end[BRUTE_PARALLEL_RANGES];
+    long long range_best[BRUTE_PARALLEL_RANGES];
+    uint64_t range_best_rank[BRUTE_PARALLEL_RANGES];
+
+    /* best path found so far (ctx->brute_best_*) */
+    int best_path_latency;
+    int best_length;
+    int best_nodes[];
+} BruteForceCheckpoint;
+
+/* Bytes of a BruteForceCheckpoint whose best_nodes holds path_length nodes. */
+#define BRUTE_CHECKPOINT_SIZE(path_length) \
+    (sizeof(BruteForceCheckpoint) + (size_t)(path_length) * sizeof(int))
+
 #ifdef __cplusplus
 }
 #endif
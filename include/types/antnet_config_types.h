@@ -13,6 +13,7 @@ extern "C" {
 #endif
 
 #include <stdbool.h>
+#include <stdint.h>
 
 /*
  * AppConfig holds configuration fields from the .ini file.
@@ -25,6 +26,7 @@ typedef struct AppConfig
     int set_nb_nodes;
     int min_hops;
     int max_hops;
+    uint64_t seed;       /* RNG seed, 0 = derive one from the clock */
 
     /* [node] */
     int default_min_delay;
@@ -37,6 +39,7 @@ typedef struct AppConfig
     bool simulate_ddos;
     bool show_random_performance;
     bool show_brute_performance;
+    bool exact_solver;            /* exact solver ranked alongside the heuristics */
 
     /* [ranking] */
     double ranking_alpha;
@@ -48,6 +51,17 @@ typedef struct AppConfig
     float ant_beta;
     float ant_Q;
     float ant_evaporation;
+    int   ant_construction; /* ACO_CONSTRUCT_SUBSET (0) or ACO_CONSTRUCT_EDGE_WALK (1) */
+    int   ant_evaporation_mode; /* ACO_EVAPORATE_PATH (0), _GLOBAL (1) or _LAZY (2) */
+    int   ant_storage_mode;     /* ACO_STORAGE_FLOAT (0), _FP16 (1) or _LOG16 (2) */
+    int   ant_colonies;          /* independent colonies, 1 = single colony */
+    int   ant_migration_interval; /* iterations between colony migrations, 0 = never */
+    int   ant_migration_mode;    /* ACO_MIGRATE_BEST_PATH (0) or ACO_MIGRATE_BLEND (1) */
+
+    /* [brute] */
+    int   brute_mode;            /* BRUTE_MODE_PERMUTATION (0), _BRANCH_BOUND (1) or _PARALLEL (2) */
+    int   brute_step_candidates; /* branch-and-bound candidates per call, 0 = no limit */
+    int   brute_step_time_us;    /* branch-and-bound time per call in microseconds, 0 = no limit */
 
 } AppConfig;
 
@@ -0,0 +1,46 @@
+/* Relative Path: include/types/antnet_exact_types.h */
+/*
+ * Declares ExactSolverState, the cache of the exact minimum-latency solver.
+ * Stored in AntNetContext as exact_state; a solve is reused until the topology version,
+ * the hop range or the mode it was computed for changes.
+*/
+
+#ifndef ANTNET_EXACT_TYPES_H
+#define ANTNET_EXACT_TYPES_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Exact solver modes, taken from the ACO construction mode so both solve the same problem.
+ * SUBSET: any min_hops..max_hops distinct intermediate nodes, adjacency ignored, like the
+ *         random, brute-force and subset ACO solvers.
+ * EDGES:  0 -> 1 along existing edges, like edge-walking ants.
+ */
+#define EXACT_MODE_SUBSET 0
+#define EXACT_MODE_EDGES  1
+
+typedef struct ExactSolverState {
+    int enabled;                    /* 0 = not run by pub_run_all_solvers */
+
+    /* key of the cached solve; solved = 0 forces a new one */
+    int          solved;
+    unsigned int topology_version;
+    int          mode;              /* EXACT_MODE_* */
+    int          min_hops;
+    int          max_hops;
+
+    /*
+     * lower_bound: no 0 -> 1 walk in the hop range costs less. Equal to the path latency in
+     * subset mode; lower in edge mode when the cheapest walk repeats a node. -1 when no
+     * walk exists.
+     */
+    int lower_bound;
+} ExactSolverState;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ANTNET_EXACT_TYPES_H */
@@ -0,0 +1,42 @@
+/* Relative Path: include/types/antnet_log_types.h */
+/*
+ * Declares the log levels and the AntNetLogEntry struct returned by pub_drain_logs.
+ * Entries are written to per-thread rings by the backend and drained by the Python side.
+*/
+
+#ifndef ANTNET_LOG_TYPES_H
+#define ANTNET_LOG_TYPES_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Log levels, most severe first. */
+#define ANTNET_LOG_ERROR 0
+#define ANTNET_LOG_WARN  1
+#define ANTNET_LOG_INFO  2
+#define ANTNET_LOG_DEBUG 3
+
+/* Bytes kept per message, terminator included; longer messages are truncated. */
+#define ANTNET_LOG_MESSAGE_SIZE 128
+
+/*
+ * AntNetLogEntry
+ * One drained log line. seq orders entries across threads; time_us is monotonic.
+ * context_id is -1 for messages not tied to a context.
+ */
+typedef struct AntNetLogEntry {
+    uint64_t seq;
+    uint64_t time_us;
+    int      level;
+    int      context_id;
+    char     message[ANTNET_LOG_MESSAGE_SIZE];
+} AntNetLogEntry;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ANTNET_LOG_TYPES_H */
@@ -0,0 +1,46 @@
+/* Relative Path: include/types/antnet_perf_types.h */
+/*
+ * Declares the per-phase performance counters aggregated in each AntNetContext and
+ * returned by pub_get_perf_counters. Times are monotonic-clock nanoseconds.
+*/
+
+#ifndef ANTNET_PERF_TYPES_H
+#define ANTNET_PERF_TYPES_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Phases. Weighting and sampling run inside construction, and construction inside the
+ * iteration, so nested phases overlap; ant phases sum the time of every ant, across threads.
+ */
+#define ANTNET_PERF_ACO_CONSTRUCT   0 /* one ant path */
+#define ANTNET_PERF_ACO_WEIGHTING   1 /* candidate sampler build, edge-walk choice_info */
+#define ANTNET_PERF_ACO_SAMPLING    2 /* weighted draws of one ant */
+#define ANTNET_PERF_ACO_MERGE       3 /* evaporation and delta merge */
+#define ANTNET_PERF_SASA_UPDATE     4
+#define ANTNET_PERF_BRUTE_STEP      5
+#define ANTNET_PERF_RANDOM_STEP     6
+#define ANTNET_PERF_TOPOLOGY_UPDATE 7
+#define ANTNET_PERF_LOCK_WAIT       8 /* ctx->lock acquisitions; only contended ones add time */
+#define ANTNET_PERF_ITERATION       9 /* one pub_run_all_solvers call */
+#define ANTNET_PERF_PHASES          10
+
+/*
+ * AntNetPerfCounters
+ * Per phase: number of samples, their total and their longest duration.
+ */
+typedef struct AntNetPerfCounters {
+    uint64_t calls[ANTNET_PERF_PHASES];
+    uint64_t total_ns[ANTNET_PERF_PHASES];
+    uint64_t max_ns[ANTNET_PERF_PHASES];
+} AntNetPerfCounters;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ANTNET_PERF_TYPES_H */
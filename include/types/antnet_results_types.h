@@ -0,0 +1,49 @@
+/* Relative Path: include/types/antnet_results_types.h */
+/*
+ * Declares the header of a results region, the context-owned block pub_results_acquire
+ * hands out for zero-copy reads. Arrays follow the header at the byte offsets it lists.
+*/
+
+#ifndef ANTNET_RESULTS_TYPES_H
+#define ANTNET_RESULTS_TYPES_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Path rows of a region, in this order. */
+#define ANTNET_RESULTS_PATH_ACO    0
+#define ANTNET_RESULTS_PATH_RANDOM 1
+#define ANTNET_RESULTS_PATH_BRUTE  2
+#define ANTNET_RESULTS_PATH_EXACT  3
+#define ANTNET_RESULTS_PATHS       4
+
+/*
+ * AntNetResultsHeader
+ * seq is a sequence lock: odd while the backend rewrites the region, bumped to the next
+ * even value once done. A reader that sees the same even seq before and after reading
+ * got a consistent copy. Offsets count bytes from the start of the header:
+ *   pheromone_offset  num_nodes * num_nodes floats, row-major
+ *   strength_offset   num_nodes floats, the strongest outgoing pheromone of each node
+ *   paths_offset      ANTNET_RESULTS_PATHS rows of path_capacity ints
+ */
+typedef struct AntNetResultsHeader {
+    uint64_t seq;
+    uint64_t version;   /* publishes of this context so far */
+    uint64_t iteration; /* solver iteration of the last publish */
+    uint64_t pheromone_offset;
+    uint64_t strength_offset;
+    uint64_t paths_offset;
+    int      num_nodes; /* pheromone matrix dimension, 0 before the first ACO run */
+    int      path_capacity;
+    int      path_length[ANTNET_RESULTS_PATHS];
+    int      path_latency[ANTNET_RESULTS_PATHS];
+} AntNetResultsHeader;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ANTNET_RESULTS_TYPES_H */
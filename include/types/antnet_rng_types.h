@@ -0,0 +1,30 @@
+/* Relative Path: include/types/antnet_rng_types.h */
+/*
+ * Defines the state of the AntNet pseudo-random generator (xoshiro256** family).
+ * One AntNetRng is one independent stream; solvers and ants never share a stream.
+ * Plain data so it can be embedded in AntNetContext and HopMapManager.
+*/
+
+#ifndef ANTNET_RNG_TYPES_H
+#define ANTNET_RNG_TYPES_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/*
+ * AntNetRng
+ * 256-bit generator state. Must be seeded with antnet_rng_seed_stream before use;
+ * an all-zero state is never produced by seeding.
+ */
+typedef struct AntNetRng {
+    uint64_t s[4];
+} AntNetRng;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ANTNET_RNG_TYPES_H */
@@ -1,7 +1,8 @@
 /* Relative Path: src/c/algo/cpu/cpu_ACOv1.c */
 /*
  * Main ACO V1 algorithm combining single-ant and multi-ant modes.
- * Selects a subset of nodes via pheromone-weighted picks, updating global best path if improved.
+ * Builds paths by subset picks or edge walks (see aco_shared_construct_path),
+ * updating global best path if improved.
  * Central entry point for ACO initialization, iteration, and best-path retrieval.
 */
 
@@ -9,24 +10,50 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <time.h>
 #include <limits.h>
+#include <math.h>
 #include "../../../../include/consts/error_codes.h"
 #include "../../../../include/algo/cpu/cpu_ACOv1.h"
 #include "../../../../include/algo/cpu/cpu_ACOv1_threaded.h"
+#include "../../../../include/algo/cpu/cpu_ACOv1_shared_structs.h"
 #include "../../../../include/types/antnet_aco_v1_types.h"
 #include "../../../../include/rendering/heatmap_renderer_api.h"
 /* Added header for path reordering */
 #include "../../../../include/algo/cpu/cpu_ACOv1_path_reorder.h"
-
-/* Single-process RNG seeding guard, similar to random_algo.c */
-static int g_aco_seeded = 0;
+#include "../../../../include/core/backend_rng.h"
+#include "../../../../include/algo/cpu/cpu_ACOv1_edge_walk.h"
+#include "../../../../include/algo/cpu/cpu_ACOv1_kernels.h"
+#include "../../../../include/algo/cpu/cpu_ACOv1_colonies.h"
+#include "../../../../include/core/backend_init.h"
+#include "../../../../include/core/backend_log.h"
+#include "../../../../include/core/backend_perf.h"
 
 /*
  * Forward declaration for the original single-ant approach
  * so that aco_v1_run_iteration can decide which path to take.
  */
 static int aco_v1_run_iteration_single(AntNetContext* ctx);
+static void aco_v1_lazy_touch_row(AcoV1State* state, int row);
+
+/*
+ * Internal helper: aco_v1_fill_adjacency
+ * Sets the adjacency bits of every edge in ctx->edges, undirected assumption, skipping
+ * edges with an endpoint out of range or disabled. The bitset must be zeroed.
+ */
+static void aco_v1_fill_adjacency(const AntNetContext* ctx, AcoV1State* state)
+{
+    int n = state->adjacency_size;
+    size_t words = (size_t)state->adjacency_words;
+    for (int e = 0; e < ctx->num_edges; e++) {
+        int from = ctx->edges[e].from_id;
+        int to   = ctx->edges[e].to_id;
+        if (from >= 0 && from < n && to >= 0 && to < n &&
+            ANTNET_NODE_ENABLED(ctx, from) && ANTNET_NODE_ENABLED(ctx, to)) {
+            state->adjacency_bits[(size_t)from * words + (size_t)(to >> 6)]   |= 1ULL << (to & 63);
+            state->adjacency_bits[(size_t)to   * words + (size_t)(from >> 6)] |= 1ULL << (from & 63);
+        }
+    }
+}
 
 /*
  * aco_v1_init: remains the same as before (or minimal update).
@@ -45,15 +72,7 @@ int aco_v1_init(AntNetContext* ctx)
 
     if (ctx->aco_v1.is_initialized) {
         //printf("[DEBUG][ACO] aco_v1_init: Re-initializing; freeing old data...\n");
-        if (ctx->aco_v1.adjacency) {
-            free(ctx->aco_v1.adjacency);
-            ctx->aco_v1.adjacency = NULL;
-        }
-        if (ctx->aco_v1.pheromones) {
-            free(ctx->aco_v1.pheromones);
-            ctx->aco_v1.pheromones = NULL;
-        }
-        ctx->aco_v1.is_initialized = 0;
+        aco_v1_free_buffers(&ctx->aco_v1);
     }
 
     int n = ctx->num_nodes;
@@ -61,41 +80,59 @@ int aco_v1_init(AntNetContext* ctx)
     ctx->aco_v1.pheromone_size = n;
 
     size_t matrix_count = (size_t)n * (size_t)n;
+    int words = (n + 63) / 64;
+    ctx->aco_v1.adjacency_words = words;
 
-    ctx->aco_v1.adjacency = (int*)calloc(matrix_count, sizeof(int));
-    if (!ctx->aco_v1.adjacency) {
+    ctx->aco_v1.adjacency_bits = (uint64_t*)calloc((size_t)n * (size_t)words, sizeof(uint64_t));
+    if (!ctx->aco_v1.adjacency_bits) {
         //printf("[DEBUG][ACO] aco_v1_init: adjacency allocation failed\n");
         return ERR_MEMORY_ALLOCATION;
     }
 
-    ctx->aco_v1.pheromones = (float*)calloc(matrix_count, sizeof(float));
-    if (!ctx->aco_v1.pheromones) {
+    /* All pheromones start at 1.0f, in the configured storage format */
+    if (aco_v1_alloc_pheromones(&ctx->aco_v1, n) != ERR_SUCCESS) {
         //printf("[DEBUG][ACO] aco_v1_init: pheromones allocation failed\n");
-        free(ctx->aco_v1.adjacency);
-        ctx->aco_v1.adjacency = NULL;
+        free(ctx->aco_v1.adjacency_bits);
+        ctx->aco_v1.adjacency_bits = NULL;
         return ERR_MEMORY_ALLOCATION;
     }
 
-    /* Build adjacency from edges, undirected assumption */
-    for (int e = 0; e < ctx->num_edges; e++) {
-        int from = ctx->edges[e].from_id;
-        int to   = ctx->edges[e].to_id;
-        if (from >= 0 && from < n && to >= 0 && to < n) {
-            ctx->aco_v1.adjacency[from * n + to] = 1;
-            ctx->aco_v1.adjacency[to   * n + from] = 1;
+    ctx->aco_v1.row_sums = (double*)malloc((size_t)n * sizeof(double));
+    if (!ctx->aco_v1.row_sums) {
+        aco_v1_free_buffers(&ctx->aco_v1);
+        return ERR_MEMORY_ALLOCATION;
+    }
+
+    /* Stamps start at clock 0, matching the freshly filled matrix. */
+    if (ctx->aco_v1.evaporation_mode == ACO_EVAPORATE_LAZY) {
+        ctx->aco_v1.cell_stamps = (int*)calloc(matrix_count, sizeof(int));
+        ctx->aco_v1.row_stamps  = (int*)calloc((size_t)n, sizeof(int));
+        if (!ctx->aco_v1.cell_stamps || !ctx->aco_v1.row_stamps) {
+            aco_v1_free_buffers(&ctx->aco_v1);
+            return ERR_MEMORY_ALLOCATION;
         }
     }
 
-    /* Initialize all pheromones to 1.0f by default */
-    for (size_t i = 0; i < matrix_count; i++) {
-        ctx->aco_v1.pheromones[i] = 1.0f;
+    aco_v1_fill_adjacency(ctx, &ctx->aco_v1);
+
+    for (int i = 0; i < n; i++) {
+        ctx->aco_v1.row_sums[i] = (double)n;
     }
 
-    /* Default parameters if not set externally */
-    ctx->aco_v1.alpha       = 1.0f;
-    ctx->aco_v1.beta        = 2.0f;
-    ctx->aco_v1.evaporation = 0.1f;
-    ctx->aco_v1.Q           = 500.0f;
+    /* Neighbour lists for edge-walking ants, built once per topology */
+    int rc = aco_v1_edge_walk_build_graph(&ctx->aco_v1);
+    if (rc != ERR_SUCCESS) {
+        aco_v1_free_buffers(&ctx->aco_v1);
+        return rc;
+    }
+
+    /* Default parameters if not set externally (Q stays 0 until pub_set_aco_params) */
+    if (ctx->aco_v1.Q <= 0.0f) {
+        ctx->aco_v1.alpha       = 1.0f;
+        ctx->aco_v1.beta        = 2.0f;
+        ctx->aco_v1.evaporation = 0.1f;
+        ctx->aco_v1.Q           = 500.0f;
+    }
     /* 
      * The original code forced 'num_ants = 1' for single-ant approach.
      * The new code can override this. If you want multi-ant, do:
@@ -106,174 +143,663 @@ int aco_v1_init(AntNetContext* ctx)
         ctx->aco_v1.num_ants = 1;
     }
 
-    if (!g_aco_seeded) {
-        g_aco_seeded = 1;
-        srand((unsigned int)time(NULL));
-    }
-
     ctx->aco_v1.is_initialized = 1;
     ctx->aco_best_length  = 0;
     ctx->aco_best_latency = 0;
 
-    //printf("[ACO] aco_v1_init done: node_count=%d, edges=%d\n",
-    //       ctx->num_nodes, ctx->num_edges);
+    ANTNET_LOGD(priv_get_context_id(ctx), "[ACO] aco_v1_init done: node_count=%d, edges=%d",
+                ctx->num_nodes, ctx->num_edges);
     return ERR_SUCCESS;
 }
 
 /*
- * aco_v1_run_iteration:
- *   Now decides at runtime if we do single-ant or multi-ant approach,
- *   based on ctx->aco_v1.num_ants.
+ * aco_v1_free_buffers: see header. Safe on a zeroed or partially allocated state.
  */
-int aco_v1_run_iteration(AntNetContext* ctx)
+void aco_v1_free_buffers(AcoV1State* state)
 {
-    if (!ctx) {
-        //printf("[DEBUG][ACO] aco_v1_run_iteration: ctx=NULL\n");
-        return ERR_INVALID_ARGS;
+    if (!state) {
+        return;
     }
-    if (!ctx->aco_v1.is_initialized) {
-        int rc = aco_v1_init(ctx);
-        if (rc != ERR_SUCCESS) {
-            return rc;
-        }
+    /* Colonies borrow adjacency and neighbour lists: release them first. */
+    aco_v1_colonies_free(state->colonies);
+    state->colonies = NULL;
+    free(state->adjacency_bits);
+    state->adjacency_bits = NULL;
+    state->adjacency_words = 0;
+    free(state->pheromones);
+    state->pheromones = NULL;
+    free(state->pheromones_q);
+    state->pheromones_q = NULL;
+    free(state->row_sums);
+    state->row_sums = NULL;
+    free(state->nbr_offsets);
+    state->nbr_offsets = NULL;
+    free(state->nbr_targets);
+    state->nbr_targets = NULL;
+    free(state->choice_info);
+    state->choice_info = NULL;
+    free(state->cell_stamps);
+    state->cell_stamps = NULL;
+    free(state->row_stamps);
+    state->row_stamps = NULL;
+    free(state->decay_table);
+    state->decay_table = NULL;
+    state->decay_table_size = 0;
+    state->evap_clock = 0;
+    state->is_initialized = 0;
+}
+
+/*
+ * aco_v1_sync_topology: see header. Any allocation failure drops the solver state, so the
+ * next iteration re-initializes instead of running on half-patched buffers.
+ */
+int aco_v1_sync_topology(AntNetContext* ctx)
+{
+    AcoV1State* state = &ctx->aco_v1;
+    if (!state->is_initialized) {
+        return ERR_SUCCESS;
     }
-    if (ctx->num_nodes <= 0 || !ctx->nodes) {
-        return ERR_NO_TOPOLOGY;
+    int n = ctx->num_nodes;
+    if (n < state->pheromone_size) {
+        aco_v1_free_buffers(state);
+        return ERR_SUCCESS;
     }
 
-    /* If multiple ants, run the threaded approach. */
-    if (ctx->aco_v1.num_ants > 1) {
-        return aco_v1_run_iteration_threaded(ctx);
+    int rc = aco_v1_grow_pheromones(state, n);
+    if (rc != ERR_SUCCESS) {
+        aco_v1_free_buffers(state);
+        return rc;
+    }
+
+    int words = (n + 63) / 64;
+    size_t bit_words = (size_t)n * (size_t)words;
+    if (n != state->adjacency_size) {
+        uint64_t* bits = (uint64_t*)calloc(bit_words, sizeof(uint64_t));
+        if (!bits) {
+            aco_v1_free_buffers(state);
+            return ERR_MEMORY_ALLOCATION;
+        }
+        free(state->adjacency_bits);
+        state->adjacency_bits  = bits;
+        state->adjacency_words = words;
+        state->adjacency_size  = n;
     } else {
-        /* Otherwise run the original single-ant approach. */
-        return aco_v1_run_iteration_single(ctx);
+        memset(state->adjacency_bits, 0, bit_words * sizeof(uint64_t));
     }
+    aco_v1_fill_adjacency(ctx, state);
+
+    free(state->nbr_offsets);
+    free(state->nbr_targets);
+    free(state->choice_info);
+    state->nbr_offsets = NULL;
+    state->nbr_targets = NULL;
+    state->choice_info = NULL;
+    rc = aco_v1_edge_walk_build_graph(state);
+    if (rc == ERR_SUCCESS) {
+        rc = aco_v1_colonies_sync(state);
+    }
+    if (rc != ERR_SUCCESS) {
+        aco_v1_free_buffers(state);
+    }
+    return rc;
 }
 
 /*
- * aco_v1_run_iteration_single:
- *   The original single-ant approach unchanged.
+ * aco_v1_grow_pheromones: see header. Cells are copied raw with their lazy stamps, so
+ * values stay bit-identical; only each row sum is settled to the clock before new cells,
+ * stamped now, are added to it.
  */
-static int aco_v1_run_iteration_single(AntNetContext* ctx)
+int aco_v1_grow_pheromones(AcoV1State* state, int n)
 {
-    /* min_hops..max_hops logic, same as random. */
-    int range_size = ctx->max_hops - ctx->min_hops + 1;
-    if (range_size <= 0) {
-        //printf("[DEBUG][ACO] aco_v1_run_iteration_single: invalid hop range\n");
-        return ERR_INVALID_ARGS;
+    int old_n = state->pheromone_size;
+    if (!aco_v1_has_pheromones(state) || n <= old_n) {
+        return ERR_SUCCESS;
     }
-    int candidate_count = ctx->num_nodes - 2; /* exclude node 0 & 1 from the subset */
-    if (candidate_count < 0) {
-        //printf("[DEBUG][ACO] aco_v1_run_iteration_single: not enough nodes besides [0,1].\n");
-        return ERR_NO_PATH_FOUND;
+
+    size_t matrix_count = (size_t)n * (size_t)n;
+    float*    wide     = NULL;
+    uint16_t* narrow   = NULL;
+    int*      c_stamps = NULL;
+    int*      r_stamps = NULL;
+    double*   sums     = (double*)malloc((size_t)n * sizeof(double));
+    if (state->pheromones) {
+        wide = (float*)malloc(matrix_count * sizeof(float));
+    } else {
+        narrow = (uint16_t*)malloc(matrix_count * sizeof(uint16_t));
+    }
+    if (state->cell_stamps) {
+        c_stamps = (int*)malloc(matrix_count * sizeof(int));
+        r_stamps = (int*)malloc((size_t)n * sizeof(int));
+    }
+    if (!sums || (!wide && !narrow) || (state->cell_stamps && (!c_stamps || !r_stamps))) {
+        free(sums);
+        free(wide);
+        free(narrow);
+        free(c_stamps);
+        free(r_stamps);
+        return ERR_MEMORY_ALLOCATION;
     }
 
-    int nb_selected_nodes = ctx->min_hops + (rand() % range_size);
-    if (nb_selected_nodes > candidate_count) {
-        nb_selected_nodes = candidate_count;
+    /* New cells start at 1.0 as in a fresh matrix; the row sum counts the stored value. */
+    uint16_t one_q = aco_kernel_encode_one(state->storage_mode, 1.0f);
+    double one = wide ? 1.0 : (double)aco_kernel_decode_one(state->storage_mode, one_q);
+    for (int r = 0; r < n; r++) {
+        size_t dst  = (size_t)r * (size_t)n;
+        int    kept = (r < old_n) ? old_n : 0;
+        if (wide) {
+            if (kept) {
+                memcpy(wide + dst, state->pheromones + (size_t)r * (size_t)old_n, (size_t)kept * sizeof(float));
+            }
+            for (int k = kept; k < n; k++) {
+                wide[dst + (size_t)k] = 1.0f;
+            }
+        } else {
+            if (kept) {
+                memcpy(narrow + dst, state->pheromones_q + (size_t)r * (size_t)old_n, (size_t)kept * sizeof(uint16_t));
+            }
+            for (int k = kept; k < n; k++) {
+                narrow[dst + (size_t)k] = one_q;
+            }
+        }
+        if (c_stamps) {
+            if (kept) {
+                memcpy(c_stamps + dst, state->cell_stamps + (size_t)r * (size_t)old_n, (size_t)kept * sizeof(int));
+                aco_v1_lazy_touch_row(state, r);
+            }
+            for (int k = kept; k < n; k++) {
+                c_stamps[dst + (size_t)k] = state->evap_clock;
+            }
+            r_stamps[r] = state->evap_clock;
+        }
+        sums[r] = (kept ? state->row_sums[r] : 0.0) + (double)(n - kept) * one;
     }
 
-    /* Build a local array of possible nodes = [2..n-1]. We weight them by node-level pheromone. */
-    int* node_list = (int*)malloc((size_t)candidate_count * sizeof(int));
-    if (!node_list) {
-        return ERR_MEMORY_ALLOCATION;
+    free(state->pheromones);
+    free(state->pheromones_q);
+    free(state->row_sums);
+    state->pheromones   = wide;
+    state->pheromones_q = narrow;
+    state->row_sums     = sums;
+    if (c_stamps) {
+        free(state->cell_stamps);
+        free(state->row_stamps);
+        state->cell_stamps = c_stamps;
+        state->row_stamps  = r_stamps;
     }
-    int idx = 0;
-    for (int i = 0; i < ctx->num_nodes; i++) {
-        if (i != 0 && i != 1) {
-            node_list[idx++] = i;
+    state->pheromone_size = n;
+    return ERR_SUCCESS;
+}
+
+/*
+ * aco_v1_alloc_pheromones: see header.
+ */
+int aco_v1_alloc_pheromones(AcoV1State* state, int n)
+{
+    size_t matrix_count = (size_t)n * (size_t)n;
+
+    free(state->pheromones);
+    state->pheromones = NULL;
+    free(state->pheromones_q);
+    state->pheromones_q = NULL;
+
+    if (state->storage_mode == ACO_STORAGE_FLOAT) {
+        state->pheromones = (float*)malloc(matrix_count * sizeof(float));
+        if (!state->pheromones) {
+            return ERR_MEMORY_ALLOCATION;
+        }
+        for (size_t i = 0; i < matrix_count; i++) {
+            state->pheromones[i] = 1.0f;
         }
+        return ERR_SUCCESS;
     }
 
-    /* Build an array node_weight[i_in_node_list], computed as sum of pheromones[i*n + k] for k in [0..n-1]. */
-    float* node_weight = (float*)malloc((size_t)candidate_count * sizeof(float));
-    if (!node_weight) {
-        free(node_list);
+    state->pheromones_q = (uint16_t*)malloc(matrix_count * sizeof(uint16_t));
+    if (!state->pheromones_q) {
         return ERR_MEMORY_ALLOCATION;
     }
+    uint16_t one = aco_kernel_encode_one(state->storage_mode, 1.0f);
+    for (size_t i = 0; i < matrix_count; i++) {
+        state->pheromones_q[i] = one;
+    }
+    return ERR_SUCCESS;
+}
 
-    int n = ctx->aco_v1.pheromone_size;
-    float total_weight = 0.0f;
+/*
+ * aco_v1_has_pheromones: see header.
+ */
+int aco_v1_has_pheromones(const AcoV1State* state)
+{
+    return state && (state->pheromones || state->pheromones_q) && state->pheromone_size > 0;
+}
 
-    for (int c = 0; c < candidate_count; c++) {
-        int node_id = node_list[c];
-        float sum_pher = 0.0f;
-        for (int k = 0; k < n; k++) {
-            sum_pher += ctx->aco_v1.pheromones[node_id * n + k];
+/*
+ * aco_v1_load_cells: see header.
+ */
+void aco_v1_load_cells(const AcoV1State* state, size_t first, int count, float* out)
+{
+    if (state->pheromones) {
+        memcpy(out, state->pheromones + first, (size_t)count * sizeof(float));
+    } else {
+        aco_kernel_decode_row(state->storage_mode, state->pheromones_q + first, out, count);
+    }
+}
+
+/*
+ * aco_v1_store_cells: see header.
+ */
+double aco_v1_store_cells(AcoV1State* state, size_t first, int count, const float* in)
+{
+    if (state->pheromones) {
+        memcpy(state->pheromones + first, in, (size_t)count * sizeof(float));
+        return aco_kernel_row_sum(in, count);
+    }
+    return aco_kernel_encode_row(state->storage_mode, in, state->pheromones_q + first, count);
+}
+
+/*
+ * aco_v1_evaporate_row: see header. 16-bit rows go through a stack buffer one chunk at
+ * a time: decode, evaporate, encode, all vectorized.
+ */
+double aco_v1_evaporate_row(AcoV1State* state, int row, float keep)
+{
+    int n = state->pheromone_size;
+    size_t offset = (size_t)row * (size_t)n;
+    if (state->pheromones) {
+        return aco_kernel_evaporate_row(state->pheromones + offset, n, keep, ACO_PHEROMONE_FLOOR);
+    }
+
+    float buf[ACO_STORAGE_CHUNK];
+    double sum = 0.0;
+    for (int k = 0; k < n; k += ACO_STORAGE_CHUNK) {
+        int count = (n - k < ACO_STORAGE_CHUNK) ? n - k : ACO_STORAGE_CHUNK;
+        uint16_t* cells = state->pheromones_q + offset + (size_t)k;
+        aco_kernel_decode_row(state->storage_mode, cells, buf, count);
+        aco_kernel_evaporate_row(buf, count, keep, ACO_PHEROMONE_FLOOR);
+        sum += aco_kernel_encode_row(state->storage_mode, buf, cells, count);
+    }
+    return sum;
+}
+
+/*
+ * Internal helper: aco_v1_load_raw
+ * Stored value of one cell, before any lazy decay.
+ */
+static float aco_v1_load_raw(const AcoV1State* state, int index)
+{
+    if (state->pheromones) {
+        return state->pheromones[index];
+    }
+    return aco_kernel_decode_one(state->storage_mode, state->pheromones_q[index]);
+}
+
+/*
+ * Internal helper: aco_v1_decay
+ * (1 - decay_rate)^age, from the table when possible. Ages past the table only occur
+ * for cells untouched for ACO_LAZY_DECAY_TABLE_SIZE iterations, long since at the floor.
+ */
+static float aco_v1_decay(const AcoV1State* state, int age)
+{
+    if (age <= 0) {
+        return 1.0f;
+    }
+    if (age < state->decay_table_size) {
+        return state->decay_table[age];
+    }
+    return (float)pow(1.0 - (double)state->decay_rate, (double)age);
+}
+
+/*
+ * Internal helper: aco_v1_lazy_touch_row
+ * Brings row_sums[row] up to the current clock.
+ */
+static void aco_v1_lazy_touch_row(AcoV1State* state, int row)
+{
+    int age = state->evap_clock - state->row_stamps[row];
+    if (age > 0) {
+        state->row_sums[row] *= (double)aco_v1_decay(state, age);
+        state->row_stamps[row] = state->evap_clock;
+    }
+}
+
+/*
+ * Internal helper: aco_v1_build_decay_table
+ * Fills decay_table for the current evaporation rate.
+ */
+static int aco_v1_build_decay_table(AcoV1State* state)
+{
+    if (!state->decay_table) {
+        state->decay_table = (float*)malloc(ACO_LAZY_DECAY_TABLE_SIZE * sizeof(float));
+        if (!state->decay_table) {
+            state->decay_table_size = 0;
+            return ERR_MEMORY_ALLOCATION;
         }
-        if (sum_pher < 1e-6f) {
-            sum_pher = 1e-6f; /* avoid zero or negative */
+    }
+    double keep = 1.0 - (double)state->evaporation;
+    double value = 1.0;
+    for (int d = 0; d < ACO_LAZY_DECAY_TABLE_SIZE; d++) {
+        state->decay_table[d] = (float)value;
+        value *= keep;
+    }
+    state->decay_table_size = ACO_LAZY_DECAY_TABLE_SIZE;
+    state->decay_rate = state->evaporation;
+    return ERR_SUCCESS;
+}
+
+/*
+ * aco_v1_get_pheromone: see header.
+ */
+float aco_v1_get_pheromone(const AcoV1State* state, int index)
+{
+    float value = aco_v1_load_raw(state, index);
+    if (state->cell_stamps) {
+        value *= aco_v1_decay(state, state->evap_clock - state->cell_stamps[index]);
+        if (value < ACO_PHEROMONE_FLOOR) {
+            value = ACO_PHEROMONE_FLOOR;
         }
-        node_weight[c] = sum_pher;
-        total_weight   += sum_pher;
     }
+    return value;
+}
 
-    /* Pick nb_selected_nodes by a "weighted draw without replacement" approach. */
-    int* chosen_nodes = (int*)malloc((size_t)nb_selected_nodes * sizeof(int));
-    if (!chosen_nodes) {
-        free(node_weight);
-        free(node_list);
-        return ERR_MEMORY_ALLOCATION;
+/*
+ * aco_v1_get_row_sum: see header. A decayed sum ignores that each cell stops at the
+ * floor, so it is raised to n*floor: exact for rows fully at the floor, which keeps
+ * their sampling weight equal to the one the eager sweep gives.
+ */
+double aco_v1_get_row_sum(const AcoV1State* state, int row)
+{
+    double sum = state->row_sums[row];
+    if (state->row_stamps) {
+        sum *= (double)aco_v1_decay(state, state->evap_clock - state->row_stamps[row]);
+        double floor_sum = (double)state->pheromone_size * (double)ACO_PHEROMONE_FLOOR;
+        if (sum < floor_sum) {
+            sum = floor_sum;
+        }
+    }
+    return sum;
+}
+
+/*
+ * aco_v1_lazy_advance: see header. A rate change first settles every cell at the old
+ * rate, so already elapsed iterations are never re-evaporated at the new one.
+ */
+int aco_v1_lazy_advance(AcoV1State* state)
+{
+    if (!state || !state->cell_stamps) {
+        return ERR_INVALID_ARGS;
+    }
+    if (state->decay_table_size == 0 || state->decay_rate != state->evaporation) {
+        if (state->decay_table_size > 0) {
+            aco_v1_materialize(state);
+        }
+        int rc = aco_v1_build_decay_table(state);
+        if (rc != ERR_SUCCESS) {
+            return rc;
+        }
+    }
+    state->evap_clock++;
+    return ERR_SUCCESS;
+}
+
+/*
+ * aco_v1_materialize: see header. Row sums are recomputed from scratch, which also
+ * clears the floor-related drift of lazily decayed sums.
+ */
+void aco_v1_materialize(AcoV1State* state)
+{
+    if (!state || !state->cell_stamps || !aco_v1_has_pheromones(state)) {
+        return;
     }
+    int n = state->pheromone_size;
+    if (!state->pheromones) {
+        float buf[ACO_STORAGE_CHUNK];
+        for (int r = 0; r < n; r++) {
+            size_t offset = (size_t)r * (size_t)n;
+            double sum = 0.0;
+            for (int k = 0; k < n; k += ACO_STORAGE_CHUNK) {
+                int count = (n - k < ACO_STORAGE_CHUNK) ? n - k : ACO_STORAGE_CHUNK;
+                for (int i = 0; i < count; i++) {
+                    buf[i] = aco_v1_get_pheromone(state, (int)offset + k + i);
+                    state->cell_stamps[offset + (size_t)(k + i)] = state->evap_clock;
+                }
+                sum += aco_v1_store_cells(state, offset + (size_t)k, count, buf);
+            }
+            state->row_sums[r]   = sum;
+            state->row_stamps[r] = state->evap_clock;
+        }
+        return;
+    }
+    for (int r = 0; r < n; r++) {
+        float* row = state->pheromones + (size_t)r * (size_t)n;
+        int* stamps = state->cell_stamps + (size_t)r * (size_t)n;
+        for (int k = 0; k < n; k++) {
+            row[k] = aco_v1_get_pheromone(state, r * n + k);
+            stamps[k] = state->evap_clock;
+        }
+        state->row_sums[r]   = aco_kernel_row_sum(row, n);
+        state->row_stamps[r] = state->evap_clock;
+    }
+}
 
-    int chosen_count = 0;
-    int remain = candidate_count;
+/*
+ * aco_v1_export_pheromones: see header.
+ */
+void aco_v1_export_pheromones(const AcoV1State* state, float* out)
+{
+    int n = state->pheromone_size;
+    size_t count = (size_t)n * (size_t)n;
+    if (!state->cell_stamps) {
+        for (int r = 0; r < n; r++) {
+            aco_v1_load_cells(state, (size_t)r * (size_t)n, n, out + (size_t)r * (size_t)n);
+        }
+        return;
+    }
+    for (size_t k = 0; k < count; k++) {
+        out[k] = aco_v1_get_pheromone(state, (int)k);
+    }
+}
+
+/*
+ * aco_v1_set_evaporation_mode: see header.
+ */
+int aco_v1_set_evaporation_mode(AcoV1State* state, int mode)
+{
+    if (!state) {
+        return ERR_INVALID_ARGS;
+    }
+    if (mode == state->evaporation_mode) {
+        return ERR_SUCCESS;
+    }
 
-    for (int pick = 0; pick < nb_selected_nodes; pick++) {
-        if (remain <= 0 || total_weight <= 1e-9f) {
-            break;
+    if (aco_v1_has_pheromones(state) && mode == ACO_EVAPORATE_LAZY) {
+        int n = state->pheromone_size;
+        state->cell_stamps = (int*)calloc((size_t)n * (size_t)n, sizeof(int));
+        state->row_stamps  = (int*)calloc((size_t)n, sizeof(int));
+        if (!state->cell_stamps || !state->row_stamps) {
+            free(state->cell_stamps);
+            free(state->row_stamps);
+            state->cell_stamps = NULL;
+            state->row_stamps  = NULL;
+            return ERR_MEMORY_ALLOCATION;
         }
-        float r = (float)rand() / (float)RAND_MAX;
-        float accum = 0.0f;
-        int chosen_index = -1;
-        for (int c = 0; c < remain; c++) {
-            float p = node_weight[c] / total_weight;
-            accum += p;
-            if (r <= accum) {
-                chosen_index = c;
-                break;
+        state->evap_clock = 0;
+    } else if (state->evaporation_mode == ACO_EVAPORATE_LAZY) {
+        /* Leaving lazy mode: store the current values, then drop the stamps. */
+        aco_v1_materialize(state);
+        free(state->cell_stamps);
+        state->cell_stamps = NULL;
+        free(state->row_stamps);
+        state->row_stamps = NULL;
+        free(state->decay_table);
+        state->decay_table = NULL;
+        state->decay_table_size = 0;
+        state->evap_clock = 0;
+    }
+
+    state->evaporation_mode = mode;
+    return ERR_SUCCESS;
+}
+
+/*
+ * aco_v1_set_storage_mode: see header. Lazy cells are settled first so the converted
+ * values and the recomputed row sums refer to the same clock.
+ */
+int aco_v1_set_storage_mode(AcoV1State* state, int mode)
+{
+    if (!state || mode < ACO_STORAGE_FLOAT || mode > ACO_STORAGE_LOG16) {
+        return ERR_INVALID_ARGS;
+    }
+    if (mode == state->storage_mode) {
+        return ERR_SUCCESS;
+    }
+    if (!aco_v1_has_pheromones(state)) {
+        state->storage_mode = mode;
+        return ERR_SUCCESS;
+    }
+
+    aco_v1_materialize(state);
+
+    int n = state->pheromone_size;
+    size_t matrix_count = (size_t)n * (size_t)n;
+    float* wide = NULL;
+    uint16_t* narrow = NULL;
+    if (mode == ACO_STORAGE_FLOAT) {
+        wide = (float*)malloc(matrix_count * sizeof(float));
+    } else {
+        narrow = (uint16_t*)malloc(matrix_count * sizeof(uint16_t));
+    }
+    if (!wide && !narrow) {
+        return ERR_MEMORY_ALLOCATION;
+    }
+
+    for (int r = 0; r < n; r++) {
+        size_t offset = (size_t)r * (size_t)n;
+        float* dst = wide ? wide + offset : NULL;
+        float buf[ACO_STORAGE_CHUNK];
+        double sum = 0.0;
+        for (int k = 0; k < n; k += ACO_STORAGE_CHUNK) {
+            int count = (n - k < ACO_STORAGE_CHUNK) ? n - k : ACO_STORAGE_CHUNK;
+            float* values = dst ? dst + k : buf;
+            aco_v1_load_cells(state, offset + (size_t)k, count, values);
+            if (narrow) {
+                sum += aco_kernel_encode_row(mode, values, narrow + offset + (size_t)k, count);
             }
         }
-        if (chosen_index < 0) {
-            chosen_index = remain - 1;
+        /* Widening is exact, so the row sums stay valid. */
+        if (narrow) {
+            state->row_sums[r] = sum;
         }
+    }
 
-        chosen_nodes[chosen_count++] = node_list[chosen_index];
+    free(state->pheromones);
+    free(state->pheromones_q);
+    state->pheromones   = wide;
+    state->pheromones_q = narrow;
+    state->storage_mode = mode;
+    return ERR_SUCCESS;
+}
 
-        /* remove from arrays: swap last -> chosen_index */
-        total_weight -= node_weight[chosen_index];
-        node_list[chosen_index]   = node_list[remain - 1];
-        node_weight[chosen_index] = node_weight[remain - 1];
-        remain--;
+/*
+ * aco_v1_set_pheromone: see header. The row sum follows the value actually stored,
+ * after clamping, so it never drifts from the matrix by more than rounding.
+ */
+void aco_v1_set_pheromone(AcoV1State* state, int index, float value)
+{
+    if (value < ACO_PHEROMONE_FLOOR) {
+        value = ACO_PHEROMONE_FLOOR;
+    }
+    int row = index / state->pheromone_size;
+    float old = aco_v1_get_pheromone(state, index);
+    if (state->cell_stamps) {
+        /* Lazy mode: settle the cell and its row to the current clock first. */
+        state->cell_stamps[index] = state->evap_clock;
+        aco_v1_lazy_touch_row(state, row);
+    }
+    if (state->pheromones) {
+        state->pheromones[index] = value;
+    } else {
+        /* The row sum follows the rounded value, i.e. what a later read returns. */
+        state->pheromones_q[index] = aco_kernel_encode_one(state->storage_mode, value);
+        value = aco_kernel_decode_one(state->storage_mode, state->pheromones_q[index]);
     }
+    state->row_sums[row] += (double)value - (double)old;
+}
 
-    /* If not as many picked as intended, it proceeds anyway (like random). */
+/*
+ * aco_v1_run_iteration:
+ *   Now decides at runtime if we do single-ant or multi-ant approach,
+ *   based on ctx->aco_v1.num_ants.
+ */
+int aco_v1_run_iteration(AntNetContext* ctx)
+{
+    if (!ctx) {
+        //printf("[DEBUG][ACO] aco_v1_run_iteration: ctx=NULL\n");
+        return ERR_INVALID_ARGS;
+    }
+    if (!ctx->aco_v1.is_initialized) {
+        int rc = aco_v1_init(ctx);
+        if (rc != ERR_SUCCESS) {
+            return rc;
+        }
+    }
+    if (ctx->num_nodes <= 0 || !ctx->nodes) {
+        return ERR_NO_TOPOLOGY;
+    }
+
+    /* Ants only read choice_info, so it is refreshed here, once, before any of them starts. */
+    if (ctx->aco_v1.construction_mode == ACO_CONSTRUCT_EDGE_WALK) {
+        aco_v1_edge_walk_refresh_choice_info(ctx, &ctx->aco_v1);
+    }
+
+    int rc;
+    if (ctx->aco_v1.colony_count > 1) {
+        /* Several colonies: one pool task per colony. */
+        rc = aco_v1_run_iteration_colonies(ctx);
+    } else if (ctx->aco_v1.num_ants > 1) {
+        /* If multiple ants, run the threaded approach. */
+        rc = aco_v1_run_iteration_threaded(ctx);
+    } else {
+        /* Otherwise run the original single-ant approach. */
+        rc = aco_v1_run_iteration_single(ctx);
+    }
 
-    /* Fisher-Yates shuffle to replicate random's final order. */
-    for (int i = chosen_count - 1; i > 0; i--) {
-        int j = rand() % (i + 1);
-        int tmp = chosen_nodes[i];
-        chosen_nodes[i] = chosen_nodes[j];
-        chosen_nodes[j] = tmp;
+    /* Hand the merged matrix to lock-free readers, once any reader has shown up. */
+    if (rc == ERR_SUCCESS && pheromone_snapshots_active(ctx->pheromone_snapshots)) {
+#ifndef _WIN32
+        antnet_perf_lock_context(ctx);
+#endif
+        pheromone_snapshots_publish(ctx->pheromone_snapshots, &ctx->aco_v1);
+#ifndef _WIN32
+        pthread_mutex_unlock(&ctx->lock);
+#endif
     }
+    return rc;
+}
 
-    free(node_weight);
-    free(node_list);
+/*
+ * aco_v1_run_iteration_single:
+ *   The original single-ant approach unchanged.
+ */
+static int aco_v1_run_iteration_single(AntNetContext* ctx)
+{
+    int n = ctx->aco_v1.pheromone_size;
+    int max_len = (ctx->max_hops > 0 ? ctx->max_hops : 0) + 2;
 
-    /* Build final path [0, chosen_nodes..., 1]. */
-    int new_path_length = chosen_count + 2; /* start + subset + end */
-    int* new_path = (int*)malloc((size_t)new_path_length * sizeof(int));
+    /* Build the path [0, ..., 1] in the current construction mode. */
+    int* new_path = (int*)malloc((size_t)max_len * sizeof(int));
     if (!new_path) {
-        free(chosen_nodes);
         return ERR_MEMORY_ALLOCATION;
     }
-    new_path[0] = 0;
-    for (int i = 0; i < chosen_count; i++) {
-        new_path[i + 1] = chosen_nodes[i];
+    int new_path_length = 0;
+    int rc = aco_shared_construct_path(ctx, &ctx->aco_v1, &ctx->aco_rng, new_path, max_len, &new_path_length);
+    if (rc == ERR_NO_PATH_FOUND && ctx->aco_v1.construction_mode == ACO_CONSTRUCT_EDGE_WALK) {
+        /* The ant got lost: no deposit this iteration, which is not a solver failure. */
+        free(new_path);
+        return ERR_SUCCESS;
+    }
+    if (rc != ERR_SUCCESS) {
+        free(new_path);
+        return rc;
     }
-    new_path[new_path_length - 1] = 1;
-
-    free(chosen_nodes);
 
     /* Sum cost, check for overflow */
     int cost_sum = 0;
@@ -291,7 +817,8 @@ static int aco_v1_run_iteration_single(AntNetContext* ctx)
     }
 
     /* If better or if none yet, store in ctx->aco_best_* */
-    if (ctx->aco_best_length == 0 || cost_sum < ctx->aco_best_latency) {
+    if (new_path_length <= ctx->path_capacity &&
+        (ctx->aco_best_length == 0 || cost_sum < ctx->aco_best_latency)) {
         ctx->aco_best_length = new_path_length;
         ctx->aco_best_latency = cost_sum;
         for (int p = 0; p < new_path_length; p++) {
@@ -299,20 +826,43 @@ static int aco_v1_run_iteration_single(AntNetContext* ctx)
         }
     }
 
-    /* Evaporate and reinforce pheromones for the edges in the new path */
+    /*
+     * Evaporate and reinforce pheromones for the edges in the new path.
+     * In global mode the whole matrix evaporates first and the path only gets Q/cost.
+     */
+    uint64_t merge_start = antnet_perf_now_ns();
+    int global_evap = (ctx->aco_v1.evaporation_mode != ACO_EVAPORATE_PATH);
+    if (ctx->aco_v1.evaporation_mode == ACO_EVAPORATE_GLOBAL) {
+        rc = aco_shared_evaporate_global(ctx);
+    } else if (ctx->aco_v1.evaporation_mode == ACO_EVAPORATE_LAZY) {
+#ifndef _WIN32
+        antnet_perf_lock_context(ctx);
+#endif
+        rc = aco_v1_lazy_advance(&ctx->aco_v1);
+#ifndef _WIN32
+        pthread_mutex_unlock(&ctx->lock);
+#endif
+    }
+    if (rc != ERR_SUCCESS) {
+        free(new_path);
+        return rc;
+    }
     for (int i = 0; i < new_path_length - 1; i++) {
         int from = new_path[i];
         int to   = new_path[i + 1];
         int idx  = from * n + to;
 
-        ctx->aco_v1.pheromones[idx] *= (1.0f - ctx->aco_v1.evaporation);
-        ctx->aco_v1.pheromones[idx] += ctx->aco_v1.Q / (float)cost_sum;
-        if (ctx->aco_v1.pheromones[idx] < 1e-6f) {
-            ctx->aco_v1.pheromones[idx] = 1e-6f;
+        float value = aco_v1_get_pheromone(&ctx->aco_v1, idx);
+        if (!global_evap) {
+            value *= (1.0f - ctx->aco_v1.evaporation);
         }
+        value += ctx->aco_v1.Q / (float)cost_sum;
+        aco_v1_set_pheromone(&ctx->aco_v1, idx, value);
     }
+    antnet_perf_record(ctx, ANTNET_PERF_ACO_MERGE, merge_start);
 
-    //printf("[DEBUG][ACO] Reinforced %d-hop path, cost=%d\n", new_path_length - 2, cost_sum);
+    ANTNET_LOGD(priv_get_context_id(ctx), "[ACO] Reinforced %d-hop path, cost=%d",
+                new_path_length - 2, cost_sum);
 
     free(new_path);
 
@@ -346,8 +896,13 @@ int aco_v1_get_best_path(
     *out_path_len = ctx->aco_best_length;
     *out_total_latency = ctx->aco_best_latency;
 
-    /* Reorder only for display, does not modify the stored best path in ctx->aco_best_nodes. */
-    aco_v1_reorder_path_for_display(out_nodes, *out_path_len);
+    /*
+     * Reorder only for display, does not modify the stored best path in ctx->aco_best_nodes.
+     * Edge-walk paths are real routes already, so their order is kept.
+     */
+    if (ctx->aco_v1.construction_mode != ACO_CONSTRUCT_EDGE_WALK) {
+        aco_v1_reorder_path_for_display(out_nodes, *out_path_len);
+    }
 
     return ERR_SUCCESS;
 }
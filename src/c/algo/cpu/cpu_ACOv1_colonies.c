@@ -0,0 +1,513 @@
+/* Relative Path: src/c/algo/cpu/cpu_ACOv1_colonies.c */
+/*
+ * Implements multi-colony ACO v1. Each colony owns its pheromones, row sums, choice table
+ * and lazy stamps, and borrows adjacency and neighbour lists from ctx->aco_v1.
+ * Only migration and the colony 0 merge run under ctx->lock; colonies never share writes.
+*/
+
+#include "../../../../include/algo/cpu/cpu_ACOv1_colonies.h"
+#include "../../../../include/algo/cpu/cpu_ACOv1.h"
+#include "../../../../include/algo/cpu/cpu_ACOv1_shared_structs.h"
+#include "../../../../include/algo/cpu/cpu_ACOv1_edge_walk.h"
+#include "../../../../include/algo/cpu/cpu_ACOv1_kernels.h"
+#include "../../../../include/consts/error_codes.h"
+#include "../../../../include/core/backend_init.h"
+#include "../../../../include/core/backend_rng.h"
+#include "../../../../include/core/backend_worker_pool.h"
+#include "../../../../include/core/backend_perf.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * AcoColonyBest
+ * Best path a colony found so far; ring migration hands it to the next colony.
+ */
+typedef struct AcoColonyBest
+{
+    int* nodes; /* path_capacity entries in AcoColonySet.best_nodes */
+    int  length;
+    int  latency;
+} AcoColonyBest;
+
+/*
+ * AcoColonySet
+ * states[c-1] is colony c for c >= 1. best[c] covers every colony, 0 included.
+ */
+struct AcoColonySet
+{
+    int            count;       /* colonies in total, colony 0 included */
+    int            n;           /* matrix size the states were built for */
+    int            iteration;   /* colony iterations since creation, drives migration */
+    AcoV1State*    states;
+    AcoColonyBest* best;
+    int*           best_nodes;    /* count * path_capacity entries behind best[].nodes */
+    int            path_capacity; /* max_hops + 2 when the set was built */
+};
+
+/*
+ * AcoColonyBatchArg
+ * One pool batch: task c runs every ant of colony c.
+ * locals[first_ant[c] .. first_ant[c+1]-1] belong to colony c.
+ */
+typedef struct AcoColonyBatchArg
+{
+    AntNetContext*       ctx;
+    AcoColonySet*        set;
+    AcoThreadLocalData** locals;
+    int*                 first_ant;
+} AcoColonyBatchArg;
+
+/*
+ * AcoBlendArg
+ * One pool batch of ACO_MIGRATE_BLEND, task t owns rows [t*rows_per_task, ...).
+ */
+typedef struct AcoBlendArg
+{
+    AcoV1State** states;
+    int          count;
+    int          rows_per_task;
+} AcoBlendArg;
+
+/*
+ * Internal helper: aco_colony_state
+ * Colony c: ctx->aco_v1 for c == 0, otherwise an entry of the set.
+ */
+static AcoV1State* aco_colony_state(AntNetContext* ctx, AcoColonySet* set, int c)
+{
+    return (c == 0) ? &ctx->aco_v1 : &set->states[c - 1];
+}
+
+/*
+ * Internal helper: aco_colony_free_state
+ * Releases what a colony owns; adjacency and neighbour lists belong to ctx->aco_v1.
+ */
+static void aco_colony_free_state(AcoV1State* state)
+{
+    free(state->pheromones);
+    free(state->pheromones_q);
+    free(state->row_sums);
+    free(state->choice_info);
+    free(state->cell_stamps);
+    free(state->row_stamps);
+    free(state->decay_table);
+    memset(state, 0, sizeof(AcoV1State));
+}
+
+void aco_v1_colonies_free(AcoColonySet* set)
+{
+    if (!set) {
+        return;
+    }
+    for (int c = 1; c < set->count; c++) {
+        aco_colony_free_state(&set->states[c - 1]);
+    }
+    free(set->states);
+    free(set->best);
+    free(set->best_nodes);
+    free(set);
+}
+
+/*
+ * aco_v1_colonies_sync: see header. Each colony keeps its pheromones, grown like the main
+ * matrix, and picks up the rebuilt adjacency and neighbour lists.
+ */
+int aco_v1_colonies_sync(AcoV1State* main)
+{
+    AcoColonySet* set = main->colonies;
+    if (!set) {
+        return ERR_SUCCESS;
+    }
+    int n = main->pheromone_size;
+    int edge_count = main->nbr_offsets ? main->nbr_offsets[n] : 0;
+
+    for (int c = 1; c < set->count; c++) {
+        AcoV1State* state = &set->states[c - 1];
+        if (aco_v1_grow_pheromones(state, n) != ERR_SUCCESS) {
+            return ERR_MEMORY_ALLOCATION;
+        }
+        float* table = (float*)realloc(state->choice_info, ((size_t)edge_count + 1) * sizeof(float));
+        if (!table) {
+            return ERR_MEMORY_ALLOCATION;
+        }
+        for (int e = 0; e < edge_count; e++) {
+            table[e] = 1.0f;
+        }
+        state->choice_info     = table;
+        state->adjacency_bits  = main->adjacency_bits;
+        state->adjacency_words = main->adjacency_words;
+        state->adjacency_size  = main->adjacency_size;
+        state->nbr_offsets     = main->nbr_offsets;
+        state->nbr_targets     = main->nbr_targets;
+    }
+    set->n = n;
+
+    /* Recorded paths may cross a removed edge or node; migration waits for fresh ones. */
+    for (int c = 0; c < set->count; c++) {
+        set->best[c].length  = 0;
+        set->best[c].latency = 0;
+    }
+    return ERR_SUCCESS;
+}
+
+/*
+ * Internal helper: aco_colony_init_state
+ * Fresh colony over main's topology: pheromones at 1.0, same parameters and modes.
+ */
+static int aco_colony_init_state(AcoV1State* state, const AcoV1State* main)
+{
+    int n = main->pheromone_size;
+    int edge_count = main->nbr_offsets ? main->nbr_offsets[n] : 0;
+
+    memset(state, 0, sizeof(AcoV1State));
+    state->adjacency_bits  = main->adjacency_bits;
+    state->adjacency_words = main->adjacency_words;
+    state->adjacency_size  = main->adjacency_size;
+    state->nbr_offsets    = main->nbr_offsets;
+    state->nbr_targets    = main->nbr_targets;
+    state->pheromone_size = n;
+    state->storage_mode   = main->storage_mode;
+
+    state->row_sums    = (double*)malloc((size_t)n * sizeof(double));
+    state->choice_info = (float*)malloc(((size_t)edge_count + 1) * sizeof(float));
+    if (aco_v1_alloc_pheromones(state, n) != ERR_SUCCESS || !state->row_sums || !state->choice_info) {
+        aco_colony_free_state(state);
+        return ERR_MEMORY_ALLOCATION;
+    }
+    for (int i = 0; i < n; i++) {
+        state->row_sums[i] = (double)n;
+    }
+    for (int e = 0; e < edge_count; e++) {
+        state->choice_info[e] = 1.0f;
+    }
+
+    state->evaporation_mode = ACO_EVAPORATE_PATH;
+    if (aco_v1_set_evaporation_mode(state, main->evaporation_mode) != ERR_SUCCESS) {
+        aco_colony_free_state(state);
+        return ERR_MEMORY_ALLOCATION;
+    }
+    state->is_initialized = 1;
+    return ERR_SUCCESS;
+}
+
+/*
+ * Internal helper: aco_colonies_ensure
+ * Returns a set matching colony_count and the current topology, rebuilding it if needed,
+ * then copies the current parameters into every colony. Caller holds ctx->lock.
+ */
+static AcoColonySet* aco_colonies_ensure(AntNetContext* ctx)
+{
+    AcoV1State* main = &ctx->aco_v1;
+    AcoColonySet* set = main->colonies;
+    int count = main->colony_count;
+    if (count > ACO_MAX_COLONIES) {
+        count = ACO_MAX_COLONIES;
+    }
+
+    int path_capacity = (ctx->max_hops > 0 ? ctx->max_hops : 0) + 2;
+    if (set && (set->count != count || set->n != main->pheromone_size ||
+                set->path_capacity != path_capacity)) {
+        aco_v1_colonies_free(set);
+        main->colonies = NULL;
+        set = NULL;
+    }
+
+    if (!set) {
+        set = (AcoColonySet*)calloc(1, sizeof(AcoColonySet));
+        if (!set) {
+            return NULL;
+        }
+        set->count  = count;
+        set->n      = main->pheromone_size;
+        set->states = (AcoV1State*)calloc((size_t)count - 1, sizeof(AcoV1State));
+        set->best   = (AcoColonyBest*)calloc((size_t)count, sizeof(AcoColonyBest));
+        set->best_nodes = (int*)malloc((size_t)count * (size_t)path_capacity * sizeof(int));
+        if (!set->states || !set->best || !set->best_nodes) {
+            free(set->states);
+            free(set->best);
+            free(set->best_nodes);
+            free(set);
+            return NULL;
+        }
+        set->path_capacity = path_capacity;
+        for (int c = 0; c < count; c++) {
+            set->best[c].nodes = set->best_nodes + (size_t)c * (size_t)path_capacity;
+        }
+        for (int c = 1; c < count; c++) {
+            if (aco_colony_init_state(&set->states[c - 1], main) != ERR_SUCCESS) {
+                set->count = c; /* free only the colonies built so far */
+                aco_v1_colonies_free(set);
+                return NULL;
+            }
+        }
+        main->colonies = set;
+    }
+
+    for (int c = 1; c < count; c++) {
+        AcoV1State* state = &set->states[c - 1];
+        state->alpha             = main->alpha;
+        state->beta              = main->beta;
+        state->evaporation       = main->evaporation;
+        state->Q                 = main->Q;
+        state->construction_mode = main->construction_mode;
+        if (aco_v1_set_evaporation_mode(state, main->evaporation_mode) != ERR_SUCCESS ||
+            aco_v1_set_storage_mode(state, main->storage_mode) != ERR_SUCCESS) {
+            return NULL;
+        }
+    }
+    return set;
+}
+
+/*
+ * Internal helper: aco_colony_record_best
+ * Folds the ants' best paths into best, in ant order.
+ */
+static void aco_colony_record_best(AcoColonyBest* best, AcoThreadLocalData** locals, int count)
+{
+    for (int i = 0; i < count; i++) {
+        AcoThreadLocalData* tlocal = locals[i];
+        if (!tlocal || tlocal->best_length <= 0) {
+            continue;
+        }
+        if (best->length == 0 || tlocal->best_latency < best->latency) {
+            best->length  = tlocal->best_length;
+            best->latency = tlocal->best_latency;
+            memcpy(best->nodes, tlocal->best_path, sizeof(int) * (size_t)tlocal->best_length);
+        }
+    }
+}
+
+/*
+ * Internal function: aco_colony_task
+ * Worker pool task: builds every ant of colony c. Colonies >= 1 also apply their deltas
+ * here, to memory no other task touches. Colony 0 is merged afterwards under the lock.
+ */
+static void aco_colony_task(void* arg, int c)
+{
+    AcoColonyBatchArg* batch = (AcoColonyBatchArg*)arg;
+    AntNetContext* ctx = batch->ctx;
+    AcoV1State* state = aco_colony_state(ctx, batch->set, c);
+    AcoThreadLocalData** locals = batch->locals + batch->first_ant[c];
+    int ants = batch->first_ant[c + 1] - batch->first_ant[c];
+
+    if (c > 0 && state->construction_mode == ACO_CONSTRUCT_EDGE_WALK) {
+        aco_v1_edge_walk_refresh_choice_info(ctx, state);
+    }
+    for (int i = 0; i < ants; i++) {
+        aco_shared_build_ant(ctx, state, locals[i]);
+    }
+    if (c > 0) {
+        uint64_t merge_start = antnet_perf_now_ns();
+        aco_shared_apply_local(state, locals, ants);
+        antnet_perf_record(ctx, ANTNET_PERF_ACO_MERGE, merge_start);
+        aco_colony_record_best(&batch->set->best[c], locals, ants);
+    }
+}
+
+/*
+ * Internal function: aco_blend_task
+ * Worker pool task: for each owned row, mixes every colony toward the all-colony mean.
+ * Rows are handled ACO_STORAGE_CHUNK cells at a time on the stack, so 16-bit colonies
+ * convert through the same kernels as the merge.
+ */
+static void aco_blend_task(void* arg, int task_index)
+{
+    AcoBlendArg* blend = (AcoBlendArg*)arg;
+    int n = blend->states[0]->pheromone_size;
+    int row_begin = task_index * blend->rows_per_task;
+    int row_end   = row_begin + blend->rows_per_task;
+    if (row_end > n) {
+        row_end = n;
+    }
+
+    float mean[ACO_STORAGE_CHUNK];
+    float values[ACO_STORAGE_CHUNK];
+    double sums[ACO_MAX_COLONIES];
+    float w = ACO_COLONY_BLEND_WEIGHT;
+    float inv_count = 1.0f / (float)blend->count;
+
+    for (int r = row_begin; r < row_end; r++) {
+        size_t offset = (size_t)r * (size_t)n;
+        for (int c = 0; c < blend->count; c++) {
+            sums[c] = 0.0;
+        }
+        for (int k = 0; k < n; k += ACO_STORAGE_CHUNK) {
+            int chunk = (n - k < ACO_STORAGE_CHUNK) ? n - k : ACO_STORAGE_CHUNK;
+            size_t first = offset + (size_t)k;
+            for (int i = 0; i < chunk; i++) {
+                mean[i] = 0.0f;
+            }
+            for (int c = 0; c < blend->count; c++) {
+                aco_v1_load_cells(blend->states[c], first, chunk, values);
+                for (int i = 0; i < chunk; i++) {
+                    mean[i] += values[i];
+                }
+            }
+            for (int c = 0; c < blend->count; c++) {
+                aco_v1_load_cells(blend->states[c], first, chunk, values);
+                for (int i = 0; i < chunk; i++) {
+                    float v = (1.0f - w) * values[i] + w * mean[i] * inv_count;
+                    values[i] = (v < ACO_PHEROMONE_FLOOR) ? ACO_PHEROMONE_FLOOR : v;
+                }
+                sums[c] += aco_v1_store_cells(blend->states[c], first, chunk, values);
+            }
+        }
+        for (int c = 0; c < blend->count; c++) {
+            blend->states[c]->row_sums[r] = sums[c];
+        }
+    }
+}
+
+/*
+ * Internal helper: aco_colonies_migrate
+ * Runs the configured migration across all colonies. Caller holds ctx->lock.
+ */
+static void aco_colonies_migrate(AntNetContext* ctx, AcoColonySet* set, WorkerPool* pool)
+{
+    int count = set->count;
+
+    if (ctx->aco_v1.migration_mode == ACO_MIGRATE_BLEND) {
+        AcoV1State* states[ACO_MAX_COLONIES];
+        for (int c = 0; c < count; c++) {
+            states[c] = aco_colony_state(ctx, set, c);
+            /* Blending works on stored values: settle pending lazy evaporation first. */
+            aco_v1_materialize(states[c]);
+        }
+        int n = set->n;
+        int tasks = worker_pool_size(pool) * 4;
+        if (tasks < 1) {
+            tasks = 1;
+        }
+        if (tasks > n) {
+            tasks = n;
+        }
+        AcoBlendArg blend;
+        blend.states        = states;
+        blend.count         = count;
+        blend.rows_per_task = (n + tasks - 1) / tasks;
+        tasks = (n + blend.rows_per_task - 1) / blend.rows_per_task;
+        worker_pool_run(pool, tasks, aco_blend_task, &blend);
+        return;
+    }
+
+    /* Ring: colony c reinforces the best path of colony c-1, as an elitist ant would. */
+    for (int c = 0; c < count; c++) {
+        const AcoColonyBest* from = &set->best[(c + count - 1) % count];
+        if (from->length < 2 || from->latency <= 0) {
+            continue;
+        }
+        AcoV1State* state = aco_colony_state(ctx, set, c);
+        float deposit = state->Q / (float)from->latency;
+        for (int i = 0; i < from->length - 1; i++) {
+            int index = from->nodes[i] * state->pheromone_size + from->nodes[i + 1];
+            aco_v1_set_pheromone(state, index, aco_v1_get_pheromone(state, index) + deposit);
+        }
+    }
+}
+
+/*
+ * aco_v1_run_iteration_colonies
+ * ctx->aco_v1.num_ants is split over the colonies (at least one ant each). Ant i of
+ * colony c draws from stream (c << 32 | i) of the iteration seed, so runs replay
+ * exactly whatever the worker count.
+ */
+int aco_v1_run_iteration_colonies(AntNetContext* ctx)
+{
+    if (!ctx) {
+        return ERR_INVALID_CONTEXT;
+    }
+    if (ctx->aco_v1.pheromone_size <= 0) {
+        return ERR_NO_TOPOLOGY;
+    }
+
+    WorkerPool* pool = priv_get_worker_pool(ctx);
+    if (!pool) {
+        return ERR_MEMORY_ALLOCATION;
+    }
+
+#ifndef _WIN32
+    antnet_perf_lock_context(ctx);
+#endif
+    AcoColonySet* set = aco_colonies_ensure(ctx);
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+#endif
+    if (!set) {
+        return ERR_MEMORY_ALLOCATION;
+    }
+
+    int count = set->count;
+    int ants  = ctx->aco_v1.num_ants;
+    int max_deltas = (ctx->max_hops > 0 ? ctx->max_hops : 0) + 1;
+
+    int first_ant[ACO_MAX_COLONIES + 1];
+    first_ant[0] = 0;
+    for (int c = 0; c < count; c++) {
+        int share = ants / count + (c < ants % count ? 1 : 0);
+        first_ant[c + 1] = first_ant[c] + (share > 0 ? share : 1);
+    }
+    int total = first_ant[count];
+
+    AcoThreadLocalData** locals = (AcoThreadLocalData**)calloc((size_t)total, sizeof(AcoThreadLocalData*));
+    if (!locals) {
+        return ERR_MEMORY_ALLOCATION;
+    }
+    uint64_t iteration_seed = antnet_rng_next_u64(&ctx->aco_rng);
+    int rc = ERR_SUCCESS;
+    for (int c = 0; c < count && rc == ERR_SUCCESS; c++) {
+        for (int a = first_ant[c]; a < first_ant[c + 1]; a++) {
+            locals[a] = aco_shared_create_local_data(max_deltas);
+            if (!locals[a]) {
+                rc = ERR_MEMORY_ALLOCATION;
+                break;
+            }
+            uint64_t stream = ((uint64_t)c << 32) | (uint64_t)(a - first_ant[c]);
+            antnet_rng_seed_stream(&locals[a]->rng, iteration_seed, stream);
+        }
+    }
+
+    if (rc == ERR_SUCCESS) {
+        AcoColonyBatchArg batch;
+        batch.ctx       = ctx;
+        batch.set       = set;
+        batch.locals    = locals;
+        batch.first_ant = first_ant;
+        rc = worker_pool_run(pool, count, aco_colony_task, &batch);
+    }
+
+    /* Colony 0 is ctx->aco_v1: merged like the single-colony case, under the lock. */
+    if (rc == ERR_SUCCESS) {
+        rc = aco_shared_merge_deltas(ctx, locals, first_ant[1]);
+    }
+
+    if (rc == ERR_SUCCESS) {
+#ifndef _WIN32
+        antnet_perf_lock_context(ctx);
+#endif
+        aco_colony_record_best(&set->best[0], locals, first_ant[1]);
+        for (int c = 1; c < count; c++) {
+            const AcoColonyBest* best = &set->best[c];
+            if (best->length > 0 && best->length <= ctx->path_capacity &&
+                (ctx->aco_best_length == 0 || best->latency < ctx->aco_best_latency)) {
+                ctx->aco_best_length  = best->length;
+                ctx->aco_best_latency = best->latency;
+                memcpy(ctx->aco_best_nodes, best->nodes, sizeof(int) * (size_t)best->length);
+            }
+        }
+
+        set->iteration++;
+        int interval = ctx->aco_v1.migration_interval;
+        if (interval > 0 && set->iteration % interval == 0) {
+            aco_colonies_migrate(ctx, set, pool);
+        }
+#ifndef _WIN32
+        pthread_mutex_unlock(&ctx->lock);
+#endif
+    }
+
+    for (int a = 0; a < total; a++) {
+        aco_shared_free_local_data(locals[a]);
+    }
+    free(locals);
+    return rc;
+}
@@ -0,0 +1,162 @@
+/* Relative Path: src/c/algo/cpu/cpu_ACOv1_edge_walk.c */
+/*
+ * Implements edge-walking ants: CSR neighbour lists, the tau^alpha * eta^beta table,
+ * and the walk itself. powf is only called while refreshing the table, once per
+ * iteration, never per ant step.
+*/
+
+#include "../../../../include/algo/cpu/cpu_ACOv1_edge_walk.h"
+#include "../../../../include/algo/cpu/cpu_ACOv1.h"
+#include "../../../../include/core/backend_rng.h"
+#include "../../../../include/core/backend_perf.h"
+#include "../../../../include/consts/error_codes.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+int aco_v1_edge_walk_build_graph(AcoV1State* state)
+{
+    if (!state || !state->adjacency_bits || state->adjacency_size <= 0) {
+        return ERR_INVALID_ARGS;
+    }
+
+    int n = state->adjacency_size;
+    size_t edge_total = 0;
+    for (int i = 0; i < n; i++) {
+        const uint64_t* row = state->adjacency_bits + (size_t)i * (size_t)state->adjacency_words;
+        for (int j = 0; j < n; j++) {
+            if (i != j && ((row[j >> 6] >> (j & 63)) & 1u)) {
+                edge_total++;
+            }
+        }
+    }
+
+    state->nbr_offsets = (int*)malloc(((size_t)n + 1) * sizeof(int));
+    state->nbr_targets = (int*)malloc((edge_total + 1) * sizeof(int));
+    state->choice_info = (float*)malloc((edge_total + 1) * sizeof(float));
+    if (!state->nbr_offsets || !state->nbr_targets || !state->choice_info) {
+        free(state->nbr_offsets);
+        free(state->nbr_targets);
+        free(state->choice_info);
+        state->nbr_offsets = NULL;
+        state->nbr_targets = NULL;
+        state->choice_info = NULL;
+        return ERR_MEMORY_ALLOCATION;
+    }
+
+    int e = 0;
+    for (int i = 0; i < n; i++) {
+        state->nbr_offsets[i] = e;
+        const uint64_t* row = state->adjacency_bits + (size_t)i * (size_t)state->adjacency_words;
+        for (int j = 0; j < n; j++) {
+            if (i != j && ((row[j >> 6] >> (j & 63)) & 1u)) {
+                state->nbr_targets[e] = j;
+                state->choice_info[e] = 1.0f;
+                e++;
+            }
+        }
+    }
+    state->nbr_offsets[n] = e;
+
+    return ERR_SUCCESS;
+}
+
+void aco_v1_edge_walk_refresh_choice_info(AntNetContext* ctx, AcoV1State* state)
+{
+    if (!state->choice_info || !state->nbr_offsets) {
+        return;
+    }
+
+    int n = state->pheromone_size;
+    float alpha = state->alpha;
+    float beta  = state->beta;
+
+    /* eta^beta only depends on the target node: n powf calls instead of one per edge. */
+    float* eta_pow = (float*)malloc((size_t)n * sizeof(float));
+    if (!eta_pow) {
+        return; /* keep the previous table, still a valid distribution */
+    }
+    uint64_t weighting_start = antnet_perf_now_ns();
+    for (int j = 0; j < n; j++) {
+        int delay = (j < ctx->num_nodes) ? ctx->nodes[j].delay_ms : 1;
+        float eta = 1.0f / (float)(delay > 0 ? delay : 1);
+        eta_pow[j] = (beta == 1.0f) ? eta : powf(eta, beta);
+    }
+
+    for (int i = 0; i < n; i++) {
+        for (int e = state->nbr_offsets[i]; e < state->nbr_offsets[i + 1]; e++) {
+            int j = state->nbr_targets[e];
+            float tau = aco_v1_get_pheromone(state, i * n + j);
+            float tau_pow = (alpha == 1.0f) ? tau : powf(tau, alpha);
+            state->choice_info[e] = tau_pow * eta_pow[j];
+        }
+    }
+    antnet_perf_record(ctx, ANTNET_PERF_ACO_WEIGHTING, weighting_start);
+
+    free(eta_pow);
+}
+
+int aco_v1_edge_walk_construct(AntNetContext* ctx, const AcoV1State* state, AntNetRng* rng,
+                               int* out_path, int max_len, int* out_len)
+{
+    int n = state->pheromone_size;
+    if (!state->nbr_offsets || n < 2 || max_len < 2) {
+        return ERR_NO_PATH_FOUND;
+    }
+
+    unsigned char* visited = (unsigned char*)calloc((size_t)n, 1);
+    if (!visited) {
+        return ERR_MEMORY_ALLOCATION;
+    }
+
+    int len  = 0;
+    int hops = 0; /* intermediate nodes so far */
+    int cur  = 0;
+    out_path[len++] = 0;
+    visited[0] = 1;
+
+    int rc = ERR_NO_PATH_FOUND;
+    while (len < max_len) {
+        int begin = state->nbr_offsets[cur];
+        int end   = state->nbr_offsets[cur + 1];
+
+        /* Node 1 closes the tour once min_hops is met; others only while below max_hops. */
+        float total = 0.0f;
+        for (int e = begin; e < end; e++) {
+            int j = state->nbr_targets[e];
+            if (visited[j]) continue;
+            if (j == 1 ? (hops < ctx->min_hops) : (hops >= ctx->max_hops)) continue;
+            total += state->choice_info[e];
+        }
+        if (total <= 0.0f) {
+            break; /* dead end: the ant is lost */
+        }
+
+        float target = antnet_rng_next_float(rng) * total;
+        int next = -1;
+        for (int e = begin; e < end; e++) {
+            int j = state->nbr_targets[e];
+            if (visited[j]) continue;
+            if (j == 1 ? (hops < ctx->min_hops) : (hops >= ctx->max_hops)) continue;
+            next = j;
+            target -= state->choice_info[e];
+            if (target < 0.0f) {
+                break;
+            }
+        }
+
+        out_path[len++] = next;
+        if (next == 1) {
+            rc = ERR_SUCCESS;
+            break;
+        }
+        visited[next] = 1;
+        hops++;
+        cur = next;
+    }
+
+    free(visited);
+    *out_len = (rc == ERR_SUCCESS) ? len : 0;
+    return rc;
+}
@@ -0,0 +1,515 @@
+/* Relative Path: src/c/algo/cpu/cpu_ACOv1_kernels.c */
+/*
+ * Implements the ACO v1 pheromone kernels and 16-bit codecs with AVX2, SSE4.1 and scalar variants.
+ * The SIMD variants are compiled through function target attributes, so the library
+ * itself needs no -mavx2 and still loads on CPUs without it.
+*/
+
+#include "../../../../include/algo/cpu/cpu_ACOv1_kernels.h"
+#include "../../../../include/types/antnet_aco_v1_types.h"
+
+#include <stddef.h>
+#include <string.h>
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ACO_KERNELS_X86 1
+#include <immintrin.h>
+#else
+#define ACO_KERNELS_X86 0
+#endif
+
+/*
+ * Lane layout shared by every variant: element i is added to lane i % 4, lanes are
+ * combined as (l0 + l1) + (l2 + l3). Products and max() are exact IEEE single ops
+ * (no FMA), so the SIMD results match the scalar loop bit for bit.
+ */
+
+static double aco_kernel_evaporate_scalar(float* row, int count, float keep, float floor_value)
+{
+    double lane[4] = { 0.0, 0.0, 0.0, 0.0 };
+    for (int i = 0; i < count; i++) {
+        float v = row[i] * keep;
+        v = (v < floor_value) ? floor_value : v;
+        row[i] = v;
+        lane[i & 3] += (double)v;
+    }
+    return (lane[0] + lane[1]) + (lane[2] + lane[3]);
+}
+
+static double aco_kernel_sum_scalar(const float* row, int count)
+{
+    double lane[4] = { 0.0, 0.0, 0.0, 0.0 };
+    for (int i = 0; i < count; i++) {
+        lane[i & 3] += (double)row[i];
+    }
+    return (lane[0] + lane[1]) + (lane[2] + lane[3]);
+}
+
+/*
+ * 16-bit codes. FP16 is IEEE binary16 with round-to-nearest-even, as F16C does it.
+ * LOG16 is (float bits - bits(2^-20)) >> 13, rounded half up: 10 mantissa bits and a
+ * 6-bit exponent rebased at 2^-20, so plain integer ops encode and decode it.
+ */
+#define ACO_FP16_MAX         65504.0f
+#define ACO_LOG16_MIN        9.5367431640625e-7f /* 2^-20 */
+#define ACO_LOG16_BASE_BITS  0x35800000u         /* bits of 2^-20 */
+#define ACO_LOG16_MAX_DELTA  0x1FFFE000u         /* code 0xFFFF << 13 */
+
+static uint32_t aco_kernel_float_bits(float v)
+{
+    uint32_t u;
+    memcpy(&u, &v, sizeof(u));
+    return u;
+}
+
+static float aco_kernel_bits_float(uint32_t u)
+{
+    float v;
+    memcpy(&v, &u, sizeof(v));
+    return v;
+}
+
+static uint16_t aco_kernel_fp16_encode(float value)
+{
+    /* Same clamps, and NaN/-0 handling, as the max/min pair of the F16C path. */
+    value = (value > 0.0f) ? value : 0.0f;
+    value = (value < ACO_FP16_MAX) ? value : ACO_FP16_MAX;
+    uint32_t x = aco_kernel_float_bits(value);
+
+    if (x >= 0x38800000u) { /* normal half: rebias the exponent, round 13 dropped bits */
+        uint32_t h   = (x - 0x38000000u) >> 13;
+        uint32_t rem = x & 0x1FFFu;
+        if (rem > 0x1000u || (rem == 0x1000u && (h & 1u))) {
+            h++;
+        }
+        return (uint16_t)h;
+    }
+    if (x < 0x33000000u) { /* at most half the smallest subnormal */
+        return 0;
+    }
+    uint32_t shift   = 126u - (x >> 23);
+    uint32_t man     = (x & 0x7FFFFFu) | 0x800000u;
+    uint32_t h       = man >> shift;
+    uint32_t rem     = man & ((1u << shift) - 1u);
+    uint32_t halfway = 1u << (shift - 1u);
+    if (rem > halfway || (rem == halfway && (h & 1u))) {
+        h++;
+    }
+    return (uint16_t)h;
+}
+
+static float aco_kernel_fp16_decode(uint16_t code)
+{
+    uint32_t sign = (uint32_t)(code & 0x8000u) << 16;
+    uint32_t exp  = (code >> 10) & 0x1Fu;
+    uint32_t man  = code & 0x3FFu;
+    if (exp == 0) {
+        float v = (float)man * (1.0f / 16777216.0f); /* exact: man * 2^-24 */
+        return sign ? -v : v;
+    }
+    if (exp == 31) {
+        return aco_kernel_bits_float(sign | 0x7F800000u | (man << 13));
+    }
+    return aco_kernel_bits_float(sign | ((((uint32_t)code & 0x7FFFu) << 13) + 0x38000000u));
+}
+
+static uint16_t aco_kernel_log16_encode(float value)
+{
+    value = (value > ACO_LOG16_MIN) ? value : ACO_LOG16_MIN;
+    uint32_t d = aco_kernel_float_bits(value) - ACO_LOG16_BASE_BITS;
+    if (d > ACO_LOG16_MAX_DELTA) {
+        d = ACO_LOG16_MAX_DELTA;
+    }
+    return (uint16_t)((d + 0x1000u) >> 13);
+}
+
+static float aco_kernel_log16_decode(uint16_t code)
+{
+    return aco_kernel_bits_float(((uint32_t)code << 13) + ACO_LOG16_BASE_BITS);
+}
+
+uint16_t aco_kernel_encode_one(int format, float value)
+{
+    return (format == ACO_STORAGE_FP16) ? aco_kernel_fp16_encode(value)
+                                        : aco_kernel_log16_encode(value);
+}
+
+float aco_kernel_decode_one(int format, uint16_t code)
+{
+    return (format == ACO_STORAGE_FP16) ? aco_kernel_fp16_decode(code)
+                                        : aco_kernel_log16_decode(code);
+}
+
+static void aco_kernel_decode_scalar(int format, const uint16_t* in, float* out, int count)
+{
+    for (int i = 0; i < count; i++) {
+        out[i] = aco_kernel_decode_one(format, in[i]);
+    }
+}
+
+static double aco_kernel_encode_scalar(int format, const float* in, uint16_t* out, int count)
+{
+    double lane[4] = { 0.0, 0.0, 0.0, 0.0 };
+    for (int i = 0; i < count; i++) {
+        out[i] = aco_kernel_encode_one(format, in[i]);
+        lane[i & 3] += (double)aco_kernel_decode_one(format, out[i]);
+    }
+    return (lane[0] + lane[1]) + (lane[2] + lane[3]);
+}
+
+#if ACO_KERNELS_X86
+
+__attribute__((target("sse4.1")))
+static double aco_kernel_evaporate_sse41(float* row, int count, float keep, float floor_value)
+{
+    __m128  vkeep  = _mm_set1_ps(keep);
+    __m128  vfloor = _mm_set1_ps(floor_value);
+    __m128d acc01  = _mm_setzero_pd();
+    __m128d acc23  = _mm_setzero_pd();
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 v = _mm_mul_ps(_mm_loadu_ps(row + i), vkeep);
+        v = _mm_max_ps(v, vfloor);
+        _mm_storeu_ps(row + i, v);
+        acc01 = _mm_add_pd(acc01, _mm_cvtps_pd(v));
+        acc23 = _mm_add_pd(acc23, _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+    }
+
+    double lane[4];
+    _mm_storeu_pd(lane, acc01);
+    _mm_storeu_pd(lane + 2, acc23);
+    for (; i < count; i++) {
+        float v = row[i] * keep;
+        v = (v < floor_value) ? floor_value : v;
+        row[i] = v;
+        lane[i & 3] += (double)v;
+    }
+    return (lane[0] + lane[1]) + (lane[2] + lane[3]);
+}
+
+__attribute__((target("avx2")))
+static double aco_kernel_evaporate_avx2(float* row, int count, float keep, float floor_value)
+{
+    __m256  vkeep  = _mm256_set1_ps(keep);
+    __m256  vfloor = _mm256_set1_ps(floor_value);
+    __m256d acc    = _mm256_setzero_pd();
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 v = _mm256_mul_ps(_mm256_loadu_ps(row + i), vkeep);
+        v = _mm256_max_ps(v, vfloor);
+        _mm256_storeu_ps(row + i, v);
+        /* elements i..i+3 then i+4..i+7, both onto lanes 0..3, in that order */
+        acc = _mm256_add_pd(acc, _mm256_cvtps_pd(_mm256_castps256_ps128(v)));
+        acc = _mm256_add_pd(acc, _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1)));
+    }
+
+    double lane[4];
+    _mm256_storeu_pd(lane, acc);
+    for (; i < count; i++) {
+        float v = row[i] * keep;
+        v = (v < floor_value) ? floor_value : v;
+        row[i] = v;
+        lane[i & 3] += (double)v;
+    }
+    return (lane[0] + lane[1]) + (lane[2] + lane[3]);
+}
+
+__attribute__((target("avx2")))
+static double aco_kernel_sum_avx2(const float* row, int count)
+{
+    __m256d acc = _mm256_setzero_pd();
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 v = _mm256_loadu_ps(row + i);
+        acc = _mm256_add_pd(acc, _mm256_cvtps_pd(_mm256_castps256_ps128(v)));
+        acc = _mm256_add_pd(acc, _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1)));
+    }
+
+    double lane[4];
+    _mm256_storeu_pd(lane, acc);
+    for (; i < count; i++) {
+        lane[i & 3] += (double)row[i];
+    }
+    return (lane[0] + lane[1]) + (lane[2] + lane[3]);
+}
+
+__attribute__((target("sse4.1")))
+static void aco_kernel_log16_decode_sse41(const uint16_t* in, float* out, int count)
+{
+    __m128i base = _mm_set1_epi32((int)ACO_LOG16_BASE_BITS);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i code = _mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i*)(in + i)));
+        _mm_storeu_ps(out + i, _mm_castsi128_ps(_mm_add_epi32(_mm_slli_epi32(code, 13), base)));
+    }
+    for (; i < count; i++) {
+        out[i] = aco_kernel_log16_decode(in[i]);
+    }
+}
+
+__attribute__((target("sse4.1")))
+static double aco_kernel_log16_encode_sse41(const float* in, uint16_t* out, int count)
+{
+    __m128  vmin  = _mm_set1_ps(ACO_LOG16_MIN);
+    __m128i base  = _mm_set1_epi32((int)ACO_LOG16_BASE_BITS);
+    __m128i limit = _mm_set1_epi32((int)ACO_LOG16_MAX_DELTA);
+    __m128i half  = _mm_set1_epi32(0x1000);
+    __m128d acc01 = _mm_setzero_pd();
+    __m128d acc23 = _mm_setzero_pd();
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128  v    = _mm_max_ps(_mm_loadu_ps(in + i), vmin);
+        __m128i d    = _mm_min_epu32(_mm_sub_epi32(_mm_castps_si128(v), base), limit);
+        __m128i code = _mm_srli_epi32(_mm_add_epi32(d, half), 13);
+        _mm_storel_epi64((__m128i*)(out + i), _mm_packus_epi32(code, code));
+        __m128 stored = _mm_castsi128_ps(_mm_add_epi32(_mm_slli_epi32(code, 13), base));
+        acc01 = _mm_add_pd(acc01, _mm_cvtps_pd(stored));
+        acc23 = _mm_add_pd(acc23, _mm_cvtps_pd(_mm_movehl_ps(stored, stored)));
+    }
+
+    double lane[4];
+    _mm_storeu_pd(lane, acc01);
+    _mm_storeu_pd(lane + 2, acc23);
+    for (; i < count; i++) {
+        out[i] = aco_kernel_log16_encode(in[i]);
+        lane[i & 3] += (double)aco_kernel_log16_decode(out[i]);
+    }
+    return (lane[0] + lane[1]) + (lane[2] + lane[3]);
+}
+
+__attribute__((target("avx2")))
+static void aco_kernel_log16_decode_avx2(const uint16_t* in, float* out, int count)
+{
+    __m256i base = _mm256_set1_epi32((int)ACO_LOG16_BASE_BITS);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i code = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(in + i)));
+        _mm256_storeu_ps(out + i, _mm256_castsi256_ps(_mm256_add_epi32(_mm256_slli_epi32(code, 13), base)));
+    }
+    for (; i < count; i++) {
+        out[i] = aco_kernel_log16_decode(in[i]);
+    }
+}
+
+__attribute__((target("avx2")))
+static double aco_kernel_log16_encode_avx2(const float* in, uint16_t* out, int count)
+{
+    __m256  vmin  = _mm256_set1_ps(ACO_LOG16_MIN);
+    __m256i base  = _mm256_set1_epi32((int)ACO_LOG16_BASE_BITS);
+    __m256i limit = _mm256_set1_epi32((int)ACO_LOG16_MAX_DELTA);
+    __m256i half  = _mm256_set1_epi32(0x1000);
+    __m256d acc   = _mm256_setzero_pd();
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256  v    = _mm256_max_ps(_mm256_loadu_ps(in + i), vmin);
+        __m256i d    = _mm256_min_epu32(_mm256_sub_epi32(_mm256_castps_si256(v), base), limit);
+        __m256i code = _mm256_srli_epi32(_mm256_add_epi32(d, half), 13);
+        _mm_storeu_si128((__m128i*)(out + i),
+                         _mm_packus_epi32(_mm256_castsi256_si128(code), _mm256_extracti128_si256(code, 1)));
+        __m256 stored = _mm256_castsi256_ps(_mm256_add_epi32(_mm256_slli_epi32(code, 13), base));
+        acc = _mm256_add_pd(acc, _mm256_cvtps_pd(_mm256_castps256_ps128(stored)));
+        acc = _mm256_add_pd(acc, _mm256_cvtps_pd(_mm256_extractf128_ps(stored, 1)));
+    }
+
+    double lane[4];
+    _mm256_storeu_pd(lane, acc);
+    for (; i < count; i++) {
+        out[i] = aco_kernel_log16_encode(in[i]);
+        lane[i & 3] += (double)aco_kernel_log16_decode(out[i]);
+    }
+    return (lane[0] + lane[1]) + (lane[2] + lane[3]);
+}
+
+__attribute__((target("avx2,f16c")))
+static void aco_kernel_fp16_decode_f16c(const uint16_t* in, float* out, int count)
+{
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(in + i))));
+    }
+    for (; i < count; i++) {
+        out[i] = aco_kernel_fp16_decode(in[i]);
+    }
+}
+
+__attribute__((target("avx2,f16c")))
+static double aco_kernel_fp16_encode_f16c(const float* in, uint16_t* out, int count)
+{
+    __m256  vzero = _mm256_setzero_ps();
+    __m256  vmax  = _mm256_set1_ps(ACO_FP16_MAX);
+    __m256d acc   = _mm256_setzero_pd();
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256  v    = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(in + i), vzero), vmax);
+        __m128i code = _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128((__m128i*)(out + i), code);
+        __m256 stored = _mm256_cvtph_ps(code);
+        acc = _mm256_add_pd(acc, _mm256_cvtps_pd(_mm256_castps256_ps128(stored)));
+        acc = _mm256_add_pd(acc, _mm256_cvtps_pd(_mm256_extractf128_ps(stored, 1)));
+    }
+
+    double lane[4];
+    _mm256_storeu_pd(lane, acc);
+    for (; i < count; i++) {
+        out[i] = aco_kernel_fp16_encode(in[i]);
+        lane[i & 3] += (double)aco_kernel_fp16_decode(out[i]);
+    }
+    return (lane[0] + lane[1]) + (lane[2] + lane[3]);
+}
+
+#endif /* ACO_KERNELS_X86 */
+
+static int g_detected_isa = ACO_KERNEL_ISA_SCALAR;
+static int g_has_f16c     = 0;
+
+static void aco_kernel_detect_once(void)
+{
+#if ACO_KERNELS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        g_detected_isa = ACO_KERNEL_ISA_AVX2;
+        g_has_f16c     = __builtin_cpu_supports("f16c") ? 1 : 0;
+    } else if (__builtin_cpu_supports("sse4.1")) {
+        g_detected_isa = ACO_KERNEL_ISA_SSE41;
+    }
+#endif
+}
+
+int aco_kernel_detect_isa(void)
+{
+#ifndef _WIN32
+    static pthread_once_t once = PTHREAD_ONCE_INIT;
+    pthread_once(&once, aco_kernel_detect_once);
+#else
+    static int done = 0;
+    if (!done) {
+        aco_kernel_detect_once();
+        done = 1;
+    }
+#endif
+    return g_detected_isa;
+}
+
+const char* aco_kernel_isa_name(int isa)
+{
+    switch (isa) {
+        case ACO_KERNEL_ISA_AVX2:  return "avx2";
+        case ACO_KERNEL_ISA_SSE41: return "sse4.1";
+        default:                   return "scalar";
+    }
+}
+
+double aco_kernel_evaporate_row_isa(int isa, float* row, int count, float keep, float floor_value)
+{
+    if (!row || count <= 0) {
+        return 0.0;
+    }
+    int best = aco_kernel_detect_isa();
+    if (isa > best) {
+        isa = best;
+    }
+
+#if ACO_KERNELS_X86
+    if (isa == ACO_KERNEL_ISA_AVX2) {
+        return aco_kernel_evaporate_avx2(row, count, keep, floor_value);
+    }
+    if (isa == ACO_KERNEL_ISA_SSE41) {
+        return aco_kernel_evaporate_sse41(row, count, keep, floor_value);
+    }
+#else
+    (void)isa;
+#endif
+    return aco_kernel_evaporate_scalar(row, count, keep, floor_value);
+}
+
+double aco_kernel_evaporate_row(float* row, int count, float keep, float floor_value)
+{
+    return aco_kernel_evaporate_row_isa(aco_kernel_detect_isa(), row, count, keep, floor_value);
+}
+
+double aco_kernel_row_sum(const float* row, int count)
+{
+    if (!row || count <= 0) {
+        return 0.0;
+    }
+#if ACO_KERNELS_X86
+    if (aco_kernel_detect_isa() == ACO_KERNEL_ISA_AVX2) {
+        return aco_kernel_sum_avx2(row, count);
+    }
+#endif
+    return aco_kernel_sum_scalar(row, count);
+}
+
+void aco_kernel_decode_row_isa(int isa, int format, const uint16_t* in, float* out, int count)
+{
+    if (!in || !out || count <= 0) {
+        return;
+    }
+    int best = aco_kernel_detect_isa();
+    if (isa > best) {
+        isa = best;
+    }
+
+#if ACO_KERNELS_X86
+    if (format == ACO_STORAGE_FP16) {
+        if (isa == ACO_KERNEL_ISA_AVX2 && g_has_f16c) {
+            aco_kernel_fp16_decode_f16c(in, out, count);
+            return;
+        }
+    } else if (isa == ACO_KERNEL_ISA_AVX2) {
+        aco_kernel_log16_decode_avx2(in, out, count);
+        return;
+    } else if (isa == ACO_KERNEL_ISA_SSE41) {
+        aco_kernel_log16_decode_sse41(in, out, count);
+        return;
+    }
+#else
+    (void)isa;
+#endif
+    aco_kernel_decode_scalar(format, in, out, count);
+}
+
+double aco_kernel_encode_row_isa(int isa, int format, const float* in, uint16_t* out, int count)
+{
+    if (!in || !out || count <= 0) {
+        return 0.0;
+    }
+    int best = aco_kernel_detect_isa();
+    if (isa > best) {
+        isa = best;
+    }
+
+#if ACO_KERNELS_X86
+    if (format == ACO_STORAGE_FP16) {
+        if (isa == ACO_KERNEL_ISA_AVX2 && g_has_f16c) {
+            return aco_kernel_fp16_encode_f16c(in, out, count);
+        }
+    } else if (isa == ACO_KERNEL_ISA_AVX2) {
+        return aco_kernel_log16_encode_avx2(in, out, count);
+    } else if (isa == ACO_KERNEL_ISA_SSE41) {
+        return aco_kernel_log16_encode_sse41(in, out, count);
+    }
+#else
+    (void)isa;
+#endif
+    return aco_kernel_encode_scalar(format, in, out, count);
+}
+
+void aco_kernel_decode_row(int format, const uint16_t* in, float* out, int count)
+{
+    aco_kernel_decode_row_isa(aco_kernel_detect_isa(), format, in, out, count);
+}
+
+double aco_kernel_encode_row(int format, const float* in, uint16_t* out, int count)
+{
+    return aco_kernel_encode_row_isa(aco_kernel_detect_isa(), format, in, out, count);
+}
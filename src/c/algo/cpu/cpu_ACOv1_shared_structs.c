@@ -8,16 +8,25 @@
 
 #include "../../../../include/algo/cpu/cpu_ACOv1_shared_structs.h"
 #include "../../../../include/consts/error_codes.h"
+#include "../../../../include/algo/cpu/cpu_ACOv1.h"
+#include "../../../../include/algo/cpu/cpu_ACOv1_edge_walk.h"
+#include "../../../../include/algo/cpu/cpu_ACOv1_kernels.h"
+#include "../../../../include/core/backend_rng.h"
+#include "../../../../include/core/backend_init.h"
+#include "../../../../include/core/backend_worker_pool.h"
+#include "../../../../include/core/backend_perf.h"
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 
 /*
  * aco_shared_create_local_data
- * Allocates an array of float for the pheromone deltas plus best-path placeholders.
+ * Allocates the sparse (index, delta) arrays plus best-path placeholders.
+ * Nothing is zeroed beyond the struct itself: only delta_count entries are ever read.
  */
-AcoThreadLocalData *aco_shared_create_local_data(int pheromone_size)
+AcoThreadLocalData *aco_shared_create_local_data(int max_deltas)
 {
-    if (pheromone_size <= 0) {
+    if (max_deltas <= 0) {
         return NULL;
     }
 
@@ -27,14 +36,18 @@ AcoThreadLocalData *aco_shared_create_local_data(int pheromone_size)
     }
     memset(data, 0, sizeof(AcoThreadLocalData));
 
-    /* allocate local delta pheromone array (size = n*n) */
-    int total = pheromone_size * pheromone_size;
-    data->delta_pheromones = (float *)malloc(sizeof(float) * total);
-    if (!data->delta_pheromones) {
+    data->delta_index = (int *)malloc(sizeof(int) * (size_t)max_deltas);
+    data->delta_value = (float *)malloc(sizeof(float) * (size_t)max_deltas);
+    data->best_path   = (int *)malloc(sizeof(int) * ((size_t)max_deltas + 1));
+    if (!data->delta_index || !data->delta_value || !data->best_path) {
+        free(data->delta_index);
+        free(data->delta_value);
+        free(data->best_path);
         free(data);
         return NULL;
     }
-    memset(data->delta_pheromones, 0, sizeof(float) * total);
+    data->delta_count    = 0;
+    data->delta_capacity = max_deltas;
 
     data->best_length = 0;
     data->best_latency = 0;
@@ -49,18 +62,518 @@ AcoThreadLocalData *aco_shared_create_local_data(int pheromone_size)
 void aco_shared_free_local_data(AcoThreadLocalData *data)
 {
     if (!data) return;
-    if (data->delta_pheromones) {
-        free(data->delta_pheromones);
-        data->delta_pheromones = NULL;
+    if (data->delta_index) {
+        free(data->delta_index);
+        data->delta_index = NULL;
     }
+    if (data->delta_value) {
+        free(data->delta_value);
+        data->delta_value = NULL;
+    }
+    free(data->best_path);
+    data->best_path = NULL;
     free(data);
 }
 
+/*
+ * aco_shared_add_delta
+ * Records one pheromone increment for the edge at flat index 'index'.
+ */
+int aco_shared_add_delta(AcoThreadLocalData *data, int index, float delta)
+{
+    if (!data) {
+        return ERR_INVALID_ARGS;
+    }
+    if (data->delta_count >= data->delta_capacity) {
+        return ERR_ARRAY_TOO_SMALL;
+    }
+    data->delta_index[data->delta_count] = index;
+    data->delta_value[data->delta_count] = delta;
+    data->delta_count++;
+    return ERR_SUCCESS;
+}
+
+/*
+ * aco_shared_load_candidate_sampler
+ * Builds a sampler over node_list weighted by the cached pheromone row sums,
+ * floored at 1e-6 so no candidate becomes unreachable. Leaves nothing allocated on error.
+ */
+int aco_shared_load_candidate_sampler(const AcoV1State *state, const int *node_list,
+                                      int candidate_count, WeightedSampler *sampler)
+{
+    int rc = weighted_sampler_init(sampler, candidate_count > 0 ? candidate_count : 1);
+    if (rc != ERR_SUCCESS) {
+        return rc;
+    }
+    /* Stage the weights in the sampler's own array; build reads it in place. */
+    for (int c = 0; c < candidate_count; c++) {
+        /* Safe read from row_sums (no writer at the same time) */
+        double sum_pher = aco_v1_get_row_sum(state, node_list[c]);
+        sampler->weights[c] = (sum_pher < 1e-6) ? 1e-6 : sum_pher;
+    }
+    rc = weighted_sampler_build(sampler, sampler->weights, candidate_count);
+    if (rc != ERR_SUCCESS) {
+        weighted_sampler_free(sampler);
+    }
+    return rc;
+}
+
+/*
+ * Internal helper: aco_shared_construct_subset
+ * The original construction: draws min_hops..max_hops intermediate nodes weighted by
+ * node-level pheromone, without replacement, then shuffles them. Ignores adjacency.
+ */
+static int aco_shared_construct_subset(AntNetContext *ctx, const AcoV1State *state, AntNetRng *rng,
+                                       int *out_path, int max_len, int *out_len)
+{
+    int range_size = ctx->max_hops - ctx->min_hops + 1;
+    if (range_size <= 0) {
+        return ERR_INVALID_ARGS;
+    }
+    int candidate_count = ctx->num_nodes - 2; /* exclude node 0 & 1 from the subset */
+    if (candidate_count < 0) {
+        return ERR_NO_PATH_FOUND;
+    }
+
+    int nb_selected_nodes = ctx->min_hops + antnet_rng_next_int(rng, range_size);
+    if (nb_selected_nodes > candidate_count) {
+        nb_selected_nodes = candidate_count;
+    }
+    if (nb_selected_nodes + 2 > max_len) {
+        return ERR_ARRAY_TOO_SMALL;
+    }
+
+    int *node_list = (int *)malloc(((size_t)candidate_count + 1) * sizeof(int));
+    if (!node_list) {
+        return ERR_MEMORY_ALLOCATION;
+    }
+    int idx = 0;
+    for (int i = 0; i < ctx->num_nodes; i++) {
+        if (i != 0 && i != 1 && ANTNET_NODE_ENABLED(ctx, i)) {
+            node_list[idx++] = i;
+        }
+    }
+    /* Disabled nodes are not candidates. */
+    candidate_count = idx;
+    if (nb_selected_nodes > candidate_count) {
+        nb_selected_nodes = candidate_count;
+    }
+
+    /* weight of candidate node i: cached sum_{k} pheromones[i*n + k] */
+    WeightedSampler sampler;
+    uint64_t phase_start = antnet_perf_now_ns();
+    int rc = aco_shared_load_candidate_sampler(state, node_list, candidate_count, &sampler);
+    if (rc != ERR_SUCCESS) {
+        free(node_list);
+        return rc;
+    }
+    antnet_perf_record(ctx, ANTNET_PERF_ACO_WEIGHTING, phase_start);
+
+    /* Weighted draw without replacement, O(log n) per pick, straight into the path. */
+    phase_start = antnet_perf_now_ns();
+    int *chosen_nodes = out_path + 1;
+    int chosen_count = 0;
+    for (int pick = 0; pick < nb_selected_nodes; pick++) {
+        int chosen_index = weighted_sampler_draw(&sampler, antnet_rng_next_float(rng));
+        if (chosen_index < 0) {
+            break;
+        }
+        chosen_nodes[chosen_count++] = node_list[chosen_index];
+        weighted_sampler_remove(&sampler, chosen_index);
+    }
+    antnet_perf_record(ctx, ANTNET_PERF_ACO_SAMPLING, phase_start);
+
+    /* shuffle */
+    for (int i = chosen_count - 1; i > 0; i--) {
+        int j = antnet_rng_next_int(rng, i + 1);
+        int tmp = chosen_nodes[i];
+        chosen_nodes[i] = chosen_nodes[j];
+        chosen_nodes[j] = tmp;
+    }
+
+    weighted_sampler_free(&sampler);
+    free(node_list);
+
+    out_path[0] = 0;
+    out_path[chosen_count + 1] = 1;
+    *out_len = chosen_count + 2;
+    return ERR_SUCCESS;
+}
+
+/*
+ * aco_shared_construct_path
+ * Dispatches on the construction mode. Both single-ant and pool ants go through here,
+ * so the two run modes always build paths the same way.
+ */
+int aco_shared_construct_path(AntNetContext *ctx, const AcoV1State *state, AntNetRng *rng,
+                              int *out_path, int max_len, int *out_len)
+{
+    if (!ctx || !state || !rng || !out_path || !out_len) {
+        return ERR_INVALID_ARGS;
+    }
+    *out_len = 0;
+
+    /* An edge walk is one roulette draw per step, so all of it counts as sampling too. */
+    uint64_t start = antnet_perf_now_ns();
+    int rc;
+    if (state->construction_mode == ACO_CONSTRUCT_EDGE_WALK) {
+        rc = aco_v1_edge_walk_construct(ctx, state, rng, out_path, max_len, out_len);
+        antnet_perf_record(ctx, ANTNET_PERF_ACO_SAMPLING, start);
+    } else {
+        rc = aco_shared_construct_subset(ctx, state, rng, out_path, max_len, out_len);
+    }
+    antnet_perf_record(ctx, ANTNET_PERF_ACO_CONSTRUCT, start);
+    return rc;
+}
+
+/*
+ * aco_shared_build_ant
+ * Replicates the single-ant logic from aco_v1_run_iteration_single,
+ * but modifies nothing globally. Instead, it calculates the path
+ * (see aco_shared_construct_path), cost, and local pheromone deltas.
+ */
+int aco_shared_build_ant(AntNetContext *ctx, const AcoV1State *state, AcoThreadLocalData *local_data)
+{
+    /* Basic checks */
+    if (!ctx || !state || !local_data) {
+        return ERR_INVALID_ARGS;
+    }
+
+    int n = state->pheromone_size;
+    int max_len = (ctx->max_hops > 0 ? ctx->max_hops : 0) + 2;
+
+    int *new_path = (int *)malloc((size_t)max_len * sizeof(int));
+    if (!new_path) {
+        return ERR_MEMORY_ALLOCATION;
+    }
+    int new_path_length = 0;
+    int rc = aco_shared_construct_path(ctx, state, &local_data->rng, new_path, max_len, &new_path_length);
+    if (rc != ERR_SUCCESS) {
+        /* a lost edge-walking ant simply deposits nothing */
+        free(new_path);
+        return rc;
+    }
+
+    int cost_sum = 0;
+    for (int k = 0; k < new_path_length; k++) {
+        int node_id = new_path[k];
+        if (node_id < 0 || node_id >= ctx->num_nodes) {
+            free(new_path);
+            return ERR_NO_PATH_FOUND;
+        }
+        if (ctx->nodes[node_id].delay_ms > INT_MAX - cost_sum) {
+            free(new_path);
+            return ERR_INVALID_ARGS;
+        }
+        cost_sum += ctx->nodes[node_id].delay_ms;
+    }
+
+    /* store best path in local_data if better or if none yet */
+    if (new_path_length <= local_data->delta_capacity + 1 &&
+        (local_data->best_length == 0 || cost_sum < local_data->best_latency)) {
+        local_data->best_length  = new_path_length;
+        local_data->best_latency = cost_sum;
+        memcpy(local_data->best_path, new_path, (size_t)new_path_length * sizeof(int));
+    }
+
+    /* Prepare local pheromone deltas for edges in the new path
+     * newVal = oldVal*(1-evap) + Q/cost, so delta = newVal - oldVal = -oldVal*evap + Q/cost.
+     * In global and lazy modes the merge evaporates every cell itself, so the delta is Q/cost only.
+     */
+    int   global_evap = (state->evaporation_mode != ACO_EVAPORATE_PATH);
+    float evap = state->evaporation;
+    float Q    = state->Q;
+
+    for (int i = 0; i < new_path_length - 1; i++) {
+        int from = new_path[i];
+        int to   = new_path[i + 1];
+        int index = from * n + to;
+
+        float delta;
+        if (global_evap) {
+            delta = Q / (float)cost_sum;
+        } else {
+            float oldVal = aco_v1_get_pheromone(state, index);
+            float newVal = oldVal * (1.0f - evap) + (Q / (float)cost_sum);
+            delta = newVal - oldVal;
+        }
+        if (aco_shared_add_delta(local_data, index, delta) != ERR_SUCCESS) {
+            free(new_path);
+            return ERR_ARRAY_TOO_SMALL;
+        }
+    }
+
+    free(new_path);
+    return ERR_SUCCESS;
+}
+
+/*
+ * AcoMergeArg
+ * One merge batch on the worker pool: task t owns the pheromone rows
+ * [t*rows_per_task, (t+1)*rows_per_task), so no two tasks write the same cell or row sum.
+ * bucket_start[t]..bucket_start[t+1] indexes task t's deltas in bucket_index/bucket_value;
+ * bucket_start is NULL when the buckets could not be allocated and tasks scan every delta.
+ */
+typedef struct AcoMergeArg
+{
+    AcoV1State          *state;
+    AcoThreadLocalData **thread_locals;
+    int                  count;
+    int                  rows_per_task;
+    int                  evaporate;
+    const int           *bucket_start;
+    const int           *bucket_index;
+    const float         *bucket_value;
+} AcoMergeArg;
+
+/*
+ * Internal helper: aco_shared_evaporate_rows
+ * Evaporates rows [row_begin, row_end) and refreshes their row sums.
+ */
+static void aco_shared_evaporate_rows(AcoV1State *state, int row_begin, int row_end)
+{
+    float keep = 1.0f - state->evaporation;
+    for (int r = row_begin; r < row_end; r++) {
+        state->row_sums[r] = aco_v1_evaporate_row(state, r, keep);
+    }
+}
+
+/*
+ * Internal helper: aco_shared_merge_rows
+ * Evaporates rows [row_begin, row_end) if requested, then adds every delta falling in
+ * those rows. Deltas are visited in ant order, so each cell sums its increments in the
+ * same order whatever the partition, and results do not depend on the thread count.
+ */
+static void aco_shared_merge_rows(AcoV1State *state, AcoThreadLocalData **thread_locals,
+                                  int count, int row_begin, int row_end, int evaporate)
+{
+    int n = state->pheromone_size;
+
+    if (evaporate) {
+        aco_shared_evaporate_rows(state, row_begin, row_end);
+    }
+
+    int first = row_begin * n;
+    int last  = row_end * n;
+    for (int i = 0; i < count; i++) {
+        AcoThreadLocalData *tlocal = thread_locals[i];
+        if (!tlocal) continue;
+
+        for (int k = 0; k < tlocal->delta_count; k++) {
+            int j = tlocal->delta_index[k];
+            if (j < first || j >= last) {
+                continue;
+            }
+            aco_v1_set_pheromone(state, j, aco_v1_get_pheromone(state, j) + tlocal->delta_value[k]);
+        }
+    }
+}
+
+/*
+ * Internal helper: aco_shared_bucket_deltas
+ * Stable counting sort of all deltas by owning task: one count pass, a prefix sum, then
+ * a scatter in ant order. Each bucket keeps the order aco_shared_merge_rows would visit,
+ * so the sums are bit-identical to the serial merge. total must be positive. Returns
+ * ERR_MEMORY_ALLOCATION on failure with nothing left allocated.
+ */
+static int aco_shared_bucket_deltas(AcoMergeArg *merge, int tasks, int total,
+                                    int **out_start, int **out_index, float **out_value)
+{
+    int n = merge->state->pheromone_size;
+    int *start  = calloc((size_t)tasks + 1, sizeof(int));
+    int *cursor = malloc((size_t)tasks * sizeof(int));
+    int *index  = malloc((size_t)total * sizeof(int));
+    float *value = malloc((size_t)total * sizeof(float));
+    if (!start || !cursor || !index || !value) {
+        free(start);
+        free(cursor);
+        free(index);
+        free(value);
+        return ERR_MEMORY_ALLOCATION;
+    }
+
+    for (int i = 0; i < merge->count; i++) {
+        AcoThreadLocalData *tlocal = merge->thread_locals[i];
+        if (!tlocal) continue;
+        for (int k = 0; k < tlocal->delta_count; k++) {
+            start[(tlocal->delta_index[k] / n) / merge->rows_per_task + 1]++;
+        }
+    }
+    for (int t = 0; t < tasks; t++) {
+        start[t + 1] += start[t];
+    }
+
+    memcpy(cursor, start, (size_t)tasks * sizeof(int));
+    for (int i = 0; i < merge->count; i++) {
+        AcoThreadLocalData *tlocal = merge->thread_locals[i];
+        if (!tlocal) continue;
+        for (int k = 0; k < tlocal->delta_count; k++) {
+            int t = (tlocal->delta_index[k] / n) / merge->rows_per_task;
+            int slot = cursor[t]++;
+            index[slot] = tlocal->delta_index[k];
+            value[slot] = tlocal->delta_value[k];
+        }
+    }
+    free(cursor);
+
+    *out_start = start;
+    *out_index = index;
+    *out_value = value;
+    return ERR_SUCCESS;
+}
+
+/*
+ * Internal function: aco_merge_task
+ * Worker pool task merging its row range: evaporation, then its own delta bucket.
+ */
+static void aco_merge_task(void *arg, int task_index)
+{
+    AcoMergeArg *merge = (AcoMergeArg *)arg;
+    int n = merge->state->pheromone_size;
+    int row_begin = task_index * merge->rows_per_task;
+    int row_end   = row_begin + merge->rows_per_task;
+    if (row_end > n) {
+        row_end = n;
+    }
+    if (!merge->bucket_start) {
+        aco_shared_merge_rows(merge->state, merge->thread_locals, merge->count,
+                              row_begin, row_end, merge->evaporate);
+        return;
+    }
+
+    if (merge->evaporate) {
+        aco_shared_evaporate_rows(merge->state, row_begin, row_end);
+    }
+    for (int s = merge->bucket_start[task_index]; s < merge->bucket_start[task_index + 1]; s++) {
+        int j = merge->bucket_index[s];
+        aco_v1_set_pheromone(merge->state, j,
+                             aco_v1_get_pheromone(merge->state, j) + merge->bucket_value[s]);
+    }
+}
+
+/*
+ * Internal helper: aco_shared_apply
+ * Runs the merge (and the global sweep when evaporate is set) over all rows.
+ * Small batches stay on the calling thread: waking the pool costs more than adding
+ * a few hundred deltas. Caller holds ctx->lock; pool workers never take it.
+ */
+static void aco_shared_apply(AntNetContext *ctx, WorkerPool *pool,
+                             AcoThreadLocalData **thread_locals, int count, int evaporate)
+{
+    int n = ctx->aco_v1.pheromone_size;
+
+    long deltas = 0;
+    for (int i = 0; i < count; i++) {
+        if (thread_locals[i]) {
+            deltas += thread_locals[i]->delta_count;
+        }
+    }
+    long work = deltas;
+    if (evaporate) {
+        work += (long)n * (long)n;
+    }
+
+    int threads = worker_pool_size(pool);
+    if (threads <= 1 || work < ACO_MERGE_PARALLEL_MIN_CELLS) {
+        aco_shared_merge_rows(&ctx->aco_v1, thread_locals, count, 0, n, evaporate);
+        return;
+    }
+
+    /* A few row ranges per thread so a slow worker does not hold up the batch. */
+    int tasks = threads * 4;
+    if (tasks > n) {
+        tasks = n;
+    }
+    AcoMergeArg merge;
+    merge.state         = &ctx->aco_v1;
+    merge.thread_locals = thread_locals;
+    merge.count         = count;
+    merge.rows_per_task = (n + tasks - 1) / tasks;
+    merge.evaporate     = evaporate;
+    merge.bucket_start  = NULL;
+    merge.bucket_index  = NULL;
+    merge.bucket_value  = NULL;
+    tasks = (n + merge.rows_per_task - 1) / merge.rows_per_task;
+
+    /*
+     * Bucket the deltas once so each task touches only its own: scanning the full list
+     * per task is O(tasks * deltas). On allocation failure tasks fall back to the scan.
+     */
+    int *bucket_start = NULL;
+    int *bucket_index = NULL;
+    float *bucket_value = NULL;
+    if (deltas > 0 &&
+        aco_shared_bucket_deltas(&merge, tasks, (int)deltas,
+                                 &bucket_start, &bucket_index, &bucket_value) == ERR_SUCCESS) {
+        merge.bucket_start = bucket_start;
+        merge.bucket_index = bucket_index;
+        merge.bucket_value = bucket_value;
+    }
+
+    worker_pool_run(pool, tasks, aco_merge_task, &merge);
+
+    free(bucket_start);
+    free(bucket_index);
+    free(bucket_value);
+}
+
+/*
+ * aco_shared_apply_local
+ * Same steps as aco_shared_merge_deltas, on the calling thread and without the lock.
+ */
+int aco_shared_apply_local(AcoV1State *state, AcoThreadLocalData **thread_locals, int count)
+{
+    if (!aco_v1_has_pheromones(state)) {
+        return ERR_NO_TOPOLOGY;
+    }
+    if (state->evaporation_mode == ACO_EVAPORATE_LAZY) {
+        int rc = aco_v1_lazy_advance(state);
+        if (rc != ERR_SUCCESS) {
+            return rc;
+        }
+    }
+    aco_shared_merge_rows(state, thread_locals, count, 0, state->pheromone_size,
+                          state->evaporation_mode == ACO_EVAPORATE_GLOBAL);
+    return ERR_SUCCESS;
+}
+
+/*
+ * aco_shared_evaporate_global
+ * Global sweep with no deposits, for the single-ant path.
+ */
+int aco_shared_evaporate_global(AntNetContext *ctx)
+{
+    if (!ctx) {
+        return ERR_INVALID_ARGS;
+    }
+    WorkerPool *pool = priv_get_worker_pool(ctx);
+
+#ifndef _WIN32
+    antnet_perf_lock_context(ctx);
+#endif
+    if (!aco_v1_has_pheromones(&ctx->aco_v1)) {
+#ifndef _WIN32
+        pthread_mutex_unlock(&ctx->lock);
+#endif
+        return ERR_NO_TOPOLOGY;
+    }
+    aco_shared_apply(ctx, pool, NULL, 0, 1);
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+#endif
+
+    return ERR_SUCCESS;
+}
+
 /*
  * aco_shared_merge_deltas
- * Sums each thread's delta_pheromones into the global ctx->aco_v1.pheromones.
+ * Sums each thread's sparse deltas into the global ctx->aco_v1.pheromones.
+ * Cost is O(total path length) rather than O(ants * n*n); per-entry summation order
+ * (ant 0 first) matches the former dense walk, so results are unchanged.
+ * In ACO_EVAPORATE_GLOBAL mode the same pass first evaporates each row range;
+ * in ACO_EVAPORATE_LAZY mode the clock advances and only touched cells are updated.
  * Also updates global best path if the thread's path is better.
- * Thread-safe with a single lock for the entire merge process.
+ * Runs under ctx->lock; the row ranges are spread over the worker pool.
  */
 int aco_shared_merge_deltas(AntNetContext *ctx, AcoThreadLocalData **thread_locals, int count)
 {
@@ -68,44 +581,54 @@ int aco_shared_merge_deltas(AntNetContext *ctx, AcoThreadLocalData **thread_loca
         return ERR_INVALID_ARGS;
     }
 
+    /* Fetched before locking: priv_get_worker_pool takes ctx->lock itself. */
+    WorkerPool *pool = priv_get_worker_pool(ctx);
+
 #ifndef _WIN32
-    pthread_mutex_lock(&ctx->lock);
+    antnet_perf_lock_context(ctx);
 #endif
 
+    uint64_t merge_start = antnet_perf_now_ns();
+
     /* verify basic environment */
-    if (!ctx->aco_v1.pheromones || ctx->aco_v1.pheromone_size <= 0) {
+    if (!aco_v1_has_pheromones(&ctx->aco_v1)) {
 #ifndef _WIN32
         pthread_mutex_unlock(&ctx->lock);
 #endif
         return ERR_NO_TOPOLOGY;
     }
 
-    int n = ctx->aco_v1.pheromone_size;
-    int total = n * n;
+    /* Lazy mode: one clock tick evaporates every cell, deposits then land on top. */
+    if (ctx->aco_v1.evaporation_mode == ACO_EVAPORATE_LAZY) {
+        int rc = aco_v1_lazy_advance(&ctx->aco_v1);
+        if (rc != ERR_SUCCESS) {
+#ifndef _WIN32
+            pthread_mutex_unlock(&ctx->lock);
+#endif
+            return rc;
+        }
+    }
 
     /* accumulate deltas */
+    aco_shared_apply(ctx, pool, thread_locals, count,
+                     ctx->aco_v1.evaporation_mode == ACO_EVAPORATE_GLOBAL);
+
     for (int i = 0; i < count; i++) {
         AcoThreadLocalData *tlocal = thread_locals[i];
         if (!tlocal) continue;
 
-        for (int j = 0; j < total; j++) {
-            ctx->aco_v1.pheromones[j] += tlocal->delta_pheromones[j];
-            if (ctx->aco_v1.pheromones[j] < 1e-6f) {
-                ctx->aco_v1.pheromones[j] = 1e-6f;
-            }
-        }
-
         /* check if the thread found a better path */
         if (tlocal->best_length > 0) {
             int lat = tlocal->best_latency;
-            if (ctx->aco_best_length == 0 || lat < ctx->aco_best_latency) {
+            if (tlocal->best_length <= ctx->path_capacity &&
+                (ctx->aco_best_length == 0 || lat < ctx->aco_best_latency)) {
                 ctx->aco_best_length = tlocal->best_length;
                 ctx->aco_best_latency = lat;
-                memset(ctx->aco_best_nodes, 0, sizeof(ctx->aco_best_nodes));
                 memcpy(ctx->aco_best_nodes, tlocal->best_path, sizeof(int) * tlocal->best_length);
             }
         }
     }
+    antnet_perf_record(ctx, ANTNET_PERF_ACO_MERGE, merge_start);
 
 #ifndef _WIN32
     pthread_mutex_unlock(&ctx->lock);
@@ -2,13 +2,19 @@
 /*
  * Explores all possible node combinations and permutations incrementally.
  * Updates the global best brute-force path when a lower-latency route is found.
- * Implements a "one path per call" mechanism for demonstration or exact enumeration.
+ * Permutation mode tests one path per call; branch-and-bound modes prune combinations in budgeted
+ * batches, sequentially here or over rank ranges (cpu_brute_force_parallel.c).
 */
 
 #include "../../../../include/algo/cpu/cpu_brute_force.h"
+#include "../../../../include/algo/cpu/cpu_brute_force_parallel.h"
 #include "../../../../include/consts/error_codes.h"
+#include "../../../../include/core/backend_init.h"
+#include "../../../../include/core/backend_log.h"
+#include <stdlib.h>
 #include <string.h>
 #include <limits.h>
+#include <time.h>
 //#include <stdio.h>
 
 static int next_permutation(int *array, int length) {
@@ -47,12 +53,105 @@ static int next_combination(int *comb, int k, int n) {
     return 1;
 }
 
+/*
+ * Internal helper: compare_by_key
+ * qsort order of delay << 32 | id keys: cheapest first, lower id on ties.
+ */
+static int compare_by_key(const void* a, const void* b) {
+    long long x = *(const long long*)a;
+    long long y = *(const long long*)b;
+    return (x > y) - (x < y);
+}
+
+/*
+ * Internal helper: branch_bound_prepare
+ * Sorts the candidates by delay and builds their prefix sums, so the cheapest way to
+ * finish any partial combination is one subtraction. The sort keys are staged in
+ * bb_prefix[1..count], each read just before its slot receives the prefix sum.
+ */
+static void branch_bound_prepare(AntNetContext* ctx) {
+    BruteForceState* st = &ctx->brute_state;
+    long long* keys = st->bb_prefix + 1;
+
+    for (int i = 0; i < st->candidate_count; i++) {
+        int id = st->candidate_nodes[i];
+        keys[i] = ((long long)ctx->nodes[id].delay_ms << 32) | id;
+    }
+    qsort(keys, (size_t)st->candidate_count, sizeof(long long), compare_by_key);
+
+    st->bb_prefix[0] = 0;
+    for (int i = 0; i < st->candidate_count; i++) {
+        long long key = keys[i];
+        st->candidate_nodes[i] = (int)(key & 0xffffffffLL);
+        st->bb_prefix[i + 1] = st->bb_prefix[i] + (key >> 32);
+    }
+}
+
+int brute_force_reserve(AntNetContext* ctx, int num_nodes) {
+    BruteForceState* st = &ctx->brute_state;
+    int candidates = (num_nodes > 0) ? num_nodes : 0;
+    int hops = (ctx->max_hops > 0) ? ctx->max_hops : 0;
+    if (hops > candidates)
+        hops = candidates; /* a combination never outgrows the candidate list */
+    if (st->candidate_nodes && candidates == st->candidate_capacity && hops == st->hop_capacity)
+        return ERR_SUCCESS;
+
+    int* cand         = (int*)malloc(((size_t)candidates + 1) * sizeof(int));
+    int* perm         = (int*)malloc(((size_t)candidates + 1) * sizeof(int));
+    long long* prefix = (long long*)malloc(((size_t)candidates + 1) * sizeof(long long));
+    int* comb         = (int*)malloc(((size_t)hops + 1) * sizeof(int));
+    long long* part   = (long long*)malloc(((size_t)hops + 1) * sizeof(long long));
+    int* par          = (int*)malloc(((size_t)hops + 1) * BRUTE_PARALLEL_RANGES * sizeof(int));
+    if (!cand || !perm || !prefix || !comb || !part || !par) {
+        free(cand);
+        free(perm);
+        free(prefix);
+        free(comb);
+        free(part);
+        free(par);
+        return ERR_MEMORY_ALLOCATION;
+    }
+
+    brute_force_free_buffers(st);
+    st->candidate_nodes    = cand;
+    st->permutation        = perm;
+    st->bb_prefix          = prefix;
+    st->combination        = comb;
+    st->bb_partial         = part;
+    st->par_comb           = par;
+    st->candidate_capacity = candidates;
+    st->hop_capacity       = hops;
+    st->candidate_count    = 0;
+    return ERR_SUCCESS;
+}
+
+void brute_force_free_buffers(BruteForceState* st) {
+    if (!st) return;
+    free(st->candidate_nodes);
+    free(st->permutation);
+    free(st->bb_prefix);
+    free(st->combination);
+    free(st->bb_partial);
+    free(st->par_comb);
+    st->candidate_nodes = NULL;
+    st->permutation     = NULL;
+    st->bb_prefix       = NULL;
+    st->combination     = NULL;
+    st->bb_partial      = NULL;
+    st->par_comb        = NULL;
+    st->candidate_capacity = 0;
+    st->hop_capacity       = 0;
+    st->candidate_count    = 0;
+}
+
 void brute_force_reset_state(AntNetContext* ctx) {
     if (!ctx) return;
 
+    /* Without buffers (no topology yet) the enumeration is simply empty. */
     int start_id = 0, end_id = 1, count = 0;
-    for (int i = 0; i < ctx->num_nodes; i++)
-        if (i != start_id && i != end_id)
+    int capacity = ctx->brute_state.candidate_capacity;
+    for (int i = 0; i < ctx->num_nodes && count < capacity; i++)
+        if (i != start_id && i != end_id && ANTNET_NODE_ENABLED(ctx, i))
             ctx->brute_state.candidate_nodes[count++] = i;
 
     ctx->brute_state.candidate_count = count;
@@ -64,28 +163,25 @@ void brute_force_reset_state(AntNetContext* ctx) {
     for (int i = 0; i < count; i++)
         ctx->brute_state.permutation[i] = i;
 
-    for (int i = 0; i < ctx->max_hops; i++)
+    for (int i = 0; i < ctx->brute_state.hop_capacity; i++)
         ctx->brute_state.combination[i] = i;
-}
-
-int brute_force_search_step(
-    AntNetContext* ctx,
-    int start_id,
-    int end_id,
-    int* out_nodes,
-    int max_size,
-    int* out_path_len,
-    int* out_total_latency
-) {
-    if (!ctx || !out_nodes || !out_path_len || !out_total_latency)
-        return ERR_INVALID_ARGS;
 
-    if (ctx->num_nodes <= 0 || !ctx->nodes)
-        return ERR_NO_TOPOLOGY;
-
-    if (ctx->brute_state.done)
-        goto COPY_BEST_AND_EXIT;
+    ctx->brute_state.bb_depth = 0;
+    ctx->brute_state.bb_best = -1;
+    ctx->brute_state.evaluated = 0;
+    ctx->brute_state.par_L = -1;
+    ctx->brute_state.par_ranges = 0;
+    if (ctx->brute_state.mode != BRUTE_MODE_PERMUTATION && ctx->nodes && capacity > 0)
+        branch_bound_prepare(ctx);
+    ctx->brute_state.signature = brute_parallel_signature(ctx);
+}
 
+/*
+ * Internal helper: permutation_next
+ * Evaluates the next ordering of the current combination (original one-path-per-call order).
+ * Returns 1 after evaluating a path, 0 once every length is exhausted, or a negative error.
+ */
+static int permutation_next(AntNetContext* ctx, int start_id, int end_id, int max_size) {
     int candidate_count = ctx->brute_state.candidate_count;
 
     while (ctx->brute_state.current_L <= ctx->max_hops) {
@@ -115,27 +211,26 @@ int brute_force_search_step(
             }
 
             int path_length = L + 2;
-            if (path_length > max_size || path_length > 1024)
+            if (path_length > max_size || path_length > ctx->path_capacity)
                 return ERR_ARRAY_TOO_SMALL;
 
-            int temp_path[1024];
-            temp_path[0] = start_id;
+            const int* perm = ctx->brute_state.permutation;
+            int latency_sum = ctx->nodes[start_id].delay_ms + ctx->nodes[end_id].delay_ms;
             for (int i = 0; i < L; i++)
-                temp_path[i + 1] = ctx->brute_state.candidate_nodes[ctx->brute_state.permutation[i]];
-            temp_path[path_length - 1] = end_id;
-
-            int latency_sum = 0;
-            for (int p = 0; p < path_length; p++)
-                latency_sum += ctx->nodes[temp_path[p]].delay_ms;
+                latency_sum += ctx->nodes[ctx->brute_state.candidate_nodes[perm[i]]].delay_ms;
 
             if (ctx->brute_best_length == 0 || latency_sum < ctx->brute_best_latency) {
+                int* path = ctx->brute_best_nodes;
+                path[0] = start_id;
+                for (int i = 0; i < L; i++)
+                    path[i + 1] = ctx->brute_state.candidate_nodes[perm[i]];
+                path[path_length - 1] = end_id;
                 ctx->brute_best_length = path_length;
                 ctx->brute_best_latency = latency_sum;
-                memcpy(ctx->brute_best_nodes, temp_path, sizeof(int) * path_length);
-                //printf("[DEBUG][BF] 🎯 New best path! Latency improved: %d\n", latency_sum);
+                ANTNET_LOGD(priv_get_context_id(ctx), "[BF] New best path, latency %d", latency_sum);
             }
 
-            goto COPY_BEST_AND_EXIT; // TEST ONE PATH PER CALL!
+            return 1; // TEST ONE PATH PER CALL!
         }
 
         if (!next_combination(ctx->brute_state.combination, L, candidate_count)) {
@@ -145,8 +240,179 @@ int brute_force_search_step(
     }
 
     ctx->brute_state.done = 1;
+    return 0;
+}
+
+/*
+ * Internal helper: branch_bound_record
+ * Stores the complete combination combination[0..L-1] as this pass's incumbent and, if it
+ * beats it, as the context's best path (intermediate nodes in ascending id order).
+ */
+static int branch_bound_record(AntNetContext* ctx, int start_id, int end_id, int max_size,
+                               int L, long long latency) {
+    BruteForceState* st = &ctx->brute_state;
+    st->bb_best = latency;
+    if ((ctx->brute_best_length != 0 && latency >= ctx->brute_best_latency) || latency > INT_MAX)
+        return ERR_SUCCESS;
+
+    int path_length = L + 2;
+    if (path_length > max_size || path_length > ctx->path_capacity)
+        return ERR_ARRAY_TOO_SMALL;
+
+    int* temp_path = ctx->brute_best_nodes;
+    temp_path[0] = start_id;
+    for (int i = 0; i < L; i++) {
+        int v = st->candidate_nodes[st->combination[i]];
+        int j = i;
+        while (j > 0 && temp_path[j] > v) {
+            temp_path[j + 1] = temp_path[j];
+            j--;
+        }
+        temp_path[j + 1] = v;
+    }
+    temp_path[path_length - 1] = end_id;
+
+    ctx->brute_best_length = path_length;
+    ctx->brute_best_latency = (int)latency;
+    return ERR_SUCCESS;
+}
+
+/*
+ * Internal helper: branch_bound_next
+ * Visits one node of the combination tree for the current length. With candidates sorted
+ * by delay, partial + the next 'need' delays bounds every completion; once it reaches the
+ * incumbent, the later siblings bound higher still, so the whole level is cut.
+ * Returns 1 after a visit, 0 once every length is exhausted, or a negative error.
+ */
+static int branch_bound_next(AntNetContext* ctx, int start_id, int end_id, int max_size) {
+    BruteForceState* st = &ctx->brute_state;
+
+    while (st->current_L <= ctx->max_hops) {
+        int L = st->current_L;
+        if (L > st->candidate_count) {
+            st->current_L++;
+            st->at_first_combination = 1;
+            continue;
+        }
+        if (st->at_first_combination) {
+            st->bb_depth = 0;
+            st->combination[0] = 0;
+            st->bb_partial[0] = (long long)ctx->nodes[start_id].delay_ms + ctx->nodes[end_id].delay_ms;
+            st->at_first_combination = 0;
+        }
+
+        int d = st->bb_depth;
+        int descend = 0;
+        if (d == L) {
+            if (st->bb_best < 0 || st->bb_partial[L] < st->bb_best) {
+                int rc = branch_bound_record(ctx, start_id, end_id, max_size, L, st->bb_partial[L]);
+                if (rc != ERR_SUCCESS)
+                    return rc;
+            }
+        } else {
+            int i = st->combination[d];
+            int need = L - d;
+            if (i <= st->candidate_count - need) {
+                long long bound = st->bb_partial[d] + st->bb_prefix[i + need] - st->bb_prefix[i];
+                descend = (st->bb_best < 0 || bound < st->bb_best);
+            }
+            if (descend) {
+                st->bb_partial[d + 1] = st->bb_partial[d] + (st->bb_prefix[i + 1] - st->bb_prefix[i]);
+                st->combination[d + 1] = i + 1;
+                st->bb_depth = d + 1;
+            }
+        }
+
+        if (!descend) {
+            if (d == 0) {
+                st->current_L++;
+                st->at_first_combination = 1;
+            } else {
+                st->bb_depth = d - 1;
+                st->combination[d - 1]++;
+            }
+        }
+        return 1;
+    }
+
+    st->done = 1;
+    return 0;
+}
+
+long long brute_force_clock_us(void) {
+#if !defined(_WIN32) && defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0)
+        return (long long)ts.tv_sec * 1000000LL + ts.tv_nsec / 1000;
+#endif
+    return (long long)((double)clock() * 1000000.0 / CLOCKS_PER_SEC);
+}
+
+int brute_force_search_budget(
+    AntNetContext* ctx,
+    int start_id,
+    int end_id,
+    int* out_nodes,
+    int max_size,
+    int* out_path_len,
+    int* out_total_latency,
+    int max_candidates,
+    int time_budget_us
+) {
+    if (!ctx || !out_nodes || !out_path_len || !out_total_latency)
+        return ERR_INVALID_ARGS;
+
+    if (ctx->num_nodes <= 0 || !ctx->nodes)
+        return ERR_NO_TOPOLOGY;
+
+    if (max_candidates <= 0 && time_budget_us <= 0)
+        max_candidates = BRUTE_DEFAULT_STEP_CANDIDATES;
+
+    long long deadline = (time_budget_us > 0) ? brute_force_clock_us() + time_budget_us : 0;
+    int visited = 0;
+    int next_clock_check = 64;
+
+    while (!ctx->brute_state.done) {
+        if (max_candidates > 0 && visited >= max_candidates)
+            break;
+        /* reading the clock costs more than a visit: check it every 64 */
+        if (deadline && visited >= next_clock_check) {
+            if (brute_force_clock_us() >= deadline)
+                break;
+            next_clock_check = visited + 64;
+        }
+
+        if (ctx->brute_state.mode == BRUTE_MODE_PARALLEL) {
+            int used = 0;
+            int remaining = (max_candidates > 0) ? max_candidates - visited : 0;
+            int rc = brute_parallel_step(ctx, start_id, end_id, max_size, remaining, deadline, &used);
+            if (rc < 0)
+                return rc;
+            if (rc > 0) {
+                visited += used;
+                ctx->brute_state.evaluated += used;
+                if (deadline && brute_force_clock_us() >= deadline)
+                    break;
+                continue;
+            }
+            /* rc == 0: this length has too many combinations to rank, walk it sequentially */
+        }
+
+        int rc = (ctx->brute_state.mode == BRUTE_MODE_PERMUTATION)
+                     ? permutation_next(ctx, start_id, end_id, max_size)
+                     : branch_bound_next(ctx, start_id, end_id, max_size);
+        if (rc < 0)
+            return rc;
+        if (rc == 0)
+            break;
+        visited++;
+        ctx->brute_state.evaluated++;
+    }
+
+    /* The best path may predate this caller, e.g. restored from a checkpoint. */
+    if (ctx->brute_best_length > max_size)
+        return ERR_ARRAY_TOO_SMALL;
 
-COPY_BEST_AND_EXIT:
     memcpy(out_nodes, ctx->brute_best_nodes, ctx->brute_best_length * sizeof(int));
     *out_path_len = ctx->brute_best_length;
     *out_total_latency = ctx->brute_best_latency;
@@ -158,3 +424,26 @@ COPY_BEST_AND_EXIT:
 
     return ERR_SUCCESS;
 }
+
+int brute_force_search_step(
+    AntNetContext* ctx,
+    int start_id,
+    int end_id,
+    int* out_nodes,
+    int max_size,
+    int* out_path_len,
+    int* out_total_latency
+) {
+    if (!ctx)
+        return ERR_INVALID_ARGS;
+
+    /* The permutation mode keeps its one-path-per-call pace; branch and bound runs a batch. */
+    if (ctx->brute_state.mode != BRUTE_MODE_PERMUTATION)
+        return brute_force_search_budget(ctx, start_id, end_id, out_nodes, max_size,
+                                         out_path_len, out_total_latency,
+                                         ctx->brute_state.step_candidates,
+                                         ctx->brute_state.step_time_us);
+
+    return brute_force_search_budget(ctx, start_id, end_id, out_nodes, max_size,
+                                     out_path_len, out_total_latency, 1, 0);
+}
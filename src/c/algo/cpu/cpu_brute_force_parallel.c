@@ -0,0 +1,406 @@
+/* Relative Path: src/c/algo/cpu/cpu_brute_force_parallel.c */
+/*
+ * Implements the parallel branch-and-bound brute force over rank ranges of combinations.
+ * A range's cursor is just a rank: the combination is rebuilt by unranking, and a pruned
+ * prefix skips the rank to the end of its block. Ranges prune against the incumbent of
+ * the batch plus their own best, so results depend on the budgets only, not on threads.
+*/
+
+#include "../../../../include/algo/cpu/cpu_brute_force_parallel.h"
+#include "../../../../include/algo/cpu/cpu_brute_force.h"
+#include "../../../../include/core/backend_init.h"
+#include "../../../../include/core/backend_worker_pool.h"
+#include "../../../../include/consts/error_codes.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+/* Largest C(n, L) split into ranks; leaves headroom so rank + 1 never overflows. */
+#define BRUTE_RANK_LIMIT (1ULL << 62)
+
+/*
+ * BruteParallelBatch
+ * Shared argument of one pool batch. binom[n * stride + k] = C(n, k), saturated.
+ * Task k advances range k and writes only its own cursor, best and visited slots.
+ */
+typedef struct BruteParallelBatch
+{
+    AntNetContext*  ctx;
+    const uint64_t* binom;
+    int             stride;
+    int             L;
+    int             count;
+    long long       base;       /* latency of start and end */
+    long long       incumbent;  /* pass incumbent when the batch started, -1 if none */
+    int             per_range;  /* candidates per range, 0 = no limit */
+    long long       deadline;   /* brute_force_clock_us time, 0 = none */
+    int             visited[BRUTE_PARALLEL_RANGES];
+} BruteParallelBatch;
+
+/*
+ * Internal helper: choose_fits
+ * Computes C(n, k) into *out if it does not exceed BRUTE_RANK_LIMIT. Returns 0 otherwise.
+ */
+static int choose_fits(int n, int k, uint64_t* out)
+{
+    if (k < 0 || k > n) {
+        *out = 0;
+        return 1;
+    }
+    if (k > n - k) {
+        k = n - k;
+    }
+    uint64_t c = 1;
+    for (int i = 1; i <= k; i++) {
+        uint64_t factor = (uint64_t)(n - k + i);
+        if (c > BRUTE_RANK_LIMIT / factor) {
+            return 0;
+        }
+        c = c * factor / (uint64_t)i; /* exact: c * factor is C(n-k+i, i) * i */
+    }
+    *out = c;
+    return c <= BRUTE_RANK_LIMIT;
+}
+
+/*
+ * Internal helper: binom_table
+ * Pascal's triangle up to n = count, k = L, saturating at UINT64_MAX.
+ */
+static uint64_t* binom_table(int count, int L)
+{
+    int stride = L + 1;
+    uint64_t* t = (uint64_t*)calloc(((size_t)count + 1) * (size_t)stride, sizeof(uint64_t));
+    if (!t) {
+        return NULL;
+    }
+    for (int n = 0; n <= count; n++) {
+        t[(size_t)n * stride] = 1;
+        for (int k = 1; k <= L && k <= n; k++) {
+            uint64_t a = t[(size_t)(n - 1) * stride + k - 1];
+            uint64_t b = t[(size_t)(n - 1) * stride + k];
+            t[(size_t)n * stride + k] = (a > UINT64_MAX - b) ? UINT64_MAX : a + b;
+        }
+    }
+    return t;
+}
+
+static uint64_t binom_at(const BruteParallelBatch* b, int n, int k)
+{
+    return (n < 0 || k < 0 || k > n) ? 0 : b->binom[(size_t)n * b->stride + k];
+}
+
+/*
+ * Internal helper: unrank
+ * Writes the combination of rank r (lexicographic over positions 0..count-1) into comb.
+ */
+static void unrank(const BruteParallelBatch* b, uint64_t r, int* comb)
+{
+    int x = 0;
+    for (int k = 0; k < b->L; k++) {
+        for (;;) {
+            uint64_t c = binom_at(b, b->count - x - 1, b->L - k - 1);
+            if (r < c) {
+                break;
+            }
+            r -= c;
+            x++;
+        }
+        comb[k] = x++;
+    }
+}
+
+/* Internal helper: rank, the inverse of unrank. */
+static uint64_t rank_of(const BruteParallelBatch* b, const int* comb)
+{
+    uint64_t r = 0;
+    int x = 0;
+    for (int k = 0; k < b->L; k++) {
+        for (int j = x; j < comb[k]; j++) {
+            r += binom_at(b, b->count - j - 1, b->L - k - 1);
+        }
+        x = comb[k] + 1;
+    }
+    return r;
+}
+
+/* Lexicographic successor, as in cpu_brute_force.c; k >= 1. */
+static int next_combination(int* comb, int k, int n)
+{
+    int i = k - 1;
+    comb[i]++;
+    while (i >= 0 && comb[i] >= n - k + 1 + i) {
+        i--;
+        if (i >= 0) comb[i]++;
+    }
+    if (i < 0) return 0;
+    for (i++; i < k; i++)
+        comb[i] = comb[i - 1] + 1;
+    return 1;
+}
+
+/*
+ * Internal function: brute_range_task
+ * Worker pool task: walks range 'index' from its cursor. For each combination the
+ * prefix bound is checked depth by depth; a failure at depth d cuts every later
+ * combination sharing comb[0..d-1] (delays are sorted, so larger comb[d] only bound
+ * higher), and at depth 0 it cuts the rest of the range.
+ */
+static void brute_range_task(void* arg, int index)
+{
+    BruteParallelBatch* b = (BruteParallelBatch*)arg;
+    BruteForceState* st = &b->ctx->brute_state;
+    const long long* prefix = st->bb_prefix;
+    const int L = b->L;
+
+    uint64_t next = st->par_next[index];
+    uint64_t end  = st->par_end[index];
+    long long inc = b->incumbent;
+    if (st->par_best[index] >= 0 && (inc < 0 || st->par_best[index] < inc)) {
+        inc = st->par_best[index];
+    }
+
+    int* comb = st->par_comb + (size_t)index * (size_t)st->hop_capacity;
+    if (next < end) {
+        unrank(b, next, comb);
+    }
+
+    int visited = 0;
+    while (next < end) {
+        if (b->per_range > 0 && visited >= b->per_range) {
+            break;
+        }
+        if (b->deadline && visited > 0 && (visited & 63) == 0 && brute_force_clock_us() >= b->deadline) {
+            break;
+        }
+        visited++;
+
+        long long partial = b->base;
+        int cut = -1;
+        for (int d = 0; d < L; d++) {
+            int i = comb[d];
+            int need = L - d;
+            if (inc >= 0 && partial + prefix[i + need] - prefix[i] >= inc) {
+                cut = d;
+                break;
+            }
+            partial += prefix[i + 1] - prefix[i];
+        }
+
+        if (cut < 0) {
+            if (inc < 0 || partial < inc) {
+                inc = partial;
+                st->par_best[index]      = partial;
+                st->par_best_rank[index] = next;
+            }
+            next++;
+            if (next < end && L > 0) {
+                next_combination(comb, L, b->count);
+            }
+        } else if (cut == 0) {
+            next = end;
+        } else {
+            /* Jump past the last combination of the block with prefix comb[0..cut-1]. */
+            for (int d = cut; d < L; d++) {
+                comb[d] = b->count - L + d;
+            }
+            next = rank_of(b, comb) + 1;
+            if (next < end) {
+                next_combination(comb, L, b->count);
+            }
+        }
+    }
+
+    st->par_next[index] = (next < end) ? next : end;
+    b->visited[index] = visited;
+}
+
+int brute_parallel_split(AntNetContext* ctx, int L)
+{
+    BruteForceState* st = &ctx->brute_state;
+    uint64_t total = 0;
+    st->par_L = L;
+    st->par_ranges = 0;
+    if (!choose_fits(st->candidate_count, L, &total)) {
+        return 0;
+    }
+
+    int ranges = (total < BRUTE_PARALLEL_RANGES) ? (int)total : BRUTE_PARALLEL_RANGES;
+    uint64_t q = (ranges > 0) ? total / (uint64_t)ranges : 0;
+    uint64_t rem = (ranges > 0) ? total % (uint64_t)ranges : 0;
+    uint64_t lo = 0;
+    for (int k = 0; k < ranges; k++) {
+        uint64_t len = q + ((uint64_t)k < rem ? 1 : 0);
+        st->par_next[k]      = lo;
+        st->par_end[k]       = lo + len;
+        st->par_best[k]      = -1;
+        st->par_best_rank[k] = 0;
+        lo += len;
+    }
+    st->par_ranges = ranges;
+    return 1;
+}
+
+/*
+ * Internal helper: brute_parallel_merge
+ * Takes the cheapest range best (lowest range on ties) as the pass incumbent and,
+ * if it beats it, as ctx->brute_best_* with nodes in ascending id order.
+ */
+static int brute_parallel_merge(const BruteParallelBatch* b, int start_id, int end_id, int max_size)
+{
+    AntNetContext* ctx = b->ctx;
+    BruteForceState* st = &ctx->brute_state;
+
+    int best = -1;
+    for (int k = 0; k < st->par_ranges; k++) {
+        if (st->par_best[k] >= 0 && (best < 0 || st->par_best[k] < st->par_best[best])) {
+            best = k;
+        }
+    }
+    if (best < 0) {
+        return ERR_SUCCESS;
+    }
+    long long latency = st->par_best[best];
+    if (st->bb_best >= 0 && latency >= st->bb_best) {
+        return ERR_SUCCESS;
+    }
+    st->bb_best = latency;
+    if ((ctx->brute_best_length != 0 && latency >= ctx->brute_best_latency) || latency > INT_MAX) {
+        return ERR_SUCCESS;
+    }
+
+    int path_length = b->L + 2;
+    if (path_length > max_size || path_length > ctx->path_capacity) {
+        return ERR_ARRAY_TOO_SMALL;
+    }
+    /* The ranges have finished, so the first range's scratch is free. */
+    int* comb = st->par_comb;
+    int* temp_path = ctx->brute_best_nodes;
+    unrank(b, st->par_best_rank[best], comb);
+    temp_path[0] = start_id;
+    for (int i = 0; i < b->L; i++) {
+        int v = st->candidate_nodes[comb[i]];
+        int j = i;
+        while (j > 0 && temp_path[j] > v) {
+            temp_path[j + 1] = temp_path[j];
+            j--;
+        }
+        temp_path[j + 1] = v;
+    }
+    temp_path[path_length - 1] = end_id;
+
+    ctx->brute_best_length  = path_length;
+    ctx->brute_best_latency = (int)latency;
+    return ERR_SUCCESS;
+}
+
+int brute_parallel_step(AntNetContext* ctx, int start_id, int end_id, int max_size,
+                        int max_candidates, long long deadline_us, int* out_visited)
+{
+    BruteForceState* st = &ctx->brute_state;
+    *out_visited = 0;
+
+    int L = st->current_L;
+    if (L > ctx->max_hops) {
+        st->done = 1;
+        return 1;
+    }
+    if (st->par_L != L && !brute_parallel_split(ctx, L)) {
+        return 0;
+    }
+    if (st->par_ranges == 0) {
+        if (L <= st->candidate_count) {
+            return 0; /* too many ranks: the sequential cursor owns this length */
+        }
+        st->current_L++;
+        st->at_first_combination = 1;
+        return 1;
+    }
+
+    int active = 0;
+    for (int k = 0; k < st->par_ranges; k++) {
+        active += (st->par_next[k] < st->par_end[k]);
+    }
+
+    int rc = ERR_SUCCESS;
+    if (active > 0) {
+        BruteParallelBatch batch;
+        memset(&batch, 0, sizeof(batch));
+        batch.ctx       = ctx;
+        batch.stride    = L + 1;
+        batch.L         = L;
+        batch.count     = st->candidate_count;
+        batch.base      = (long long)ctx->nodes[start_id].delay_ms + ctx->nodes[end_id].delay_ms;
+        batch.incumbent = st->bb_best;
+        batch.deadline  = deadline_us;
+        if (max_candidates > 0) {
+            batch.per_range = max_candidates / active;
+            if (batch.per_range < 1) {
+                batch.per_range = 1;
+            }
+        }
+
+        uint64_t* binom = binom_table(batch.count, L);
+        if (!binom) {
+            return ERR_MEMORY_ALLOCATION;
+        }
+        batch.binom = binom;
+
+        WorkerPool* pool = priv_get_worker_pool(ctx);
+        if (pool) {
+            rc = worker_pool_run(pool, st->par_ranges, brute_range_task, &batch);
+        } else {
+            for (int k = 0; k < st->par_ranges; k++) {
+                brute_range_task(&batch, k);
+            }
+        }
+        if (rc == ERR_SUCCESS) {
+            rc = brute_parallel_merge(&batch, start_id, end_id, max_size);
+        }
+        free(binom);
+
+        for (int k = 0; k < st->par_ranges; k++) {
+            *out_visited += batch.visited[k];
+        }
+        if (rc != ERR_SUCCESS) {
+            return rc;
+        }
+    }
+
+    int finished = 1;
+    for (int k = 0; k < st->par_ranges; k++) {
+        if (st->par_next[k] < st->par_end[k]) {
+            finished = 0;
+            break;
+        }
+    }
+    if (finished) {
+        st->current_L++;
+        st->at_first_combination = 1;
+        if (st->current_L > ctx->max_hops) {
+            st->done = 1;
+        }
+    }
+    return 1;
+}
+
+uint64_t brute_parallel_signature(const AntNetContext* ctx)
+{
+    /* FNV-1a over 32-bit words */
+    uint64_t h = 0xcbf29ce484222325ULL;
+#define BRUTE_SIG_MIX(v) do { h ^= (uint64_t)(uint32_t)(v); h *= 0x100000001b3ULL; } while (0)
+    const BruteForceState* st = &ctx->brute_state;
+    BRUTE_SIG_MIX(ctx->min_hops);
+    BRUTE_SIG_MIX(ctx->max_hops);
+    BRUTE_SIG_MIX(st->candidate_count);
+    if (ctx->nodes && ctx->num_nodes >= 2) {
+        BRUTE_SIG_MIX(ctx->nodes[0].delay_ms);
+        BRUTE_SIG_MIX(ctx->nodes[1].delay_ms);
+        for (int i = 0; i < st->candidate_count; i++) {
+            BRUTE_SIG_MIX(st->candidate_nodes[i]);
+            BRUTE_SIG_MIX(ctx->nodes[st->candidate_nodes[i]].delay_ms);
+        }
+    }
+#undef BRUTE_SIG_MIX
+    return h;
+}
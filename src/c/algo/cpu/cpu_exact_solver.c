@@ -0,0 +1,368 @@
+/* Relative Path: src/c/algo/cpu/cpu_exact_solver.c */
+/*
+ * Computes the exact minimum-latency route for the current topology, once per change.
+ * Subset mode sorts candidates by delay; edge mode runs a branch and bound over simple
+ * paths, bounded by a layered walk DP over the edge list.
+*/
+
+#include "../../../../include/algo/cpu/cpu_exact_solver.h"
+#include "../../../../include/consts/error_codes.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#define EXACT_INF LLONG_MAX
+
+int exact_solver_mode(const AntNetContext* ctx)
+{
+    return (ctx->aco_v1.construction_mode == ACO_CONSTRUCT_EDGE_WALK) ? EXACT_MODE_EDGES
+                                                                      : EXACT_MODE_SUBSET;
+}
+
+/*
+ * Internal helper: exact_compare_by_delay
+ * qsort order of (delay, id) pairs: cheapest first, lower id on ties.
+ */
+static int exact_compare_by_delay(const void* a, const void* b)
+{
+    const int* x = (const int*)a;
+    const int* y = (const int*)b;
+    if (x[0] != y[0]) {
+        return (x[0] < y[0]) ? -1 : 1;
+    }
+    return (x[1] < y[1]) ? -1 : (x[1] > y[1]);
+}
+
+/*
+ * Internal helper: exact_solve_subset
+ * Delays are non-negative, so the optimum uses exactly min_hops intermediate nodes:
+ * the min_hops cheapest candidates, or every candidate when there are fewer. They are
+ * stored in ascending id order.
+ */
+static int exact_solve_subset(AntNetContext* ctx, int* path, int* length, long long* cost)
+{
+    int hops = ctx->min_hops;
+    int* pairs = (int*)malloc(((size_t)ctx->num_nodes + 1) * 2 * sizeof(int));
+    if (!pairs) {
+        return ERR_MEMORY_ALLOCATION;
+    }
+    int count = 0;
+    for (int i = 2; i < ctx->num_nodes; i++) {
+        if (ANTNET_NODE_ENABLED(ctx, i)) {
+            pairs[2 * count]     = ctx->nodes[i].delay_ms;
+            pairs[2 * count + 1] = i;
+            count++;
+        }
+    }
+    /* Too few candidates: use them all, as the ACO, random and brute-force solvers do. */
+    if (hops > count) {
+        hops = count;
+    }
+    qsort(pairs, (size_t)count, 2 * sizeof(int), exact_compare_by_delay);
+
+    long long sum = (long long)ctx->nodes[0].delay_ms + ctx->nodes[1].delay_ms;
+    for (int k = 0; k < hops; k++) {
+        path[k + 1] = pairs[2 * k + 1];
+        sum += pairs[2 * k];
+    }
+    free(pairs);
+
+    /* ascending ids, the order the other subset solvers display */
+    for (int i = 2; i <= hops; i++) {
+        int v = path[i];
+        int j = i - 1;
+        while (j >= 1 && path[j] > v) {
+            path[j + 1] = path[j];
+            j--;
+        }
+        path[j + 1] = v;
+    }
+    path[0] = 0;
+    path[hops + 1] = 1;
+    *length = hops + 2;
+    *cost = sum;
+    return ERR_SUCCESS;
+}
+
+/*
+ * Internal helper: exact_build_adjacency
+ * Undirected adjacency of the enabled nodes in CSR form, each list sorted by (delay, id)
+ * so the search meets cheap routes first, with duplicate edges dropped. Node 0 is left
+ * out of every list: no route re-enters it.
+ */
+static int exact_build_adjacency(const AntNetContext* ctx, int** out_offsets, int** out_adj)
+{
+    int n = ctx->num_nodes;
+    int* offsets = (int*)calloc((size_t)n + 1, sizeof(int));
+    int* adj = (int*)malloc(((size_t)ctx->num_edges * 2 + 1) * sizeof(int));
+    int* fill = (int*)malloc(((size_t)n + 1) * sizeof(int));
+    int* pairs = (int*)malloc(((size_t)ctx->num_edges * 2 + 1) * 2 * sizeof(int));
+    if (!offsets || !adj || !fill || !pairs) {
+        free(offsets);
+        free(adj);
+        free(fill);
+        free(pairs);
+        return ERR_MEMORY_ALLOCATION;
+    }
+
+    for (int pass = 0; pass < 2; pass++) {
+        for (int e = 0; e < ctx->num_edges; e++) {
+            int a = ctx->edges[e].from_id;
+            int b = ctx->edges[e].to_id;
+            if (a < 0 || a >= n || b < 0 || b >= n || a == b ||
+                !ANTNET_NODE_ENABLED(ctx, a) || !ANTNET_NODE_ENABLED(ctx, b)) {
+                continue;
+            }
+            for (int side = 0; side < 2; side++) {
+                int u = side ? b : a;
+                int v = side ? a : b;
+                if (v == 0) {
+                    continue;
+                }
+                if (pass == 0) {
+                    offsets[u + 1]++;
+                } else {
+                    adj[fill[u]++] = v;
+                }
+            }
+        }
+        if (pass == 0) {
+            for (int v = 0; v < n; v++) {
+                offsets[v + 1] += offsets[v];
+                fill[v] = offsets[v];
+            }
+        }
+    }
+
+    /* Sort each list and compact the lists in place as duplicates are dropped. */
+    int kept = 0;
+    for (int u = 0; u < n; u++) {
+        int count = offsets[u + 1] - offsets[u];
+        const int* list = adj + offsets[u];
+        for (int i = 0; i < count; i++) {
+            pairs[2 * i]     = ctx->nodes[list[i]].delay_ms;
+            pairs[2 * i + 1] = list[i];
+        }
+        qsort(pairs, (size_t)count, 2 * sizeof(int), exact_compare_by_delay);
+        offsets[u] = kept;
+        for (int i = 0; i < count; i++) {
+            if (i == 0 || pairs[2 * i + 1] != pairs[2 * i - 1]) {
+                adj[kept++] = pairs[2 * i + 1];
+            }
+        }
+    }
+    offsets[n] = kept;
+    free(fill);
+    free(pairs);
+    *out_offsets = offsets;
+    *out_adj = adj;
+    return ERR_SUCCESS;
+}
+
+/*
+ * Internal helper: exact_solve_edges
+ * Branch and bound over simple paths 0 -> 1 along edges. A backward layered DP first
+ * gives, per node v and edge count r, the cheapest walk from v to 1 in exactly r edges
+ * (nodes after v only). Walks relax simple paths, so the cheapest one over the edge
+ * counts a route may still use bounds every extension; from node 0 over the whole hop
+ * range it is the cheapest walk overall, reported as *bound. Finding a simple path with
+ * a hop floor is NP-hard in general: the search is exponential in the worst case, when
+ * min_hops forces long detours, but the bound keeps usual hop ranges fast.
+ */
+static int exact_solve_edges(AntNetContext* ctx, int* path, int* length, long long* cost,
+                             long long* bound)
+{
+    int n = ctx->num_nodes;
+    int max_edges = ctx->max_hops + 1;
+    /* a simple route visits each node once, so it has at most n - 1 edges */
+    int steps = (max_edges < n) ? max_edges : n - 1;
+    *cost  = EXACT_INF;
+    *bound = EXACT_INF;
+    if (steps < 1) {
+        return ERR_NO_PATH_FOUND;
+    }
+
+    int* offsets = NULL;
+    int* adj = NULL;
+    int rc = exact_build_adjacency(ctx, &offsets, &adj);
+    if (rc != ERR_SUCCESS) {
+        return rc;
+    }
+
+    /*
+     * reach[r * n + v]: cheapest walk v -> 1 in exactly r edges, EXACT_INF if none.
+     */
+    long long* reach = (long long*)malloc(((size_t)steps + 1) * (size_t)n * sizeof(long long));
+    long long* acc   = (long long*)malloc(((size_t)steps + 1) * sizeof(long long));
+    int* stack       = (int*)malloc(((size_t)steps + 1) * sizeof(int));
+    int* next_edge   = (int*)malloc(((size_t)steps + 1) * sizeof(int));
+    int* on_path     = (int*)calloc((size_t)n, sizeof(int));
+    if (!reach || !acc || !stack || !next_edge || !on_path) {
+        free(offsets);
+        free(adj);
+        free(reach);
+        free(acc);
+        free(stack);
+        free(next_edge);
+        free(on_path);
+        return ERR_MEMORY_ALLOCATION;
+    }
+
+    for (int v = 0; v < n; v++) {
+        reach[v] = EXACT_INF;
+    }
+    reach[1] = 0;
+    long long start_delay = ctx->nodes[0].delay_ms;
+    for (int r = 1; r <= steps; r++) {
+        long long* row = reach + (size_t)r * (size_t)n;
+        const long long* prev = row - n;
+        for (int v = 0; v < n; v++) {
+            long long cheapest = EXACT_INF;
+            if (v != 1) { /* node 1 ends a route: nothing continues from it */
+                for (int i = offsets[v]; i < offsets[v + 1]; i++) {
+                    int w = adj[i];
+                    if (prev[w] != EXACT_INF && prev[w] + ctx->nodes[w].delay_ms < cheapest) {
+                        cheapest = prev[w] + ctx->nodes[w].delay_ms;
+                    }
+                }
+            }
+            row[v] = cheapest;
+        }
+        /* r edges carry r - 1 intermediate nodes */
+        if (r - 1 >= ctx->min_hops && row[0] != EXACT_INF && start_delay + row[0] < *bound) {
+            *bound = start_delay + row[0];
+        }
+    }
+
+    /* Depth-first search; stack[k] is the node after k edges, acc[k] the cost so far. */
+    int k = 0;
+    stack[0] = 0;
+    on_path[0] = 1;
+    acc[0] = start_delay;
+    next_edge[0] = offsets[0];
+    while (k >= 0) {
+        int v = stack[k];
+        if (next_edge[k] == offsets[v + 1]) {
+            on_path[v] = 0;
+            k--;
+            continue;
+        }
+        int w = adj[next_edge[k]++];
+        if (on_path[w]) {
+            continue;
+        }
+        long long reached = acc[k] + ctx->nodes[w].delay_ms;
+        if (w == 1) {
+            /* the route has k intermediate nodes */
+            if (k >= ctx->min_hops && reached < *cost) {
+                memcpy(path, stack, ((size_t)k + 1) * sizeof(int));
+                path[k + 1] = 1;
+                *length = k + 2;
+                *cost = reached;
+            }
+            continue;
+        }
+        /* w becomes intermediate node k + 1; r more edges end the route with k + r hops */
+        int most = steps - (k + 1);
+        int least = (ctx->min_hops - k > 1) ? ctx->min_hops - k : 1;
+        if (k + 1 > ctx->max_hops || least > most) {
+            continue;
+        }
+        long long rest = EXACT_INF;
+        for (int r = least; r <= most; r++) {
+            long long walk = reach[(size_t)r * (size_t)n + (size_t)w];
+            if (walk < rest) {
+                rest = walk;
+            }
+        }
+        if (rest == EXACT_INF || reached + rest >= *cost) {
+            continue;
+        }
+        k++;
+        stack[k] = w;
+        on_path[w] = 1;
+        acc[k] = reached;
+        next_edge[k] = offsets[w];
+    }
+
+    free(offsets);
+    free(adj);
+    free(reach);
+    free(acc);
+    free(stack);
+    free(next_edge);
+    free(on_path);
+    return (*cost == EXACT_INF) ? ERR_NO_PATH_FOUND : ERR_SUCCESS;
+}
+
+int exact_solver_search(
+    AntNetContext* ctx,
+    int start_id,
+    int end_id,
+    int* out_nodes,
+    int max_size,
+    int* out_path_len,
+    int* out_total_latency
+)
+{
+    (void)start_id; /* routes always run 0 -> 1, as in the other solvers */
+    (void)end_id;
+
+    if (!ctx || !out_nodes || !out_path_len || !out_total_latency) {
+        return ERR_INVALID_ARGS;
+    }
+    if (ctx->num_nodes < 2 || !ctx->nodes) {
+        return ERR_NO_TOPOLOGY;
+    }
+
+    ExactSolverState* st = &ctx->exact_state;
+    int mode = exact_solver_mode(ctx);
+    if (!st->solved || st->topology_version != ctx->topology_version || st->mode != mode ||
+        st->min_hops != ctx->min_hops || st->max_hops != ctx->max_hops) {
+        /* Solved straight into exact_best_nodes, which is cleared below on failure. */
+        int* path = ctx->exact_best_nodes;
+        int length = 0;
+        long long cost = EXACT_INF;
+        long long bound = EXACT_INF;
+        int rc = ERR_NO_PATH_FOUND;
+        if (ctx->min_hops >= 0 && ctx->min_hops <= ctx->max_hops) {
+            if (mode == EXACT_MODE_EDGES) {
+                rc = exact_solve_edges(ctx, path, &length, &cost, &bound);
+            } else {
+                rc = exact_solve_subset(ctx, path, &length, &cost);
+                bound = cost;
+            }
+        }
+        if (rc != ERR_SUCCESS && rc != ERR_NO_PATH_FOUND) {
+            return rc;
+        }
+
+        if (rc == ERR_SUCCESS && cost <= INT_MAX) {
+            ctx->exact_best_length  = length;
+            ctx->exact_best_latency = (int)cost;
+        } else {
+            ctx->exact_best_length  = 0;
+            ctx->exact_best_latency = 0;
+        }
+        st->lower_bound      = (bound == EXACT_INF || bound > INT_MAX) ? -1 : (int)bound;
+        st->solved           = 1;
+        st->topology_version = ctx->topology_version;
+        st->mode             = mode;
+        st->min_hops         = ctx->min_hops;
+        st->max_hops         = ctx->max_hops;
+    }
+
+    *out_path_len      = 0;
+    *out_total_latency = 0;
+    if (ctx->exact_best_length == 0) {
+        return ERR_NO_PATH_FOUND;
+    }
+    if (ctx->exact_best_length > max_size) {
+        return ERR_ARRAY_TOO_SMALL;
+    }
+    memcpy(out_nodes, ctx->exact_best_nodes, (size_t)ctx->exact_best_length * sizeof(int));
+    *out_path_len      = ctx->exact_best_length;
+    *out_total_latency = ctx->exact_best_latency;
+    return ERR_SUCCESS;
+}
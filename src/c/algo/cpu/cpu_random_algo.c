@@ -8,16 +8,13 @@
 
 #include <stdio.h>
 #include <stdlib.h>
-#include <time.h>
 #include <limits.h>
 #include "../../../../include/consts/error_codes.h"
 #include "../../../../include/algo/cpu/cpu_random_algo.h"
 #include "../../../../include/rendering/heatmap_renderer_api.h"
 /* Added header to reorder path for display */
 #include "../../../../include/algo/cpu/cpu_random_algo_path_reorder.h"
-
-/* security: track if we have seeded the RNG once to avoid repeated seeding on each call */
-static int g_seeded = 0;
+#include "../../../../include/core/backend_rng.h"
 
 int random_search_path(
     AntNetContext* ctx,
@@ -38,23 +35,17 @@ int random_search_path(
 
     /* Ensure the result array is large enough for worst case (max_hops + 2) */
     int needed_capacity = ctx->max_hops + 2;
-    if (needed_capacity > max_size || needed_capacity > 1024) {
+    if (needed_capacity > max_size) {
         return ERR_ARRAY_TOO_SMALL;
     }
 
-    /* seed once per process run */
-    if (!g_seeded) {
-        srand((unsigned int)time(NULL));
-        g_seeded = 1;
-    }
-
     int range_size = ctx->max_hops - ctx->min_hops + 1;
     if (range_size <= 0) {
         return ERR_INVALID_ARGS;
     }
 
     /* pick nb_selected_nodes in [min_hops..max_hops], clamp by candidate_count */
-    int nb_selected_nodes = ctx->min_hops + (rand() % range_size);
+    int nb_selected_nodes = ctx->min_hops + antnet_rng_next_int(&ctx->random_rng, range_size);
     int candidate_count = ctx->num_nodes - 2; /* exclude start_id and end_id */
 
     if (candidate_count < 0) {
@@ -71,10 +62,15 @@ int random_search_path(
 
     int idx = 0;
     for (int i = 0; i < ctx->num_nodes; i++) {
-        if (i != start_id && i != end_id) {
+        if (i != start_id && i != end_id && ANTNET_NODE_ENABLED(ctx, i)) {
             candidates[idx++] = i;
         }
     }
+    /* Disabled nodes are not candidates. */
+    candidate_count = idx;
+    if (nb_selected_nodes > candidate_count) {
+        nb_selected_nodes = candidate_count;
+    }
 
     int new_path_length = nb_selected_nodes + 2; /* including start, end */
     int* new_path = (int*)malloc((size_t)new_path_length * sizeof(int));
@@ -85,7 +81,7 @@ int random_search_path(
 
     /* Fisher-Yates shuffle of the candidates array */
     for (int i = candidate_count - 1; i > 0; i--) {
-        int j = rand() % (i + 1);
+        int j = antnet_rng_next_int(&ctx->random_rng, i + 1);
         int tmp = candidates[i];
         candidates[i] = candidates[j];
         candidates[j] = tmp;
@@ -117,7 +113,8 @@ int random_search_path(
     /*
      * if better or if none yet, update ctx->random_best_*
      */
-    if (ctx->random_best_length == 0 || new_total_latency < ctx->random_best_latency) {
+    if (new_path_length <= ctx->path_capacity &&
+        (ctx->random_best_length == 0 || new_total_latency < ctx->random_best_latency)) {
         ctx->random_best_length = new_path_length;
         ctx->random_best_latency = new_total_latency;
         for (int p = 0; p < new_path_length; p++) {
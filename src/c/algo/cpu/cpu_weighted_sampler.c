@@ -0,0 +1,127 @@
+/* Relative Path: src/c/algo/cpu/cpu_weighted_sampler.c */
+/*
+ * Implements the Fenwick-tree weighted sampler: linear-time build, then
+ * O(log n) draws by descending the implicit tree and O(log n) removals.
+ * Replaces the per-pick cumulative scan of the ACO candidate selection.
+*/
+
+#include "../../../../include/algo/cpu/cpu_weighted_sampler.h"
+#include "../../../../include/consts/error_codes.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+int weighted_sampler_init(WeightedSampler* sampler, int capacity)
+{
+    if (!sampler || capacity <= 0) {
+        return ERR_INVALID_ARGS;
+    }
+    memset(sampler, 0, sizeof(WeightedSampler));
+
+    sampler->tree    = (double*)malloc(sizeof(double) * ((size_t)capacity + 1));
+    sampler->weights = (double*)malloc(sizeof(double) * (size_t)capacity);
+    if (!sampler->tree || !sampler->weights) {
+        weighted_sampler_free(sampler);
+        return ERR_MEMORY_ALLOCATION;
+    }
+    sampler->capacity = capacity;
+    return ERR_SUCCESS;
+}
+
+void weighted_sampler_free(WeightedSampler* sampler)
+{
+    if (!sampler) {
+        return;
+    }
+    free(sampler->tree);
+    free(sampler->weights);
+    sampler->tree     = NULL;
+    sampler->weights  = NULL;
+    sampler->count    = 0;
+    sampler->capacity = 0;
+    sampler->total    = 0.0;
+}
+
+int weighted_sampler_build(WeightedSampler* sampler, const double* weights, int count)
+{
+    if (!sampler || !weights || count < 0 || count > sampler->capacity) {
+        return ERR_INVALID_ARGS;
+    }
+
+    sampler->count = count;
+    sampler->total = 0.0;
+    sampler->tree[0] = 0.0;
+    for (int i = 0; i < count; i++) {
+        double w = (weights[i] > 0.0) ? weights[i] : 0.0;
+        sampler->weights[i]  = w;
+        sampler->tree[i + 1] = w;
+        sampler->total      += w;
+    }
+
+    /* Linear build: push each node's partial sum to its parent once. */
+    for (int i = 1; i <= count; i++) {
+        int parent = i + (i & -i);
+        if (parent <= count) {
+            sampler->tree[parent] += sampler->tree[i];
+        }
+    }
+
+    sampler->top_step = 1;
+    while (sampler->top_step * 2 <= count) {
+        sampler->top_step *= 2;
+    }
+    return ERR_SUCCESS;
+}
+
+int weighted_sampler_draw(const WeightedSampler* sampler, float u)
+{
+    if (!sampler || sampler->count <= 0 || sampler->total <= 0.0) {
+        return -1;
+    }
+
+    /* Find the first item whose prefix sum exceeds target. */
+    double target = (double)u * sampler->total;
+    int pos = 0;
+    for (int step = sampler->top_step; step > 0; step >>= 1) {
+        int next = pos + step;
+        if (next <= sampler->count && sampler->tree[next] <= target) {
+            pos     = next;
+            target -= sampler->tree[next];
+        }
+    }
+
+    /*
+     * Rounding in the running sums can leave target just past the last item,
+     * or land on a removed one; fall back to the nearest remaining item.
+     */
+    if (pos >= sampler->count || sampler->weights[pos] <= 0.0) {
+        for (int i = (pos < sampler->count ? pos : sampler->count - 1); i >= 0; i--) {
+            if (sampler->weights[i] > 0.0) {
+                return i;
+            }
+        }
+        for (int i = pos + 1; i < sampler->count; i++) {
+            if (sampler->weights[i] > 0.0) {
+                return i;
+            }
+        }
+        return -1;
+    }
+    return pos;
+}
+
+void weighted_sampler_remove(WeightedSampler* sampler, int index)
+{
+    if (!sampler || index < 0 || index >= sampler->count) {
+        return;
+    }
+    double w = sampler->weights[index];
+    if (w <= 0.0) {
+        return;
+    }
+    sampler->weights[index] = 0.0;
+    sampler->total -= w;
+    for (int i = index + 1; i <= sampler->count; i += i & -i) {
+        sampler->tree[i] -= w;
+    }
+}
@@ -1,7 +1,7 @@
 /* Relative Path: src/c/core/backend_init.c */
 /*
  * Manages global context creation, initialization, and shutdown for AntNet instances.
- * Provides a thread-safe pool of contexts and cleans up resources upon destruction.
+ * Keeps contexts in a growable registry looked up without locks by generation-tagged handle.
  * Entry point for setting up all major components (nodes, edges, solver states).
 */
 
@@ -11,6 +11,11 @@
 #include "../../../include/managers/config_manager.h"
 #include "../../../include/types/antnet_sasa_types.h"
 #include "../../../include/managers/ranking_manager.h"  
+#include "../../../include/core/backend_rng.h"
+#include "../../../include/core/backend_log.h"
+#include "../../../include/core/backend_perf.h"
+#include "../../../include/algo/cpu/cpu_ACOv1.h"
+#include "../../../include/algo/cpu/cpu_brute_force.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -20,157 +25,581 @@
 #include <pthread.h>
 #endif
 
-#define MAX_CONTEXTS 16
+#if defined(__GNUC__)
+#define REG_LOAD(p)      __atomic_load_n((p), __ATOMIC_SEQ_CST)
+#define REG_STORE(p, v)  __atomic_store_n((p), (v), __ATOMIC_SEQ_CST)
+#define REG_ADD(p, v)    __atomic_add_fetch((p), (v), __ATOMIC_SEQ_CST)
+#define REG_CAS(p, e, v) __atomic_compare_exchange_n((p), (e), (v), 0, \
+                                                     __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)
+#else
+/* No atomics: matches the _WIN32 fallback, which uses contexts from a single thread. */
+#define REG_LOAD(p)      (*(p))
+#define REG_STORE(p, v)  (*(p) = (v))
+#define REG_ADD(p, v)    (*(p) += (v))
+#define REG_CAS(p, e, v) ((*(p) == *(e)) ? ((*(p) = (v)), 1) : 0)
+#endif
+
+/*
+ * Context ids are handles: the low REGISTRY_SLOT_BITS bits pick the slot, the bits above
+ * carry the slot generation, so an id kept past pub_shutdown never reaches the slot's
+ * next context. The first context of a slot gets the bare slot index as id.
+ */
+#define REGISTRY_SEGMENT_SLOTS 16
+#define REGISTRY_MAX_SEGMENTS  256
+#define REGISTRY_SLOT_BITS     12
+#define REGISTRY_SLOT_MASK     ((1 << REGISTRY_SLOT_BITS) - 1)
+#define REGISTRY_GEN_MASK      ((1 << (31 - REGISTRY_SLOT_BITS)) - 1)
+
+typedef enum
+{
+    SLOT_FREE = 0,
+    SLOT_LIVE,
+    SLOT_RETIRED  /* shut down, reused once no thread pins it */
+} SlotState;
 
-/* Global arrays, lock, and usage markers for contexts. */
-static AntNetContext g_contexts[MAX_CONTEXTS];
-static int g_context_in_use[MAX_CONTEXTS] = {0};
+/*
+ * ContextSlot
+ * ctx comes first, so a context pointer is also its slot pointer. Slots sit in segments
+ * that are never freed and their mutexes are never destroyed, so a caller racing
+ * pub_shutdown still locks valid memory and finds an empty context.
+ */
+typedef struct ContextSlot
+{
+    AntNetContext ctx;
+    int index;       /* position in the registry, low bits of every handle */
+    int handle;      /* live id, -1 otherwise; atomic */
+    int pins;        /* threads whose last lookup resolved here; atomic */
+    int generation;  /* of the current or last handle; registry lock */
+    int state;       /* SlotState; registry lock */
+} ContextSlot;
+
+static ContextSlot* g_segments[REGISTRY_MAX_SEGMENTS]; /* atomic, filled in order */
+static int g_segment_count = 0;                         /* registry lock */
+
+#ifndef _WIN32
+static pthread_mutex_t g_registry_lock = PTHREAD_MUTEX_INITIALIZER; /* create and retire only */
+static pthread_key_t   g_pin_key;
+static pthread_once_t  g_pin_once = PTHREAD_ONCE_INIT;
 
+/* Thread exit: drop the pin so the slot can be reclaimed. */
+static void registry_pin_release(void* arg)
+{
+    REG_ADD(&((ContextSlot*)arg)->pins, -1);
+}
+
+static void registry_pin_key_create(void)
+{
+    pthread_key_create(&g_pin_key, registry_pin_release);
+}
+#else
+static ContextSlot* g_pinned = NULL;
+#endif
+
+/*
+ * Internal helper: registry_pin
+ * Each thread pins the slot of its last lookup; repeated calls on one context cost no
+ * atomic write. Pinning before the handle check means a slot seen live is not reused
+ * until the thread moves on to another context or exits.
+ */
+static void registry_pin(ContextSlot* slot)
+{
+#ifndef _WIN32
+    pthread_once(&g_pin_once, registry_pin_key_create);
+    ContextSlot* held = (ContextSlot*)pthread_getspecific(g_pin_key);
+#else
+    ContextSlot* held = g_pinned;
+#endif
+    if (held == slot)
+    {
+        return;
+    }
+    if (slot)
+    {
+        REG_ADD(&slot->pins, 1);
+    }
 #ifndef _WIN32
-static pthread_mutex_t g_contexts_lock = PTHREAD_MUTEX_INITIALIZER;
+    pthread_setspecific(g_pin_key, slot);
+#else
+    g_pinned = slot;
 #endif
+    if (held)
+    {
+        REG_ADD(&held->pins, -1);
+    }
+}
 
 /*
  * get_context_by_id
- * Retrieves the pointer to the context if in range and in use, else returns NULL.
+ * Retrieves the pointer to the context if the handle is live, else returns NULL.
+ * Takes no lock: reads the segment table and the slot handle only.
  */
 AntNetContext* priv_get_context_by_id(int context_id)
 {
-    if (context_id < 0 || context_id >= MAX_CONTEXTS)
+    if (context_id < 0)
+    {
+        return NULL;
+    }
+    int index = context_id & REGISTRY_SLOT_MASK;
+    ContextSlot* segment = REG_LOAD(&g_segments[index / REGISTRY_SEGMENT_SLOTS]);
+    if (!segment)
+    {
+        return NULL;
+    }
+
+    ContextSlot* slot = &segment[index % REGISTRY_SEGMENT_SLOTS];
+    registry_pin(slot);
+    if (REG_LOAD(&slot->handle) != context_id)
+    {
+        registry_pin(NULL);
+        return NULL;
+    }
+    return &slot->ctx;
+}
+
+/*
+ * priv_get_context_id
+ * Live handle of ctx, or -1 if ctx is NULL or already shut down.
+ */
+int priv_get_context_id(const AntNetContext* ctx)
+{
+    if (!ctx)
+    {
+        return -1;
+    }
+    return REG_LOAD(&((const ContextSlot*)ctx)->handle);
+}
+
+/*
+ * priv_get_worker_pool
+ * Lazily creates the persistent worker pool. A pool whose size no longer matches
+ * ctx->worker_threads is joined and replaced; this happens between batches only.
+ */
+WorkerPool* priv_get_worker_pool(AntNetContext* ctx)
+{
+    if (!ctx)
     {
         return NULL;
     }
+
 #ifndef _WIN32
-    pthread_mutex_lock(&g_contexts_lock);
+    antnet_perf_lock_context(ctx);
 #endif
-    int in_use = g_context_in_use[context_id];
+    int wanted = (ctx->worker_threads > 0) ? ctx->worker_threads
+                                           : worker_pool_default_thread_count();
+    if (ctx->worker_pool && worker_pool_size(ctx->worker_pool) != wanted)
+    {
+        worker_pool_destroy(ctx->worker_pool);
+        ctx->worker_pool = NULL;
+    }
+    if (!ctx->worker_pool)
+    {
+        ctx->worker_pool = worker_pool_create(wanted);
+    }
+    WorkerPool* pool = ctx->worker_pool;
 #ifndef _WIN32
-    pthread_mutex_unlock(&g_contexts_lock);
+    pthread_mutex_unlock(&ctx->lock);
 #endif
 
-    return in_use ? &g_contexts[context_id] : NULL;
+    return pool;
 }
 
 /*
- * antnet_initialize
- * Creates a new context if there is a free slot, initializes default fields,
- * sets up random/bf/aco states, and returns the context_id on success.
+ * priv_get_solver_pool
+ * Lazily creates the pool that pub_run_all_solvers dispatches its solvers on. It is
+ * separate from worker_pool because the solvers submit their own batches there.
+ * The caller holds ctx->run_lock.
  */
-int pub_initialize(int node_count, int min_hops, int max_hops)
+WorkerPool* priv_get_solver_pool(AntNetContext* ctx)
+{
+    if (!ctx)
+    {
+        return NULL;
+    }
+    if (!ctx->solver_pool)
+    {
+        ctx->solver_pool = worker_pool_create(ANTNET_SOLVER_POOL_THREADS);
+    }
+    return ctx->solver_pool;
+}
+
+/*
+ * priv_lock_solvers / priv_unlock_solvers
+ * Take every solver lock in the documented order, for callers that change state all
+ * solvers read (topology, seeds). Waits for running solvers to finish their step.
+ */
+void priv_lock_solvers(AntNetContext* ctx)
 {
 #ifndef _WIN32
-    pthread_mutex_lock(&g_contexts_lock);
+    pthread_mutex_lock(&ctx->aco_lock);
+    pthread_mutex_lock(&ctx->random_lock);
+    pthread_mutex_lock(&ctx->brute_lock);
+    pthread_mutex_lock(&ctx->exact_lock);
+#else
+    (void)ctx;
 #endif
-    for (int i = 0; i < MAX_CONTEXTS; i++)
-    {
-        if (!g_context_in_use[i])
-        {
-            g_context_in_use[i] = 1;
+}
+
+void priv_unlock_solvers(AntNetContext* ctx)
+{
 #ifndef _WIN32
-            pthread_mutex_unlock(&g_contexts_lock);
+    pthread_mutex_unlock(&ctx->exact_lock);
+    pthread_mutex_unlock(&ctx->brute_lock);
+    pthread_mutex_unlock(&ctx->random_lock);
+    pthread_mutex_unlock(&ctx->aco_lock);
+#else
+    (void)ctx;
 #endif
-            AntNetContext* ctx = &g_contexts[i];
-            ctx->node_count = node_count;
-            ctx->min_hops   = min_hops;
-            ctx->max_hops   = max_hops;
-            ctx->iteration  = 0;
-            ctx->nodes      = NULL;
-            ctx->edges      = NULL;
-            ctx->num_nodes  = 0;
-            ctx->num_edges  = 0;
+}
 
-            ctx->random_best_length  = 0;
-            ctx->random_best_latency = 0;
-            memset(ctx->random_best_nodes, 0, sizeof(ctx->random_best_nodes));
+/*
+ * priv_seed_context
+ * Each consumer gets its own stream of the same seed so that adding draws in one
+ * solver never shifts the sequence seen by another.
+ */
+void priv_seed_context(AntNetContext* ctx, uint64_t seed)
+{
+    if (!ctx)
+    {
+        return;
+    }
+    if (seed == 0)
+    {
+        seed = antnet_rng_time_seed();
+    }
+    ctx->rng_seed = seed;
+    antnet_rng_seed_stream(&ctx->random_rng, seed, ANTNET_RNG_STREAM_RANDOM);
+    antnet_rng_seed_stream(&ctx->aco_rng,    seed, ANTNET_RNG_STREAM_ACO);
+    if (ctx->hop_map_mgr)
+    {
+        hop_map_manager_set_seed(ctx->hop_map_mgr, seed);
+    }
+}
 
-            pub_config_set_defaults(&ctx->config);
-            ctx->config.set_nb_nodes = node_count;
-            ctx->config.min_hops     = min_hops;
-            ctx->config.max_hops     = max_hops;
+/*
+ * Internal helper: path_buffer_swap
+ * Moves a stored best path into fresh (capacity entries), clearing it if it does not
+ * fit, frees the old buffer and returns fresh.
+ */
+static int* path_buffer_swap(int* old, int* fresh, int capacity, int* length, int* latency)
+{
+    if (*length > capacity)
+    {
+        *length  = 0;
+        *latency = 0;
+    }
+    else if (*length > 0)
+    {
+        memcpy(fresh, old, (size_t)*length * sizeof(int));
+    }
+    free(old);
+    return fresh;
+}
 
-            ctx->brute_best_length  = 0;
-            ctx->brute_best_latency = 0;
-            memset(ctx->brute_best_nodes, 0, sizeof(ctx->brute_best_nodes));
-            memset(&ctx->brute_state, 0, sizeof(ctx->brute_state));
+/*
+ * priv_reserve_solver_buffers
+ * Paths are simple, so none is longer than the node count: small topologies keep small
+ * buffers whatever max_hops says. A failure leaves every buffer usable, stored paths included.
+ */
+int priv_reserve_solver_buffers(AntNetContext* ctx, int num_nodes)
+{
+    if (!ctx || num_nodes < 0)
+    {
+        return ERR_INVALID_ARGS;
+    }
 
-            ctx->aco_best_length  = 0;
-            ctx->aco_best_latency = 0;
-            memset(ctx->aco_best_nodes, 0, sizeof(ctx->aco_best_nodes));
-            memset(&ctx->aco_v1, 0, sizeof(ctx->aco_v1));
+    long long wanted = (long long)(ctx->max_hops > 0 ? ctx->max_hops : 0) + 2;
+    int capacity = (int)((wanted < num_nodes) ? wanted : num_nodes);
+    if (capacity < 2)
+    {
+        capacity = 2;
+    }
 
-#ifndef _WIN32
-            pthread_mutex_init(&ctx->lock, NULL);
-#endif
+    if (capacity != ctx->path_capacity)
+    {
+        int* random = (int*)malloc((size_t)capacity * sizeof(int));
+        int* brute  = (int*)malloc((size_t)capacity * sizeof(int));
+        int* aco    = (int*)malloc((size_t)capacity * sizeof(int));
+        int* exact  = (int*)malloc((size_t)capacity * sizeof(int));
+        if (!random || !brute || !aco || !exact)
+        {
+            free(random);
+            free(brute);
+            free(aco);
+            free(exact);
+            return ERR_MEMORY_ALLOCATION;
+        }
+        ctx->random_best_nodes = path_buffer_swap(ctx->random_best_nodes, random, capacity,
+                                                  &ctx->random_best_length, &ctx->random_best_latency);
+        ctx->brute_best_nodes  = path_buffer_swap(ctx->brute_best_nodes, brute, capacity,
+                                                  &ctx->brute_best_length, &ctx->brute_best_latency);
+        ctx->aco_best_nodes    = path_buffer_swap(ctx->aco_best_nodes, aco, capacity,
+                                                  &ctx->aco_best_length, &ctx->aco_best_latency);
+        ctx->exact_best_nodes  = path_buffer_swap(ctx->exact_best_nodes, exact, capacity,
+                                                  &ctx->exact_best_length, &ctx->exact_best_latency);
+        ctx->path_capacity = capacity;
+    }
+
+    return brute_force_reserve(ctx, num_nodes);
+}
+
+/*
+ * Internal helper: context_free_resources
+ * Frees what a context owns except its snapshot store, leaving it empty. Safe to repeat.
+ */
+static void context_free_resources(AntNetContext* ctx)
+{
+    free(ctx->nodes);
+    free(ctx->edges);
+    free(ctx->node_disabled);
+    ctx->nodes         = NULL;
+    ctx->edges         = NULL;
+    ctx->node_disabled = NULL;
+    ctx->num_nodes     = 0;
+    ctx->num_edges     = 0;
+    aco_v1_free_buffers(&ctx->aco_v1);
+    brute_force_free_buffers(&ctx->brute_state);
+    free(ctx->random_best_nodes);
+    free(ctx->brute_best_nodes);
+    free(ctx->aco_best_nodes);
+    free(ctx->exact_best_nodes);
+    ctx->random_best_nodes = NULL;
+    ctx->brute_best_nodes  = NULL;
+    ctx->aco_best_nodes    = NULL;
+    ctx->exact_best_nodes  = NULL;
+    ctx->random_best_length = 0;
+    ctx->brute_best_length  = 0;
+    ctx->aco_best_length    = 0;
+    ctx->exact_best_length  = 0;
+    ctx->path_capacity      = 0;
 
-            /* SASA addition: initialize SASA states for ACO, Random, Brute to default */
-            priv_init_sasa_state(&ctx->aco_sasa);
-            priv_init_sasa_state(&ctx->random_sasa);
-            priv_init_sasa_state(&ctx->brute_sasa);
+    /* Workers never take ctx->lock, so joining them here cannot deadlock. */
+    worker_pool_destroy(ctx->solver_pool);
+    worker_pool_destroy(ctx->worker_pool);
+    ctx->solver_pool = NULL;
+    ctx->worker_pool = NULL;
+}
 
-            /* NEW: default SASA coefficients */
-            ctx->sasa_coeffs.alpha = 0.4;
-            ctx->sasa_coeffs.beta  = 0.4;
-            ctx->sasa_coeffs.gamma = 0.2;
+/*
+ * Internal helper: registry_reclaim
+ * Returns a retired slot to the free ones. Unpinned, so no thread can still reach the
+ * context: anything a late caller rebuilt is freed with it, then the snapshot and results
+ * stores that readers use without locks. A results region still pinned keeps its store
+ * alive until pub_results_release. Caller holds g_registry_lock.
+ */
+static void registry_reclaim(ContextSlot* slot)
+{
+    context_free_resources(&slot->ctx);
+    pheromone_snapshots_destroy(slot->ctx.pheromone_snapshots);
+    slot->ctx.pheromone_snapshots = NULL;
+    results_store_destroy(slot->ctx.results);
+    slot->ctx.results = NULL;
+    solver_loop_destroy(slot->ctx.solver_loop);
+    slot->ctx.solver_loop = NULL;
+    slot->state = SLOT_FREE;
+}
 
-            return i;
+/*
+ * Internal helper: registry_acquire_slot
+ * Lowest free or reclaimable slot, adding a segment when all are taken. NULL once
+ * REGISTRY_MAX_SEGMENTS are in use or a segment cannot be allocated.
+ * Caller holds g_registry_lock.
+ */
+static ContextSlot* registry_acquire_slot(void)
+{
+    for (int s = 0; s < g_segment_count; s++)
+    {
+        for (int i = 0; i < REGISTRY_SEGMENT_SLOTS; i++)
+        {
+            ContextSlot* slot = &g_segments[s][i];
+            if (slot->state == SLOT_RETIRED && REG_LOAD(&slot->pins) == 0)
+            {
+                registry_reclaim(slot);
+            }
+            if (slot->state == SLOT_FREE)
+            {
+                return slot;
+            }
         }
     }
+
+    if (g_segment_count >= REGISTRY_MAX_SEGMENTS)
+    {
+        return NULL;
+    }
+    ContextSlot* segment = (ContextSlot*)calloc(REGISTRY_SEGMENT_SLOTS, sizeof(ContextSlot));
+    if (!segment)
+    {
+        return NULL;
+    }
+    for (int i = 0; i < REGISTRY_SEGMENT_SLOTS; i++)
+    {
+        AntNetContext* ctx = &segment[i].ctx;
+        segment[i].index  = g_segment_count * REGISTRY_SEGMENT_SLOTS + i;
+        segment[i].handle = -1;
 #ifndef _WIN32
-    pthread_mutex_unlock(&g_contexts_lock);
+        pthread_mutex_init(&ctx->lock, NULL);
+        pthread_mutex_init(&ctx->run_lock, NULL);
+        pthread_mutex_init(&ctx->aco_lock, NULL);
+        pthread_mutex_init(&ctx->random_lock, NULL);
+        pthread_mutex_init(&ctx->brute_lock, NULL);
+        pthread_mutex_init(&ctx->exact_lock, NULL);
+#else
+        (void)ctx;
 #endif
-    return ERR_NO_FREE_SLOT;
+    }
+    REG_STORE(&g_segments[g_segment_count], segment);
+    g_segment_count++;
+    return segment;
 }
 
 /*
- * pub_shutdown
- * Frees all allocated memory associated with the context, destroys locks,
- * and marks the slot as unused. Thread-safe with final destruction after unlock.
+ * antnet_initialize
+ * Takes a free registry slot, growing the registry if needed, initializes default
+ * fields, sets up random/bf/aco states, and returns the context handle on success.
  */
-int pub_shutdown(int context_id)
+int pub_initialize(int node_count, int min_hops, int max_hops)
 {
-    AntNetContext* ctx = priv_get_context_by_id(context_id);
-    if (!ctx)
-    {
-        return ERR_INVALID_CONTEXT;
-    }
-
 #ifndef _WIN32
-    pthread_mutex_lock(&ctx->lock);
+    pthread_mutex_lock(&g_registry_lock);
 #endif
-    if (ctx->nodes)
+    ContextSlot* slot = registry_acquire_slot();
+    if (slot)
     {
-        free(ctx->nodes);
-        ctx->nodes = NULL;
+        slot->state = SLOT_LIVE;
     }
-    if (ctx->edges)
+#ifndef _WIN32
+    pthread_mutex_unlock(&g_registry_lock);
+#endif
+    if (!slot)
     {
-        free(ctx->edges);
-        ctx->edges = NULL;
+        return ERR_NO_FREE_SLOT;
     }
-    if (ctx->aco_v1.adjacency)
+
+    /* The handle is published last: lookups fail until the context is ready. */
+    int context_id = (slot->generation << REGISTRY_SLOT_BITS) | slot->index;
+    AntNetContext* ctx = &slot->ctx;
+    ctx->node_count = node_count;
+    ctx->min_hops   = min_hops;
+    ctx->max_hops   = max_hops;
+    ctx->iteration  = 0;
+    ctx->nodes      = NULL;
+    ctx->edges      = NULL;
+    ctx->num_nodes  = 0;
+    ctx->num_edges  = 0;
+    ctx->node_disabled = NULL;
+    ctx->topology_version = 0;
+
+    /* Path and brute force buffers come with the first topology. */
+    ctx->path_capacity       = 0;
+    ctx->random_best_nodes   = NULL;
+    ctx->random_best_length  = 0;
+    ctx->random_best_latency = 0;
+
+    pub_config_set_defaults(&ctx->config);
+    ctx->config.set_nb_nodes = node_count;
+    ctx->config.min_hops     = min_hops;
+    ctx->config.max_hops     = max_hops;
+
+    ctx->brute_best_nodes   = NULL;
+    ctx->brute_best_length  = 0;
+    ctx->brute_best_latency = 0;
+    memset(&ctx->brute_state, 0, sizeof(ctx->brute_state));
+
+    ctx->aco_best_nodes   = NULL;
+    ctx->aco_best_length  = 0;
+    ctx->aco_best_latency = 0;
+    memset(&ctx->aco_v1, 0, sizeof(ctx->aco_v1));
+
+    ctx->exact_best_nodes   = NULL;
+    ctx->exact_best_length  = 0;
+    ctx->exact_best_latency = 0;
+    memset(&ctx->exact_state, 0, sizeof(ctx->exact_state));
+
+    ctx->worker_pool    = NULL;
+    ctx->worker_threads = 0;
+    ctx->solver_pool    = NULL;
+    ctx->pheromone_snapshots = pheromone_snapshots_create();
+    ctx->results             = results_store_create();
+    ctx->solver_loop         = solver_loop_create();
+    memset(&ctx->perf, 0, sizeof(ctx->perf));
+
+    priv_seed_context(ctx, 0);
+
+    /* SASA addition: initialize SASA states for ACO, Random, Brute to default */
+    priv_init_sasa_state(&ctx->aco_sasa);
+    priv_init_sasa_state(&ctx->random_sasa);
+    priv_init_sasa_state(&ctx->brute_sasa);
+    priv_init_sasa_state(&ctx->exact_sasa);
+
+    /* NEW: default SASA coefficients */
+    ctx->sasa_coeffs.alpha = 0.4;
+    ctx->sasa_coeffs.beta  = 0.4;
+    ctx->sasa_coeffs.gamma = 0.2;
+
+    REG_STORE(&slot->handle, context_id);
+    return context_id;
+}
+
+/*
+ * pub_shutdown
+ * Retires the handle, waits for calls in progress on the context and frees what it
+ * owns. The slot is reused once no thread pins it, with a new generation.
+ */
+int pub_shutdown(int context_id)
+{
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx)
     {
-        free(ctx->aco_v1.adjacency);
-        ctx->aco_v1.adjacency = NULL;
+        return ERR_INVALID_CONTEXT;
     }
-    if (ctx->aco_v1.pheromones)
+
+    /* New lookups fail from here on; of two concurrent shutdowns only one gets past. */
+    ContextSlot* slot = (ContextSlot*)ctx;
+    int expected = context_id;
+    if (!REG_CAS(&slot->handle, &expected, -1))
     {
-        free(ctx->aco_v1.pheromones);
-        ctx->aco_v1.pheromones = NULL;
+        return ERR_INVALID_CONTEXT;
     }
 
-    printf("[antnet_shutdown] context %d final iteration: %d\n", context_id, ctx->iteration);
+    /* Regions pinned past this point are released without the handle. */
+    results_store_retire(ctx->results);
+
+    /* The loop thread takes the locks below, so it is joined before them. */
+    solver_loop_close(ctx->solver_loop);
+
+    /* Waits for a pub_run_all_solvers in progress, then for every other locked call. */
+#ifndef _WIN32
+    pthread_mutex_lock(&ctx->run_lock);
+#endif
+    priv_lock_solvers(ctx);
+#ifndef _WIN32
+    antnet_perf_lock_context(ctx);
+#endif
+    context_free_resources(ctx);
+
+    ANTNET_LOGI(context_id, "[antnet_shutdown] context %d final iteration: %d",
+                context_id, ctx->iteration);
 
 #ifndef _WIN32
     pthread_mutex_unlock(&ctx->lock);
-    pthread_mutex_destroy(&ctx->lock);
+#endif
+    priv_unlock_solvers(ctx);
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->run_lock);
 #endif
 
+    registry_pin(NULL);
 #ifndef _WIN32
-    pthread_mutex_lock(&g_contexts_lock);
+    pthread_mutex_lock(&g_registry_lock);
 #endif
-    g_context_in_use[context_id] = 0;
+    slot->generation = (slot->generation + 1) & REGISTRY_GEN_MASK;
+    slot->state = SLOT_RETIRED;
+    if (REG_LOAD(&slot->pins) == 0)
+    {
+        registry_reclaim(slot);
+    }
 #ifndef _WIN32
-    pthread_mutex_unlock(&g_contexts_lock);
+    pthread_mutex_unlock(&g_registry_lock);
 #endif
     return ERR_SUCCESS;
 }
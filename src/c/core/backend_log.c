@@ -0,0 +1,253 @@
+/* Relative Path: src/c/core/backend_log.c */
+/*
+ * Implements the backend log as single-producer rings, one per writing thread.
+ * The owner thread advances head, the drain advances tail; a thread that exits leaves its
+ * ring to the next new thread, so rings are bounded by the number of live threads.
+*/
+
+#include "../../../include/core/backend_log.h"
+#include "../../../include/rendering/heatmap_renderer_api.h"
+#include "../../../include/consts/error_codes.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+#if defined(__GNUC__)
+#define LOG_LOAD(p)        __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define LOG_STORE(p, v)    __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define LOG_ADD(p, v)      __atomic_fetch_add((p), (v), __ATOMIC_RELAXED)
+#define LOG_CAS(p, e, v)   __atomic_compare_exchange_n((p), (e), (v), 0, \
+                                                       __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)
+#else
+/* No atomics: matches the _WIN32 fallback, which logs from a single thread. */
+#define LOG_LOAD(p)        (*(p))
+#define LOG_STORE(p, v)    (*(p) = (v))
+#define LOG_ADD(p, v)      ((*(p) += (v)) - (v))
+#define LOG_CAS(p, e, v)   ((*(p) == *(e)) ? ((*(p) = (v)), 1) : 0)
+#endif
+
+/*
+ * LogRing
+ * entries[head % SLOTS] is written by the owner only while head - tail < SLOTS;
+ * entries[tail % SLOTS] is read by the drain only while tail != head.
+ */
+typedef struct LogRing
+{
+    AntNetLogEntry entries[ANTNET_LOG_RING_SLOTS];
+    unsigned int   head;  /* next slot to write, owner only; atomic */
+    unsigned int   tail;  /* next slot to drain, drain only; atomic */
+    int            owned; /* 1 while a live thread writes here; atomic */
+} LogRing;
+
+static LogRing* g_rings[ANTNET_LOG_MAX_RINGS];
+static int      g_ring_count = 0;               /* published rings; atomic */
+static uint64_t g_log_seq = 0;                  /* atomic */
+static uint64_t g_log_dropped = 0;              /* atomic */
+static int      g_log_level = ANTNET_LOG_COMPILE_LEVEL; /* runtime filter; atomic */
+
+#ifndef _WIN32
+static pthread_key_t   g_ring_key;
+static pthread_once_t  g_ring_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t g_register_lock = PTHREAD_MUTEX_INITIALIZER; /* ring creation only */
+static pthread_mutex_t g_drain_lock = PTHREAD_MUTEX_INITIALIZER;    /* one drainer at a time */
+
+/* Thread exit: the ring keeps its undrained entries and waits for a new owner. */
+static void log_ring_release(void* arg)
+{
+    LogRing* ring = (LogRing*)arg;
+    LOG_STORE(&ring->owned, 0);
+}
+
+static void log_ring_key_create(void)
+{
+    pthread_key_create(&g_ring_key, log_ring_release);
+}
+#endif
+
+static uint64_t log_clock_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000);
+}
+
+/*
+ * Internal helper: log_ring_acquire
+ * Reuses a ring left by an exited thread, else creates one. Runs once per thread;
+ * NULL once ANTNET_LOG_MAX_RINGS live threads have rings.
+ */
+static LogRing* log_ring_acquire(void)
+{
+    int count = LOG_LOAD(&g_ring_count);
+    for (int i = 0; i < count; i++)
+    {
+        int unowned = 0;
+        if (LOG_CAS(&g_rings[i]->owned, &unowned, 1))
+        {
+            return g_rings[i];
+        }
+    }
+
+    LogRing* ring = NULL;
+#ifndef _WIN32
+    pthread_mutex_lock(&g_register_lock);
+#endif
+    count = g_ring_count;
+    if (count < ANTNET_LOG_MAX_RINGS)
+    {
+        ring = (LogRing*)calloc(1, sizeof(LogRing));
+        if (ring)
+        {
+            ring->owned = 1;
+            g_rings[count] = ring;
+            LOG_STORE(&g_ring_count, count + 1);
+        }
+    }
+#ifndef _WIN32
+    pthread_mutex_unlock(&g_register_lock);
+#endif
+    return ring;
+}
+
+static LogRing* log_ring_for_thread(void)
+{
+#ifndef _WIN32
+    pthread_once(&g_ring_once, log_ring_key_create);
+    LogRing* ring = (LogRing*)pthread_getspecific(g_ring_key);
+    if (!ring)
+    {
+        ring = log_ring_acquire();
+        if (ring)
+        {
+            pthread_setspecific(g_ring_key, ring);
+        }
+    }
+    return ring;
+#else
+    static LogRing* ring = NULL;
+    if (!ring)
+    {
+        ring = log_ring_acquire();
+    }
+    return ring;
+#endif
+}
+
+void antnet_log_write(int level, int context_id, const char* fmt, ...)
+{
+    if (level > LOG_LOAD(&g_log_level))
+    {
+        return;
+    }
+
+    LogRing* ring = log_ring_for_thread();
+    if (!ring)
+    {
+        LOG_ADD(&g_log_dropped, 1);
+        return;
+    }
+
+    unsigned int head = ring->head;
+    if (head - LOG_LOAD(&ring->tail) >= ANTNET_LOG_RING_SLOTS)
+    {
+        LOG_ADD(&g_log_dropped, 1);
+        return;
+    }
+
+    AntNetLogEntry* entry = &ring->entries[head % ANTNET_LOG_RING_SLOTS];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(entry->message, sizeof(entry->message), fmt, args);
+    va_end(args);
+    entry->level      = level;
+    entry->context_id = context_id;
+    entry->time_us    = log_clock_us();
+    entry->seq        = LOG_ADD(&g_log_seq, 1);
+
+    LOG_STORE(&ring->head, head + 1);
+}
+
+/*
+ * pub_drain_logs
+ * Moves up to max_count entries, oldest first across all threads, into out.
+ * Concurrent drains are serialized; writers are never blocked.
+ */
+int pub_drain_logs(AntNetLogEntry* out, int max_count)
+{
+    if (!out || max_count < 0)
+    {
+        return ERR_INVALID_ARGS;
+    }
+
+#ifndef _WIN32
+    pthread_mutex_lock(&g_drain_lock);
+#endif
+    int count = LOG_LOAD(&g_ring_count);
+    int drained = 0;
+    while (drained < max_count)
+    {
+        /* Rings are each in seq order, so the oldest pending entry heads one of them. */
+        LogRing* oldest = NULL;
+        for (int i = 0; i < count; i++)
+        {
+            LogRing* ring = g_rings[i];
+            unsigned int tail = ring->tail;
+            if (tail == LOG_LOAD(&ring->head))
+            {
+                continue;
+            }
+            if (!oldest ||
+                ring->entries[tail % ANTNET_LOG_RING_SLOTS].seq <
+                oldest->entries[oldest->tail % ANTNET_LOG_RING_SLOTS].seq)
+            {
+                oldest = ring;
+            }
+        }
+        if (!oldest)
+        {
+            break;
+        }
+        out[drained++] = oldest->entries[oldest->tail % ANTNET_LOG_RING_SLOTS];
+        LOG_STORE(&oldest->tail, oldest->tail + 1);
+    }
+#ifndef _WIN32
+    pthread_mutex_unlock(&g_drain_lock);
+#endif
+    return drained;
+}
+
+/*
+ * pub_set_log_level
+ * Keeps messages up to level (ANTNET_LOG_ERROR..ANTNET_LOG_DEBUG). Levels stripped at
+ * compile time stay silent whatever the runtime level.
+ */
+int pub_set_log_level(int level)
+{
+    if (level < ANTNET_LOG_ERROR || level > ANTNET_LOG_DEBUG)
+    {
+        return ERR_INVALID_ARGS;
+    }
+    LOG_STORE(&g_log_level, level);
+    return ERR_SUCCESS;
+}
+
+/*
+ * pub_get_log_dropped
+ * Messages lost since startup because a ring was full or no ring was left.
+ */
+int pub_get_log_dropped(uint64_t* out_dropped)
+{
+    if (!out_dropped)
+    {
+        return ERR_INVALID_ARGS;
+    }
+    *out_dropped = LOG_LOAD(&g_log_dropped);
+    return ERR_SUCCESS;
+}
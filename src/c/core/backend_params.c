@@ -8,7 +8,13 @@
 #include "../../../include/core/backend_params.h"
 #include "../../../include/managers/config_manager.h"
 #include "../../../include/managers/ranking_manager.h"
+#include "../../../include/algo/cpu/cpu_ACOv1.h"
+#include "../../../include/algo/cpu/cpu_ACOv1_colonies.h"
+#include "../../../include/algo/cpu/cpu_exact_solver.h"
+#include "../../../include/algo/cpu/cpu_brute_force.h"
+#include "../../../include/algo/cpu/cpu_brute_force_parallel.h"
 #include "../../../include/consts/error_codes.h"
+#include "../../../include/core/backend_perf.h"
 #include <string.h>
 
 /*
@@ -46,14 +52,16 @@ int pub_init_from_config(const char* config_path)
         return ERR_INVALID_CONTEXT;
     }
 
+    priv_lock_solvers(ctx);
 #ifndef _WIN32
-    pthread_mutex_lock(&ctx->lock);
+    antnet_perf_lock_context(ctx);
 #endif
     /* Copy config into the context inside the lock. */
     ctx->config = tmpcfg;
 #ifndef _WIN32
     pthread_mutex_unlock(&ctx->lock);
 #endif
+    priv_unlock_solvers(ctx);
 
     /*
      * Now call pub_set_aco_params outside the lock so that
@@ -79,6 +87,21 @@ int pub_init_from_config(const char* config_path)
         tmpcfg.ranking_gamma
     );
 
+    pub_set_aco_construction_mode(context_id, tmpcfg.ant_construction);
+    pub_set_aco_evaporation_mode(context_id, tmpcfg.ant_evaporation_mode);
+    pub_set_aco_storage_mode(context_id, tmpcfg.ant_storage_mode);
+    pub_set_aco_colonies(context_id, tmpcfg.ant_colonies,
+                         tmpcfg.ant_migration_interval, tmpcfg.ant_migration_mode);
+    pub_set_exact_solver(context_id, tmpcfg.exact_solver ? 1 : 0);
+    pub_set_brute_force_mode(context_id, tmpcfg.brute_mode,
+                             tmpcfg.brute_step_candidates, tmpcfg.brute_step_time_us);
+
+    /* A fixed seed in the .ini makes the whole run replayable; 0 keeps the clock seed. */
+    if (tmpcfg.seed != 0)
+    {
+        pub_set_seed(context_id, tmpcfg.seed);
+    }
+
     return context_id;
 }
 
@@ -100,7 +123,7 @@ int pub_get_config(int context_id, AppConfig* out)
     }
 
 #ifndef _WIN32
-    pthread_mutex_lock(&ctx->lock);
+    antnet_perf_lock_context(ctx);
 #endif
     *out = ctx->config;
 #ifndef _WIN32
@@ -111,11 +134,13 @@ int pub_get_config(int context_id, AppConfig* out)
 }
 
 /*
- * pub_get_pheromone_matrix
- * Copies up to n*n floats into 'out', returns the total count on success,
- * negative on errors. Thread-safe read.
+ * pub_get_pheromone_snapshot
+ * Copies the last published matrix without taking ctx->lock; see the header.
+ * Before the first publish, publishes once under aco_lock and ctx->lock so the call
+ * still succeeds.
  */
-int pub_get_pheromone_matrix(int context_id, float* out, int max_count)
+int pub_get_pheromone_snapshot(int context_id, float* out, int max_count,
+                               uint64_t known_version, uint64_t* out_version)
 {
     AntNetContext* ctx = priv_get_context_by_id(context_id);
     if (!ctx)
@@ -123,40 +148,80 @@ int pub_get_pheromone_matrix(int context_id, float* out, int max_count)
         return ERR_INVALID_CONTEXT;
     }
 
+    int rc = pheromone_snapshots_read(ctx->pheromone_snapshots, out, max_count,
+                                      known_version, out_version);
+    if (rc != ERR_NO_TOPOLOGY || !ctx->pheromone_snapshots)
+    {
+        return rc;
+    }
+
+    /* aco_lock first: ACO writes the matrix under it alone (init, single-ant deposits). */
 #ifndef _WIN32
-    pthread_mutex_lock(&ctx->lock);
+    pthread_mutex_lock(&ctx->aco_lock);
+    antnet_perf_lock_context(ctx);
 #endif
-    if (!ctx->aco_v1.pheromones || ctx->aco_v1.pheromone_size <= 0)
-    {
+    rc = pheromone_snapshots_publish(ctx->pheromone_snapshots, &ctx->aco_v1);
 #ifndef _WIN32
-        pthread_mutex_unlock(&ctx->lock);
+    pthread_mutex_unlock(&ctx->lock);
+    pthread_mutex_unlock(&ctx->aco_lock);
 #endif
-        return ERR_NO_TOPOLOGY;
+    if (rc != ERR_SUCCESS)
+    {
+        return rc;
     }
-    int n = ctx->aco_v1.pheromone_size;
-    int count = n * n;
-    if (max_count < count)
+
+    return pheromone_snapshots_read(ctx->pheromone_snapshots, out, max_count,
+                                     known_version, out_version);
+}
+
+/*
+ * pub_get_pheromone_matrix
+ * Copies up to n*n floats into 'out', returns the total count on success,
+ * negative on errors. Reads the published snapshot, so it never waits for a merge.
+ */
+int pub_get_pheromone_matrix(int context_id, float* out, int max_count)
+{
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx)
+    {
+        return ERR_INVALID_CONTEXT;
+    }
+
+    /* No snapshot store (allocation failed at init): export under aco_lock and ctx->lock. */
+    if (!ctx->pheromone_snapshots)
     {
 #ifndef _WIN32
-        pthread_mutex_unlock(&ctx->lock);
+        pthread_mutex_lock(&ctx->aco_lock);
+        antnet_perf_lock_context(ctx);
 #endif
-        return ERR_ARRAY_TOO_SMALL;
-    }
-    memcpy(out, ctx->aco_v1.pheromones, sizeof(float) * count);
+        int rc = ERR_NO_TOPOLOGY;
+        if (aco_v1_has_pheromones(&ctx->aco_v1))
+        {
+            int n = ctx->aco_v1.pheromone_size;
+            rc = (out && max_count < n * n) ? ERR_ARRAY_TOO_SMALL : n * n;
+            if (out && rc > 0)
+            {
+                aco_v1_export_pheromones(&ctx->aco_v1, out);
+            }
+        }
 #ifndef _WIN32
-    pthread_mutex_unlock(&ctx->lock);
+        pthread_mutex_unlock(&ctx->lock);
+        pthread_mutex_unlock(&ctx->aco_lock);
 #endif
+        return rc;
+    }
 
-    return count;
+    /* Versions start at 1, so known_version 0 always copies. */
+    return pub_get_pheromone_snapshot(context_id, out, max_count, 0, NULL);
 }
 
 /*
  * pub_get_algo_ranking
  * Returns the list of algorithms sorted by SASA score in descending order.
  * The caller provides a RankingEntry array with size max_count.
- * The function writes up to 3 entries in 'out' (one per solver).
- * If max_count < 3, returns ERR_ARRAY_TOO_SMALL.
- * On success, returns the number of algorithms (3).
+ * The function writes one entry per solver: 3, or 4 when the exact solver is enabled.
+ * If max_count is smaller than that, returns ERR_ARRAY_TOO_SMALL.
+ * On success, returns the number of entries written.
  */
 int pub_get_algo_ranking(int context_id, RankingEntry* out, int max_count)
 {
@@ -175,23 +240,35 @@ int pub_get_algo_ranking(int context_id, RankingEntry* out, int max_count)
         return ERR_INVALID_CONTEXT;
     }
 
+    priv_lock_solvers(ctx);
 #ifndef _WIN32
-    pthread_mutex_lock(&ctx->lock);
+    antnet_perf_lock_context(ctx);
+#endif
+
+    int count = ctx->exact_state.enabled ? 4 : 3;
+    if (max_count < count)
+    {
+#ifndef _WIN32
+        pthread_mutex_unlock(&ctx->lock);
 #endif
+        priv_unlock_solvers(ctx);
+        return ERR_ARRAY_TOO_SMALL;
+    }
 
-    SasaState states[3];
+    SasaState states[4];
     states[0] = ctx->aco_sasa;
     states[1] = ctx->random_sasa;
     states[2] = ctx->brute_sasa;
+    states[3] = ctx->exact_sasa;
 
-    int rank[3];
-    priv_compute_ranking(states, 3, rank);
+    int rank[4];
+    priv_compute_ranking(states, count, rank);
 
-    RankingEntry local[3];
+    RankingEntry local[4];
     memset(local, 0, sizeof(local));
 
     /* Fill local[] in descending order of score based on rank[] */
-    for (int i = 0; i < 3; i++)
+    for (int i = 0; i < count; i++)
     {
         int solver_idx = rank[i];
         if (solver_idx == 0)
@@ -206,21 +283,28 @@ int pub_get_algo_ranking(int context_id, RankingEntry* out, int max_count)
             local[i].score = ctx->random_sasa.score;
             local[i].latency_ms = ctx->random_best_latency;
         }
-        else
+        else if (solver_idx == 2)
         {
             strncpy(local[i].name, "BRUTE", sizeof(local[i].name) - 1);
             local[i].score = ctx->brute_sasa.score;
             local[i].latency_ms = ctx->brute_best_latency;
         }
+        else
+        {
+            strncpy(local[i].name, "EXACT", sizeof(local[i].name) - 1);
+            local[i].score = ctx->exact_sasa.score;
+            local[i].latency_ms = ctx->exact_best_latency;
+        }
     }
 
-    memcpy(out, local, sizeof(local));
+    memcpy(out, local, (size_t)count * sizeof(RankingEntry));
 
 #ifndef _WIN32
     pthread_mutex_unlock(&ctx->lock);
 #endif
+    priv_unlock_solvers(ctx);
 
-    return 3;
+    return count;
 }
 
 /*
@@ -236,7 +320,7 @@ int pub_set_sasa_params(int context_id, double alpha, double beta, double gamma)
     }
 
 #ifndef _WIN32
-    pthread_mutex_lock(&ctx->lock);
+    antnet_perf_lock_context(ctx);
 #endif
     ctx->sasa_coeffs.alpha = alpha;
     ctx->sasa_coeffs.beta  = beta;
@@ -266,7 +350,7 @@ int pub_get_sasa_params(int context_id, double* out_alpha, double* out_beta, dou
     }
 
 #ifndef _WIN32
-    pthread_mutex_lock(&ctx->lock);
+    antnet_perf_lock_context(ctx);
 #endif
     *out_alpha = ctx->sasa_coeffs.alpha;
     *out_beta  = ctx->sasa_coeffs.beta;
@@ -293,7 +377,8 @@ int pub_set_aco_params(int context_id, float alpha, float beta, float Q,
     }
 
 #ifndef _WIN32
-    pthread_mutex_lock(&ctx->lock);
+    pthread_mutex_lock(&ctx->aco_lock);
+    antnet_perf_lock_context(ctx);
 #endif
     ctx->aco_v1.alpha       = alpha;
     ctx->aco_v1.beta        = beta;
@@ -310,6 +395,7 @@ int pub_set_aco_params(int context_id, float alpha, float beta, float Q,
     }
 #ifndef _WIN32
     pthread_mutex_unlock(&ctx->lock);
+    pthread_mutex_unlock(&ctx->aco_lock);
 #endif
 
     return ERR_SUCCESS;
@@ -340,7 +426,7 @@ int pub_get_aco_params(
     }
 
 #ifndef _WIN32
-    pthread_mutex_lock(&ctx->lock);
+    antnet_perf_lock_context(ctx);
 #endif
     *out_alpha       = ctx->aco_v1.alpha;
     *out_beta        = ctx->aco_v1.beta;
@@ -353,3 +439,681 @@ int pub_get_aco_params(
 
     return ERR_SUCCESS;
 }
+
+/*
+ * pub_set_aco_construction_mode
+ * Switches between subset and edge-walk construction. Pheromones are kept: both modes
+ * deposit on the same n*n matrix, so a run can change mode between iterations.
+ */
+int pub_set_aco_construction_mode(int context_id, int mode)
+{
+    if (mode != ACO_CONSTRUCT_SUBSET && mode != ACO_CONSTRUCT_EDGE_WALK)
+    {
+        return ERR_INVALID_ARGS;
+    }
+
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx)
+    {
+        return ERR_INVALID_CONTEXT;
+    }
+
+#ifndef _WIN32
+    pthread_mutex_lock(&ctx->aco_lock);
+    pthread_mutex_lock(&ctx->exact_lock);
+    antnet_perf_lock_context(ctx);
+#endif
+    ctx->aco_v1.construction_mode = mode;
+    ctx->config.ant_construction  = mode;
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+    pthread_mutex_unlock(&ctx->exact_lock);
+    pthread_mutex_unlock(&ctx->aco_lock);
+#endif
+
+    return ERR_SUCCESS;
+}
+
+/*
+ * pub_get_aco_construction_mode
+ * Reads the current construction mode in a thread-safe manner.
+ */
+int pub_get_aco_construction_mode(int context_id, int* out_mode)
+{
+    if (!out_mode)
+    {
+        return ERR_INVALID_ARGS;
+    }
+
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx)
+    {
+        return ERR_INVALID_CONTEXT;
+    }
+
+#ifndef _WIN32
+    antnet_perf_lock_context(ctx);
+#endif
+    *out_mode = ctx->aco_v1.construction_mode;
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+#endif
+
+    return ERR_SUCCESS;
+}
+
+/*
+ * pub_set_aco_evaporation_mode
+ * Switches between path-only, global and lazy evaporation, effective from the next
+ * iteration. Leaving lazy mode materializes the pending evaporation first.
+ */
+int pub_set_aco_evaporation_mode(int context_id, int mode)
+{
+    if (mode != ACO_EVAPORATE_PATH && mode != ACO_EVAPORATE_GLOBAL && mode != ACO_EVAPORATE_LAZY)
+    {
+        return ERR_INVALID_ARGS;
+    }
+
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx)
+    {
+        return ERR_INVALID_CONTEXT;
+    }
+
+#ifndef _WIN32
+    pthread_mutex_lock(&ctx->aco_lock);
+    antnet_perf_lock_context(ctx);
+#endif
+    int rc = aco_v1_set_evaporation_mode(&ctx->aco_v1, mode);
+    if (rc == ERR_SUCCESS)
+    {
+        ctx->config.ant_evaporation_mode = mode;
+    }
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+    pthread_mutex_unlock(&ctx->aco_lock);
+#endif
+
+    return rc;
+}
+
+/*
+ * pub_get_aco_evaporation_mode
+ * Reads the current evaporation mode in a thread-safe manner.
+ */
+int pub_get_aco_evaporation_mode(int context_id, int* out_mode)
+{
+    if (!out_mode)
+    {
+        return ERR_INVALID_ARGS;
+    }
+
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx)
+    {
+        return ERR_INVALID_CONTEXT;
+    }
+
+#ifndef _WIN32
+    antnet_perf_lock_context(ctx);
+#endif
+    *out_mode = ctx->aco_v1.evaporation_mode;
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+#endif
+
+    return ERR_SUCCESS;
+}
+
+/*
+ * pub_set_aco_storage_mode
+ * Converts the pheromone matrix to float, fp16 or log16 storage in place; before the
+ * first iteration it only selects the format aco_v1_init allocates.
+ */
+int pub_set_aco_storage_mode(int context_id, int mode)
+{
+    if (mode != ACO_STORAGE_FLOAT && mode != ACO_STORAGE_FP16 && mode != ACO_STORAGE_LOG16)
+    {
+        return ERR_INVALID_ARGS;
+    }
+
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx)
+    {
+        return ERR_INVALID_CONTEXT;
+    }
+
+#ifndef _WIN32
+    pthread_mutex_lock(&ctx->aco_lock);
+    antnet_perf_lock_context(ctx);
+#endif
+    int rc = aco_v1_set_storage_mode(&ctx->aco_v1, mode);
+    if (rc == ERR_SUCCESS)
+    {
+        ctx->config.ant_storage_mode = mode;
+        /* Readers should see the rounded values right away, not after the next iteration. */
+        if (pheromone_snapshots_active(ctx->pheromone_snapshots))
+        {
+            pheromone_snapshots_publish(ctx->pheromone_snapshots, &ctx->aco_v1);
+        }
+    }
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+    pthread_mutex_unlock(&ctx->aco_lock);
+#endif
+
+    return rc;
+}
+
+/*
+ * pub_get_aco_storage_mode
+ * Reads the current pheromone storage format in a thread-safe manner.
+ */
+int pub_get_aco_storage_mode(int context_id, int* out_mode)
+{
+    if (!out_mode)
+    {
+        return ERR_INVALID_ARGS;
+    }
+
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx)
+    {
+        return ERR_INVALID_CONTEXT;
+    }
+
+#ifndef _WIN32
+    antnet_perf_lock_context(ctx);
+#endif
+    *out_mode = ctx->aco_v1.storage_mode;
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+#endif
+
+    return ERR_SUCCESS;
+}
+
+/*
+ * pub_set_aco_colonies
+ * Sets the colony count and migration schedule. A changed count rebuilds the extra
+ * colonies (fresh pheromones) on the next iteration; colony 0 keeps its matrix.
+ */
+int pub_set_aco_colonies(int context_id, int colony_count, int migration_interval, int migration_mode)
+{
+    if (colony_count < 1 || colony_count > ACO_MAX_COLONIES || migration_interval < 0 ||
+        (migration_mode != ACO_MIGRATE_BEST_PATH && migration_mode != ACO_MIGRATE_BLEND))
+    {
+        return ERR_INVALID_ARGS;
+    }
+
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx)
+    {
+        return ERR_INVALID_CONTEXT;
+    }
+
+#ifndef _WIN32
+    pthread_mutex_lock(&ctx->aco_lock);
+    antnet_perf_lock_context(ctx);
+#endif
+    ctx->aco_v1.colony_count       = colony_count;
+    ctx->aco_v1.migration_interval = migration_interval;
+    ctx->aco_v1.migration_mode     = migration_mode;
+    ctx->config.ant_colonies           = colony_count;
+    ctx->config.ant_migration_interval = migration_interval;
+    ctx->config.ant_migration_mode     = migration_mode;
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+    pthread_mutex_unlock(&ctx->aco_lock);
+#endif
+
+    return ERR_SUCCESS;
+}
+
+/*
+ * pub_get_aco_colonies
+ * Reads the colony count and migration schedule in a thread-safe manner.
+ */
+int pub_get_aco_colonies(int context_id, int* out_colony_count, int* out_migration_interval,
+                         int* out_migration_mode)
+{
+    if (!out_colony_count || !out_migration_interval || !out_migration_mode)
+    {
+        return ERR_INVALID_ARGS;
+    }
+
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx)
+    {
+        return ERR_INVALID_CONTEXT;
+    }
+
+#ifndef _WIN32
+    antnet_perf_lock_context(ctx);
+#endif
+    *out_colony_count       = (ctx->aco_v1.colony_count > 1) ? ctx->aco_v1.colony_count : 1;
+    *out_migration_interval = ctx->aco_v1.migration_interval;
+    *out_migration_mode     = ctx->aco_v1.migration_mode;
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+#endif
+
+    return ERR_SUCCESS;
+}
+
+/*
+ * pub_set_worker_threads
+ * Records the requested worker pool size. The pool itself is rebuilt by
+ * priv_get_worker_pool on the next multi-ant iteration.
+ */
+int pub_set_worker_threads(int context_id, int nb_threads)
+{
+    if (nb_threads < 0 || nb_threads > WORKER_POOL_MAX_THREADS)
+    {
+        return ERR_INVALID_ARGS;
+    }
+
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx)
+    {
+        return ERR_INVALID_CONTEXT;
+    }
+
+#ifndef _WIN32
+    pthread_mutex_lock(&ctx->run_lock);
+    antnet_perf_lock_context(ctx);
+#endif
+    ctx->worker_threads = nb_threads;
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+    pthread_mutex_unlock(&ctx->run_lock);
+#endif
+
+    return ERR_SUCCESS;
+}
+
+/*
+ * pub_set_seed
+ * Reseeds the context streams under the lock. The seed is also recorded in the
+ * context config so pub_get_config reflects it.
+ */
+int pub_set_seed(int context_id, uint64_t seed)
+{
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx)
+    {
+        return ERR_INVALID_CONTEXT;
+    }
+
+    priv_lock_solvers(ctx);
+#ifndef _WIN32
+    antnet_perf_lock_context(ctx);
+#endif
+    priv_seed_context(ctx, seed);
+    ctx->config.seed = seed;
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+#endif
+    priv_unlock_solvers(ctx);
+
+    return ERR_SUCCESS;
+}
+
+/*
+ * pub_get_seed
+ * Reads the effective seed in a thread-safe manner.
+ */
+int pub_get_seed(int context_id, uint64_t* out_seed)
+{
+    if (!out_seed)
+    {
+        return ERR_INVALID_ARGS;
+    }
+
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx)
+    {
+        return ERR_INVALID_CONTEXT;
+    }
+
+#ifndef _WIN32
+    antnet_perf_lock_context(ctx);
+#endif
+    *out_seed = ctx->rng_seed;
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+#endif
+
+    return ERR_SUCCESS;
+}
+
+/*
+ * pub_set_exact_solver
+ * Adds (enabled != 0) or removes the exact solver from pub_run_all_solvers and the ranking.
+ * Its SASA state restarts, so the ranking only compares it from the next run on.
+ */
+int pub_set_exact_solver(int context_id, int enabled)
+{
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx)
+    {
+        return ERR_INVALID_CONTEXT;
+    }
+
+#ifndef _WIN32
+    pthread_mutex_lock(&ctx->exact_lock);
+    antnet_perf_lock_context(ctx);
+#endif
+    int on = enabled ? 1 : 0;
+    if (ctx->exact_state.enabled != on)
+    {
+        ctx->exact_state.enabled = on;
+        priv_init_sasa_state(&ctx->exact_sasa);
+    }
+    ctx->config.exact_solver = on ? true : false;
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+    pthread_mutex_unlock(&ctx->exact_lock);
+#endif
+
+    return ERR_SUCCESS;
+}
+
+/*
+ * pub_get_exact_solver
+ * Reads whether the exact solver takes part in the runs, in a thread-safe manner.
+ */
+int pub_get_exact_solver(int context_id, int* out_enabled)
+{
+    if (!out_enabled)
+    {
+        return ERR_INVALID_ARGS;
+    }
+
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx)
+    {
+        return ERR_INVALID_CONTEXT;
+    }
+
+#ifndef _WIN32
+    antnet_perf_lock_context(ctx);
+#endif
+    *out_enabled = ctx->exact_state.enabled;
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+#endif
+
+    return ERR_SUCCESS;
+}
+
+/*
+ * pub_get_exact_path
+ * Solves the current topology exactly (or reuses the cached solve) whether or not the
+ * solver is enabled, and copies the optimum. out_lower_bound receives the cheapest walk
+ * cost: equal to the latency in subset mode, lower in edge mode when that walk repeats a
+ * node. Returns 0, ERR_NO_PATH_FOUND or a negative error code.
+ */
+int pub_get_exact_path(int context_id, int* out_nodes, int max_size,
+                       int* out_len, int* out_latency, int* out_lower_bound)
+{
+    if (!out_nodes || !out_len || !out_latency || max_size <= 0)
+    {
+        return ERR_INVALID_ARGS;
+    }
+
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx)
+    {
+        return ERR_INVALID_CONTEXT;
+    }
+
+    /*
+     * exact_lock alone, as in the solver task: a solve after a topology change can take a
+     * while and must not hold up ctx->lock. The exact state and best path are only
+     * written under exact_lock, so the copy needs no other lock.
+     */
+#ifndef _WIN32
+    pthread_mutex_lock(&ctx->exact_lock);
+#endif
+    int rc = exact_solver_search(ctx, 0, 1, out_nodes, max_size, out_len, out_latency);
+    if (out_lower_bound)
+    {
+        *out_lower_bound = ctx->exact_state.lower_bound;
+    }
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->exact_lock);
+#endif
+
+    return rc;
+}
+
+/*
+ * pub_set_brute_force_mode
+ * Selects permutation, branch-and-bound or parallel enumeration and the per-run budgets
+ * of the latter two. Changing the mode restarts the enumeration; the best path is kept.
+ */
+int pub_set_brute_force_mode(int context_id, int mode, int step_candidates, int step_time_us)
+{
+    if ((mode != BRUTE_MODE_PERMUTATION && mode != BRUTE_MODE_BRANCH_BOUND &&
+         mode != BRUTE_MODE_PARALLEL) ||
+        step_candidates < 0 || step_time_us < 0)
+    {
+        return ERR_INVALID_ARGS;
+    }
+
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx)
+    {
+        return ERR_INVALID_CONTEXT;
+    }
+
+#ifndef _WIN32
+    pthread_mutex_lock(&ctx->brute_lock);
+    antnet_perf_lock_context(ctx);
+#endif
+    ctx->brute_state.step_candidates = step_candidates;
+    ctx->brute_state.step_time_us    = step_time_us;
+    if (ctx->brute_state.mode != mode)
+    {
+        ctx->brute_state.mode = mode;
+        brute_force_reset_state(ctx);
+    }
+    ctx->config.brute_mode            = mode;
+    ctx->config.brute_step_candidates = step_candidates;
+    ctx->config.brute_step_time_us    = step_time_us;
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+    pthread_mutex_unlock(&ctx->brute_lock);
+#endif
+
+    return ERR_SUCCESS;
+}
+
+/*
+ * pub_get_brute_force_mode
+ * Reads the brute-force mode, its budgets and whether the enumeration finished.
+ * Any output pointer may be NULL.
+ */
+int pub_get_brute_force_mode(int context_id, int* out_mode, int* out_step_candidates,
+                             int* out_step_time_us, int* out_done)
+{
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx)
+    {
+        return ERR_INVALID_CONTEXT;
+    }
+
+#ifndef _WIN32
+    pthread_mutex_lock(&ctx->brute_lock);
+    antnet_perf_lock_context(ctx);
+#endif
+    if (out_mode)            *out_mode            = ctx->brute_state.mode;
+    if (out_step_candidates) *out_step_candidates = ctx->brute_state.step_candidates;
+    if (out_step_time_us)    *out_step_time_us    = ctx->brute_state.step_time_us;
+    if (out_done)            *out_done            = ctx->brute_state.done;
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+    pthread_mutex_unlock(&ctx->brute_lock);
+#endif
+
+    return ERR_SUCCESS;
+}
+
+/*
+ * pub_get_brute_force_checkpoint
+ * Copies the enumeration cursors, the incumbent and the best path into out, whose
+ * best_nodes holds max_path nodes. Only the branch-and-bound modes can be checkpointed.
+ */
+int pub_get_brute_force_checkpoint(int context_id, BruteForceCheckpoint* out, int max_path)
+{
+    if (!out || max_path < 0)
+    {
+        return ERR_INVALID_ARGS;
+    }
+
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx)
+    {
+        return ERR_INVALID_CONTEXT;
+    }
+
+#ifndef _WIN32
+    pthread_mutex_lock(&ctx->brute_lock);
+    antnet_perf_lock_context(ctx);
+#endif
+    const BruteForceState* st = &ctx->brute_state;
+    int rc = ERR_SUCCESS;
+    if (st->mode == BRUTE_MODE_PERMUTATION)
+    {
+        rc = ERR_INVALID_ARGS;
+    }
+    else if (ctx->brute_best_length > max_path)
+    {
+        rc = ERR_ARRAY_TOO_SMALL;
+    }
+    else
+    {
+        memset(out, 0, sizeof(*out));
+        out->signature    = st->signature;
+        out->mode         = st->mode;
+        out->current_L    = st->current_L;
+        out->done         = st->done;
+        out->best_latency = st->bb_best;
+        out->best_length  = ctx->brute_best_length;
+        out->best_path_latency = ctx->brute_best_latency;
+        memcpy(out->best_nodes, ctx->brute_best_nodes, sizeof(int) * (size_t)ctx->brute_best_length);
+
+        /* The sequential cursor is not rank based: such a length restarts on restore. */
+        if (st->mode == BRUTE_MODE_PARALLEL && st->par_L == st->current_L)
+        {
+            out->range_count = st->par_ranges;
+            memcpy(out->range_next, st->par_next, sizeof(st->par_next));
+            memcpy(out->range_end, st->par_end, sizeof(st->par_end));
+            memcpy(out->range_best, st->par_best, sizeof(st->par_best));
+            memcpy(out->range_best_rank, st->par_best_rank, sizeof(st->par_best_rank));
+        }
+    }
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+    pthread_mutex_unlock(&ctx->brute_lock);
+#endif
+
+    return rc;
+}
+
+/*
+ * pub_restore_brute_force_checkpoint
+ * Resumes an enumeration from a checkpoint taken on the same candidates, delays and
+ * hop range (matching signature), in the checkpoint's mode. On a mismatch the
+ * enumeration restarts from scratch in that mode and ERR_INVALID_ARGS is returned.
+ */
+int pub_restore_brute_force_checkpoint(int context_id, const BruteForceCheckpoint* cp)
+{
+    if (!cp || (cp->mode != BRUTE_MODE_BRANCH_BOUND && cp->mode != BRUTE_MODE_PARALLEL) ||
+        cp->range_count < 0 || cp->range_count > BRUTE_PARALLEL_RANGES ||
+        cp->best_length < 0)
+    {
+        return ERR_INVALID_ARGS;
+    }
+
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx)
+    {
+        return ERR_INVALID_CONTEXT;
+    }
+
+#ifndef _WIN32
+    pthread_mutex_lock(&ctx->brute_lock);
+    antnet_perf_lock_context(ctx);
+#endif
+    BruteForceState* st = &ctx->brute_state;
+    st->mode = cp->mode;
+    ctx->config.brute_mode = cp->mode;
+    brute_force_reset_state(ctx);
+
+    int rc = ERR_SUCCESS;
+    if (st->signature != cp->signature || cp->best_length > ctx->path_capacity ||
+        cp->current_L < ctx->min_hops || cp->current_L > ctx->max_hops + 1)
+    {
+        rc = ERR_INVALID_ARGS;
+    }
+    for (int i = 0; rc == ERR_SUCCESS && i < cp->best_length; i++)
+    {
+        if (cp->best_nodes[i] < 0 || cp->best_nodes[i] >= ctx->num_nodes)
+        {
+            rc = ERR_INVALID_ARGS;
+        }
+    }
+
+    /* Cursors must lie in the ranges this state splits the length into. */
+    if (rc == ERR_SUCCESS && cp->range_count > 0)
+    {
+        if (cp->mode != BRUTE_MODE_PARALLEL ||
+            !brute_parallel_split(ctx, cp->current_L) || st->par_ranges != cp->range_count)
+        {
+            rc = ERR_INVALID_ARGS;
+        }
+        for (int k = 0; rc == ERR_SUCCESS && k < cp->range_count; k++)
+        {
+            if (cp->range_end[k] != st->par_end[k] || cp->range_next[k] < st->par_next[k] ||
+                cp->range_next[k] > cp->range_end[k] ||
+                (cp->range_best[k] >= 0 && (cp->range_best_rank[k] < st->par_next[k] ||
+                                            cp->range_best_rank[k] >= cp->range_end[k])))
+            {
+                rc = ERR_INVALID_ARGS;
+            }
+        }
+        if (rc == ERR_SUCCESS)
+        {
+            memcpy(st->par_next, cp->range_next, sizeof(st->par_next));
+            memcpy(st->par_best, cp->range_best, sizeof(st->par_best));
+            memcpy(st->par_best_rank, cp->range_best_rank, sizeof(st->par_best_rank));
+        }
+        else
+        {
+            st->par_L = -1;
+            st->par_ranges = 0;
+        }
+    }
+
+    if (rc == ERR_SUCCESS)
+    {
+        st->current_L = cp->current_L;
+        st->done      = cp->done;
+        st->bb_best   = cp->best_latency;
+        if (cp->best_length > 0 &&
+            (ctx->brute_best_length == 0 || cp->best_path_latency < ctx->brute_best_latency))
+        {
+            ctx->brute_best_length  = cp->best_length;
+            ctx->brute_best_latency = cp->best_path_latency;
+            memcpy(ctx->brute_best_nodes, cp->best_nodes, sizeof(int) * (size_t)cp->best_length);
+        }
+    }
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+    pthread_mutex_unlock(&ctx->brute_lock);
+#endif
+
+    return rc;
+}
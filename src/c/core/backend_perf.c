@@ -0,0 +1,105 @@
+/* Relative Path: src/c/core/backend_perf.c */
+/*
+ * Implements the per-context phase counters: relaxed atomic sums and a CAS maximum.
+ * Readers copy the counters field by field, so a snapshot may mix samples being recorded.
+*/
+
+#include "../../../include/core/backend_perf.h"
+#include "../../../include/core/backend_init.h"
+#include "../../../include/consts/error_codes.h"
+
+#include <string.h>
+#include <time.h>
+
+#if defined(__GNUC__)
+#define PERF_LOAD(p)      __atomic_load_n((p), __ATOMIC_RELAXED)
+#define PERF_STORE(p, v)  __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+#define PERF_ADD(p, v)    __atomic_fetch_add((p), (v), __ATOMIC_RELAXED)
+#define PERF_CAS(p, e, v) __atomic_compare_exchange_n((p), (e), (v), 1, \
+                                                      __ATOMIC_RELAXED, __ATOMIC_RELAXED)
+#else
+/* No atomics: matches the _WIN32 fallback, which runs without worker threads or locks. */
+#define PERF_LOAD(p)      (*(p))
+#define PERF_STORE(p, v)  (*(p) = (v))
+#define PERF_ADD(p, v)    (*(p) += (v))
+#define PERF_CAS(p, e, v) ((*(p) = (v)), 1)
+#endif
+
+uint64_t antnet_perf_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* Internal helper: perf_add_sample, one sample of elapsed_ns to phase. */
+static void perf_add_sample(AntNetPerfCounters* perf, int phase, uint64_t elapsed_ns)
+{
+    PERF_ADD(&perf->calls[phase], 1);
+    PERF_ADD(&perf->total_ns[phase], elapsed_ns);
+    uint64_t seen = PERF_LOAD(&perf->max_ns[phase]);
+    while (elapsed_ns > seen && !PERF_CAS(&perf->max_ns[phase], &seen, elapsed_ns)) {
+        /* seen was refreshed by the failed exchange */
+    }
+}
+
+void antnet_perf_record(AntNetContext* ctx, int phase, uint64_t start_ns)
+{
+    if (!ctx || phase < 0 || phase >= ANTNET_PERF_PHASES) {
+        return;
+    }
+    uint64_t now = antnet_perf_now_ns();
+    perf_add_sample(&ctx->perf, phase, now > start_ns ? now - start_ns : 0);
+}
+
+#ifndef _WIN32
+void antnet_perf_lock_context(AntNetContext* ctx)
+{
+    if (pthread_mutex_trylock(&ctx->lock) == 0) {
+        perf_add_sample(&ctx->perf, ANTNET_PERF_LOCK_WAIT, 0);
+        return;
+    }
+    uint64_t start = antnet_perf_now_ns();
+    pthread_mutex_lock(&ctx->lock);
+    antnet_perf_record(ctx, ANTNET_PERF_LOCK_WAIT, start);
+}
+#endif
+
+/*
+ * pub_get_perf_counters
+ * Copies the phase counters of the context. Lock-free; counters keep running.
+ */
+int pub_get_perf_counters(int context_id, AntNetPerfCounters* out)
+{
+    if (!out) {
+        return ERR_INVALID_ARGS;
+    }
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx) {
+        return ERR_INVALID_CONTEXT;
+    }
+    for (int i = 0; i < ANTNET_PERF_PHASES; i++) {
+        out->calls[i]    = PERF_LOAD(&ctx->perf.calls[i]);
+        out->total_ns[i] = PERF_LOAD(&ctx->perf.total_ns[i]);
+        out->max_ns[i]   = PERF_LOAD(&ctx->perf.max_ns[i]);
+    }
+    return ERR_SUCCESS;
+}
+
+/*
+ * pub_reset_perf_counters
+ * Zeroes the counters, e.g. at the start of a measurement window.
+ */
+int pub_reset_perf_counters(int context_id)
+{
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx) {
+        return ERR_INVALID_CONTEXT;
+    }
+    for (int i = 0; i < ANTNET_PERF_PHASES; i++) {
+        PERF_STORE(&ctx->perf.calls[i], 0);
+        PERF_STORE(&ctx->perf.total_ns[i], 0);
+        PERF_STORE(&ctx->perf.max_ns[i], 0);
+    }
+    return ERR_SUCCESS;
+}
@@ -0,0 +1,388 @@
+/* Relative Path: src/c/core/backend_results.c */
+/*
+ * Implements the results store: regions rewritten in place under a sequence lock, so
+ * readers wrap them without a copy and detect torn reads, plus per-region reader pins
+ * that keep a region allocated while anyone wraps it, even past pub_shutdown.
+*/
+
+#include "../../../include/core/backend_results.h"
+#include "../../../include/core/backend_init.h"
+#include "../../../include/algo/cpu/cpu_ACOv1.h"
+#include "../../../include/algo/cpu/cpu_ACOv1_path_reorder.h"
+#include "../../../include/consts/error_codes.h"
+
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+#if defined(__GNUC__)
+#define RES_LOAD(p)          __atomic_load_n((p), __ATOMIC_SEQ_CST)
+#define RES_STORE(p, v)      __atomic_store_n((p), (v), __ATOMIC_SEQ_CST)
+#define RES_ADD(p, v)        __atomic_add_fetch((p), (v), __ATOMIC_SEQ_CST)
+#define RES_STORE_RELEASE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define RES_FENCE_RELEASE()  __atomic_thread_fence(__ATOMIC_RELEASE)
+#else
+/* No atomics: matches the _WIN32 fallback, which runs without worker threads or locks. */
+#define RES_LOAD(p)          (*(p))
+#define RES_STORE(p, v)      (*(p) = (v))
+#define RES_ADD(p, v)        (*(p) += (v))
+#define RES_STORE_RELEASE(p, v) (*(p) = (v))
+#define RES_FENCE_RELEASE()  ((void)0)
+#endif
+
+/* Arrays start on cache lines, which also suits any numpy dtype. */
+#define RESULTS_ALIGN 64
+
+/*
+ * ResultsSlot
+ * region is reallocated by the publisher only while the slot is neither published nor
+ * pinned; pinned readers use it only after confirming it is published.
+ */
+typedef struct ResultsSlot
+{
+    AntNetResultsHeader* region;
+    uint64_t bytes;    /* size of the current layout */
+    uint64_t capacity; /* bytes allocated in region */
+    int      readers;  /* active pins, atomic */
+} ResultsSlot;
+
+struct ResultsStore
+{
+    ResultsSlot slots[RESULTS_REGION_SLOTS];
+    int      published;    /* slot index, -1 when none; atomic */
+    int      active;       /* set by the first reader; atomic */
+    uint64_t last_version; /* writers only, under ctx->lock */
+    int      retired;      /* on the retired list; retired lock */
+    int      orphaned;     /* destroyed by its context, freed with the last pin; retired lock */
+    struct ResultsStore* next_retired; /* retired lock */
+};
+
+/*
+ * Stores of shut down contexts whose regions may still be pinned. Their handles no longer
+ * resolve, so pub_results_release finds them here by region.
+ */
+static ResultsStore* g_retired = NULL;
+#ifndef _WIN32
+static pthread_mutex_t g_retired_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+static uint64_t results_align(uint64_t bytes)
+{
+    return (bytes + RESULTS_ALIGN - 1) / RESULTS_ALIGN * RESULTS_ALIGN;
+}
+
+ResultsStore* results_store_create(void)
+{
+    ResultsStore* store = (ResultsStore*)calloc(1, sizeof(ResultsStore));
+    if (store) {
+        store->published = -1;
+    }
+    return store;
+}
+
+/*
+ * Internal helper: results_store_pinned
+ * Non-zero while any region of store is pinned.
+ */
+static int results_store_pinned(ResultsStore* store)
+{
+    for (int i = 0; i < RESULTS_REGION_SLOTS; i++) {
+        if (RES_LOAD(&store->slots[i].readers) > 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Internal helper: results_store_free
+ * Unlinks store from the retired list and frees it. Caller holds g_retired_lock.
+ */
+static void results_store_free(ResultsStore* store)
+{
+    if (store->retired) {
+        ResultsStore** link = &g_retired;
+        while (*link != store) {
+            link = &(*link)->next_retired;
+        }
+        *link = store->next_retired;
+    }
+    for (int i = 0; i < RESULTS_REGION_SLOTS; i++) {
+        free(store->slots[i].region);
+    }
+    free(store);
+}
+
+void results_store_retire(ResultsStore* store)
+{
+    if (!store) {
+        return;
+    }
+#ifndef _WIN32
+    pthread_mutex_lock(&g_retired_lock);
+#endif
+    if (!store->retired) {
+        store->retired = 1;
+        store->next_retired = g_retired;
+        g_retired = store;
+    }
+#ifndef _WIN32
+    pthread_mutex_unlock(&g_retired_lock);
+#endif
+}
+
+void results_store_destroy(ResultsStore* store)
+{
+    if (!store) {
+        return;
+    }
+    results_store_retire(store);
+#ifndef _WIN32
+    pthread_mutex_lock(&g_retired_lock);
+#endif
+    store->orphaned = 1;
+    if (!results_store_pinned(store)) {
+        results_store_free(store);
+    }
+#ifndef _WIN32
+    pthread_mutex_unlock(&g_retired_lock);
+#endif
+}
+
+int results_store_active(const ResultsStore* store)
+{
+    return store ? RES_LOAD(&store->active) : 0;
+}
+
+int results_store_has_region(const ResultsStore* store)
+{
+    return store ? RES_LOAD(&store->published) >= 0 : 0;
+}
+
+/*
+ * Internal helper: results_layout
+ * Sets the offsets of a region for an n x n matrix and path_capacity ints per path,
+ * returning its size in bytes.
+ */
+static uint64_t results_layout(AntNetResultsHeader* h, int n, int path_capacity)
+{
+    uint64_t cells = (uint64_t)n * (uint64_t)n;
+    h->pheromone_offset = results_align(sizeof(AntNetResultsHeader));
+    h->strength_offset  = h->pheromone_offset + results_align(cells * sizeof(float));
+    h->paths_offset     = h->strength_offset + results_align((uint64_t)n * sizeof(float));
+    h->num_nodes        = n;
+    h->path_capacity    = path_capacity;
+    return h->paths_offset +
+           (uint64_t)ANTNET_RESULTS_PATHS * (uint64_t)path_capacity * sizeof(int);
+}
+
+/*
+ * Internal helper: results_write
+ * Rewrites every array of h between an odd and the next even seq.
+ */
+static void results_write(AntNetResultsHeader* h, const AcoV1State* aco,
+                          const ResultsPath paths[ANTNET_RESULTS_PATHS],
+                          uint64_t iteration, uint64_t version)
+{
+    uint64_t seq = h->seq;
+    RES_STORE(&h->seq, seq + 1);
+    RES_FENCE_RELEASE();
+
+    int n = h->num_nodes;
+    char* base = (char*)h;
+    float* pheromones = (float*)(base + h->pheromone_offset);
+    float* strength   = (float*)(base + h->strength_offset);
+    int* rows         = (int*)(base + h->paths_offset);
+
+    if (n > 0) {
+        aco_v1_export_pheromones(aco, pheromones);
+    }
+    for (int i = 0; i < n; i++) {
+        const float* row = pheromones + (size_t)i * (size_t)n;
+        float best = 0.0f;
+        for (int j = 0; j < n; j++) {
+            if (j != i && row[j] > best) {
+                best = row[j];
+            }
+        }
+        strength[i] = best;
+    }
+
+    for (int p = 0; p < ANTNET_RESULTS_PATHS; p++) {
+        int length = paths[p].nodes ? paths[p].length : 0;
+        if (length > h->path_capacity) {
+            length = 0;
+        }
+        int* row = rows + (size_t)p * (size_t)h->path_capacity;
+        if (length > 0) {
+            memcpy(row, paths[p].nodes, (size_t)length * sizeof(int));
+        }
+        /* Same order as the solver calls return, see aco_v1_get_best_path. */
+        if (p == ANTNET_RESULTS_PATH_ACO && aco->construction_mode != ACO_CONSTRUCT_EDGE_WALK) {
+            aco_v1_reorder_path_for_display(row, length);
+        }
+        h->path_length[p]  = length;
+        h->path_latency[p] = (length > 0) ? paths[p].latency : 0;
+    }
+    h->iteration = iteration;
+    h->version   = version;
+
+    RES_STORE_RELEASE(&h->seq, seq + 2);
+}
+
+int results_store_publish(ResultsStore* store, const AcoV1State* aco, int path_capacity,
+                          const ResultsPath paths[ANTNET_RESULTS_PATHS], uint64_t iteration)
+{
+    if (!store || !aco || !paths || path_capacity < 0) {
+        return ERR_INVALID_ARGS;
+    }
+
+    int n = aco_v1_has_pheromones(aco) ? aco->pheromone_size : 0;
+    int current = RES_LOAD(&store->published);
+    if (current >= 0) {
+        AntNetResultsHeader* h = store->slots[current].region;
+        if (h->num_nodes == n && h->path_capacity == path_capacity) {
+            results_write(h, aco, paths, iteration, ++store->last_version);
+            return ERR_SUCCESS;
+        }
+    }
+
+    /* New layout: fill a slot nobody can reach, then switch readers over to it. */
+    int target = -1;
+    for (int i = 0; i < RESULTS_REGION_SLOTS; i++) {
+        if (i != current && RES_LOAD(&store->slots[i].readers) == 0) {
+            target = i;
+            break;
+        }
+    }
+    if (target < 0) {
+        return ERR_SUCCESS; /* the spare region is pinned: keep the current one */
+    }
+
+    ResultsSlot* slot = &store->slots[target];
+    AntNetResultsHeader layout;
+    memset(&layout, 0, sizeof(layout));
+    uint64_t bytes = results_layout(&layout, n, path_capacity);
+    if (slot->capacity < bytes) {
+        AntNetResultsHeader* grown = (AntNetResultsHeader*)realloc(slot->region, (size_t)bytes);
+        if (!grown) {
+            return ERR_MEMORY_ALLOCATION;
+        }
+        slot->region   = grown;
+        slot->capacity = bytes;
+    }
+    layout.seq = (slot->bytes > 0) ? slot->region->seq : 0; /* even: never left mid-write */
+    *slot->region = layout;
+    slot->bytes = bytes;
+
+    results_write(slot->region, aco, paths, iteration, ++store->last_version);
+    RES_STORE(&store->published, target);
+    return ERR_SUCCESS;
+}
+
+int results_store_acquire(ResultsStore* store, AntNetResultsHeader** out_region,
+                          uint64_t* out_bytes)
+{
+    if (!store) {
+        return ERR_NO_TOPOLOGY;
+    }
+    if (!out_region || !out_bytes) {
+        return ERR_INVALID_ARGS;
+    }
+    RES_STORE(&store->active, 1);
+
+    /* Pin, then confirm the slot is still the published one; otherwise retry. */
+    for (;;) {
+        int index = RES_LOAD(&store->published);
+        if (index < 0) {
+            return ERR_NO_TOPOLOGY;
+        }
+        ResultsSlot* slot = &store->slots[index];
+        RES_ADD(&slot->readers, 1);
+        if (RES_LOAD(&store->published) == index) {
+            *out_region = slot->region;
+            *out_bytes  = slot->bytes;
+            return ERR_SUCCESS;
+        }
+        RES_ADD(&slot->readers, -1);
+    }
+}
+
+int results_store_release(ResultsStore* store, const AntNetResultsHeader* region)
+{
+    if (!store || !region) {
+        return ERR_INVALID_ARGS;
+    }
+    for (int i = 0; i < RESULTS_REGION_SLOTS; i++) {
+        ResultsSlot* slot = &store->slots[i];
+        if (slot->region == region && RES_LOAD(&slot->readers) > 0) {
+            RES_ADD(&slot->readers, -1);
+            return ERR_SUCCESS;
+        }
+    }
+    return ERR_INVALID_ARGS;
+}
+
+/*
+ * pub_results_acquire
+ * Pins the published region of the context; the first call also starts publishing.
+ */
+int pub_results_acquire(int context_id, void** out_region, uint64_t* out_bytes)
+{
+    if (!out_region || !out_bytes) {
+        return ERR_INVALID_ARGS;
+    }
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx) {
+        return ERR_INVALID_CONTEXT;
+    }
+    AntNetResultsHeader* region = NULL;
+    int rc = results_store_acquire(ctx->results, &region, out_bytes);
+    *out_region = region;
+    return rc;
+}
+
+/*
+ * Internal helper: results_release_retired
+ * Unpins region in whichever retired store holds it, freeing the store with its last pin
+ * once its context is gone. ERR_INVALID_ARGS if no retired store holds region.
+ */
+static int results_release_retired(const AntNetResultsHeader* region)
+{
+    int rc = ERR_INVALID_ARGS;
+#ifndef _WIN32
+    pthread_mutex_lock(&g_retired_lock);
+#endif
+    for (ResultsStore* store = g_retired; store; store = store->next_retired) {
+        if (results_store_release(store, region) == ERR_SUCCESS) {
+            if (store->orphaned && !results_store_pinned(store)) {
+                results_store_free(store);
+            }
+            rc = ERR_SUCCESS;
+            break;
+        }
+    }
+#ifndef _WIN32
+    pthread_mutex_unlock(&g_retired_lock);
+#endif
+    return rc;
+}
+
+/*
+ * pub_results_release
+ * Unpins a region returned by pub_results_acquire. Still works once the context is shut
+ * down, since its regions stay allocated until the last release.
+ */
+int pub_results_release(int context_id, void* region)
+{
+    if (!region) {
+        return ERR_INVALID_ARGS;
+    }
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx) {
+        return results_release_retired((const AntNetResultsHeader*)region);
+    }
+    return results_store_release(ctx->results, (const AntNetResultsHeader*)region);
+}
@@ -0,0 +1,101 @@
+/* Relative Path: src/c/core/backend_rng.c */
+/*
+ * Implements the xoshiro256** generator and its splitmix64 seeding.
+ * All state lives in the caller's AntNetRng, so concurrent streams need no locking.
+ * Used by the ACO, random and hop map code in place of rand()/srand().
+*/
+
+#include "../../../include/core/backend_rng.h"
+
+#include <time.h>
+
+/*
+ * Internal helper: splitmix64
+ * Advances *x and returns a well-mixed 64-bit value. Used only for seeding.
+ */
+static uint64_t splitmix64(uint64_t* x)
+{
+    uint64_t z = (*x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static uint64_t rotl64(uint64_t v, int k)
+{
+    return (v << k) | (v >> (64 - k));
+}
+
+void antnet_rng_seed_stream(AntNetRng* rng, uint64_t seed, uint64_t stream)
+{
+    if (!rng) {
+        return;
+    }
+
+    /* Mix the stream id separately so (seed, stream) and (seed+1, stream-1) do not collide. */
+    uint64_t stream_mix = stream;
+    uint64_t x = seed ^ splitmix64(&stream_mix);
+
+    for (int i = 0; i < 4; i++) {
+        rng->s[i] = splitmix64(&x);
+    }
+    if ((rng->s[0] | rng->s[1] | rng->s[2] | rng->s[3]) == 0) {
+        rng->s[0] = 1; /* xoshiro must not start from the all-zero state */
+    }
+}
+
+uint64_t antnet_rng_time_seed(void)
+{
+    uint64_t seed = (uint64_t)time(NULL);
+#if !defined(_WIN32) && defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
+        seed ^= ((uint64_t)ts.tv_sec << 32) ^ (uint64_t)ts.tv_nsec;
+    }
+#endif
+    uint64_t x = seed;
+    seed = splitmix64(&x);
+    return seed ? seed : 1;
+}
+
+uint64_t antnet_rng_next_u64(AntNetRng* rng)
+{
+    uint64_t* s = rng->s;
+    uint64_t result = rotl64(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl64(s[3], 45);
+
+    return result;
+}
+
+int antnet_rng_next_int(AntNetRng* rng, int bound)
+{
+    if (bound <= 1) {
+        return 0;
+    }
+
+    /* Lemire's multiply-shift with rejection of the biased low range. */
+    uint32_t range = (uint32_t)bound;
+    uint64_t m = (uint64_t)(uint32_t)(antnet_rng_next_u64(rng) >> 32) * range;
+    uint32_t low = (uint32_t)m;
+    if (low < range) {
+        uint32_t threshold = (uint32_t)(-range) % range;
+        while (low < threshold) {
+            m = (uint64_t)(uint32_t)(antnet_rng_next_u64(rng) >> 32) * range;
+            low = (uint32_t)m;
+        }
+    }
+    return (int)(m >> 32);
+}
+
+float antnet_rng_next_float(AntNetRng* rng)
+{
+    /* 24 high bits fill the float mantissa exactly, the result stays below 1.0f. */
+    return (float)(antnet_rng_next_u64(rng) >> 40) * (1.0f / 16777216.0f);
+}
@@ -0,0 +1,159 @@
+/* Relative Path: src/c/core/backend_snapshot.c */
+/*
+ * Implements lock-free pheromone snapshots with per-slot reader pins (a small RCU).
+ * A reader pins the published slot and re-checks it is still published before copying;
+ * the writer fills a slot that is neither published nor pinned, then publishes it.
+*/
+
+#include "../../../include/core/backend_snapshot.h"
+#include "../../../include/algo/cpu/cpu_ACOv1.h"
+#include "../../../include/consts/error_codes.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__GNUC__)
+#define SNAP_LOAD(p)     __atomic_load_n((p), __ATOMIC_SEQ_CST)
+#define SNAP_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_SEQ_CST)
+#define SNAP_ADD(p, v)   __atomic_add_fetch((p), (v), __ATOMIC_SEQ_CST)
+#else
+/* No atomics: matches the _WIN32 fallback, which runs without worker threads or locks. */
+#define SNAP_LOAD(p)     (*(p))
+#define SNAP_STORE(p, v) (*(p) = (v))
+#define SNAP_ADD(p, v)   (*(p) += (v))
+#endif
+
+/*
+ * PheromoneSnapshotSlot
+ * data/count/version are written by the publisher only while the slot is neither
+ * published nor pinned, and read by pinned readers only after it is published.
+ */
+typedef struct PheromoneSnapshotSlot
+{
+    float*   data;
+    size_t   capacity; /* floats allocated in data */
+    int      count;    /* n*n of this snapshot */
+    uint64_t version;
+    int      readers;  /* active pins, atomic */
+} PheromoneSnapshotSlot;
+
+struct PheromoneSnapshots
+{
+    PheromoneSnapshotSlot slots[PHEROMONE_SNAPSHOT_SLOTS];
+    int      published;    /* slot index, -1 when none; atomic */
+    int      active;       /* set by the first reader; atomic */
+    uint64_t last_version; /* writers only, under ctx->lock */
+};
+
+PheromoneSnapshots* pheromone_snapshots_create(void)
+{
+    PheromoneSnapshots* snaps = (PheromoneSnapshots*)calloc(1, sizeof(PheromoneSnapshots));
+    if (snaps) {
+        snaps->published = -1;
+    }
+    return snaps;
+}
+
+void pheromone_snapshots_destroy(PheromoneSnapshots* snaps)
+{
+    if (!snaps) {
+        return;
+    }
+    for (int i = 0; i < PHEROMONE_SNAPSHOT_SLOTS; i++) {
+        free(snaps->slots[i].data);
+    }
+    free(snaps);
+}
+
+int pheromone_snapshots_active(const PheromoneSnapshots* snaps)
+{
+    return snaps ? SNAP_LOAD(&snaps->active) : 0;
+}
+
+int pheromone_snapshots_publish(PheromoneSnapshots* snaps, const AcoV1State* state)
+{
+    if (!snaps) {
+        return ERR_INVALID_ARGS;
+    }
+    if (!aco_v1_has_pheromones(state)) {
+        return ERR_NO_TOPOLOGY;
+    }
+
+    int current = SNAP_LOAD(&snaps->published);
+    int target = -1;
+    for (int i = 0; i < PHEROMONE_SNAPSHOT_SLOTS; i++) {
+        if (i != current && SNAP_LOAD(&snaps->slots[i].readers) == 0) {
+            target = i;
+            break;
+        }
+    }
+    if (target < 0) {
+        return ERR_SUCCESS; /* every spare slot is pinned: keep the current snapshot */
+    }
+
+    PheromoneSnapshotSlot* slot = &snaps->slots[target];
+    int n = state->pheromone_size;
+    size_t count = (size_t)n * (size_t)n;
+    if (slot->capacity < count) {
+        float* grown = (float*)realloc(slot->data, count * sizeof(float));
+        if (!grown) {
+            return ERR_MEMORY_ALLOCATION;
+        }
+        slot->data     = grown;
+        slot->capacity = count;
+    }
+
+    aco_v1_export_pheromones(state, slot->data);
+    slot->count   = (int)count;
+    slot->version = ++snaps->last_version;
+    SNAP_STORE(&snaps->published, target);
+    return ERR_SUCCESS;
+}
+
+void pheromone_snapshots_invalidate(PheromoneSnapshots* snaps)
+{
+    if (snaps) {
+        SNAP_STORE(&snaps->published, -1);
+    }
+}
+
+int pheromone_snapshots_read(PheromoneSnapshots* snaps, float* out, int max_count,
+                             uint64_t known_version, uint64_t* out_version)
+{
+    if (!snaps) {
+        return ERR_NO_TOPOLOGY;
+    }
+    SNAP_STORE(&snaps->active, 1);
+
+    /* Pin, then confirm the slot is still the published one; otherwise retry. */
+    PheromoneSnapshotSlot* slot;
+    for (;;) {
+        int index = SNAP_LOAD(&snaps->published);
+        if (index < 0) {
+            return ERR_NO_TOPOLOGY;
+        }
+        slot = &snaps->slots[index];
+        SNAP_ADD(&slot->readers, 1);
+        if (SNAP_LOAD(&snaps->published) == index) {
+            break;
+        }
+        SNAP_ADD(&slot->readers, -1);
+    }
+
+    int rc;
+    if (out_version) {
+        *out_version = slot->version;
+    }
+    if (!out) {
+        rc = slot->count; /* size query */
+    } else if (slot->version == known_version) {
+        rc = 0;
+    } else if (max_count < slot->count) {
+        rc = ERR_ARRAY_TOO_SMALL;
+    } else {
+        memcpy(out, slot->data, (size_t)slot->count * sizeof(float));
+        rc = slot->count;
+    }
+    SNAP_ADD(&slot->readers, -1);
+    return rc;
+}
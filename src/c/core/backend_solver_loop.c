@@ -0,0 +1,377 @@
+/* Relative Path: src/c/core/backend_solver_loop.c */
+/*
+ * Implements the solver loop: one native thread per context running solver iterations
+ * back to back. It writes to an eventfd (a pipe off Linux) after improvements and at a
+ * progress interval, so an event loop watching the descriptor wakes only for news.
+*/
+
+#include "../../../include/core/backend_solver_loop.h"
+#include "../../../include/core/backend_solvers.h"
+#include "../../../include/core/backend_log.h"
+#include "../../../include/core/backend_perf.h"
+#include "../../../include/consts/error_codes.h"
+
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#include <pthread.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#endif
+#endif
+
+#if defined(__GNUC__)
+#define LOOP_LOAD(p)     __atomic_load_n((p), __ATOMIC_SEQ_CST)
+#define LOOP_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_SEQ_CST)
+#define LOOP_ADD(p, v)   __atomic_add_fetch((p), (v), __ATOMIC_SEQ_CST)
+#else
+/* No atomics: matches the _WIN32 fallback, which never starts the loop thread. */
+#define LOOP_LOAD(p)     (*(p))
+#define LOOP_STORE(p, v) (*(p) = (v))
+#define LOOP_ADD(p, v)   (*(p) += (v))
+#endif
+
+/* Wait before retrying while solvers fail, typically before the first topology. */
+#define SOLVER_LOOP_IDLE_MS 20
+
+/*
+ * SolverLoop
+ * control serializes start, stop and close, and is held while joining the thread.
+ * lock only guards stop, so the thread never waits on a joining caller.
+ */
+struct SolverLoop
+{
+#ifndef _WIN32
+    pthread_mutex_t control;
+    pthread_mutex_t lock;
+    pthread_cond_t  wake;    /* signaled on stop, ends the idle wait */
+    pthread_t       thread;
+#endif
+    struct AntNetContext* ctx;
+    int  context_id;         /* handle for log lines, which outlive it during shutdown */
+    int  stop;               /* lock */
+    int  closed;             /* control; set by pub_shutdown */
+    int  running;            /* atomic, written under control */
+    int  progress_ms;        /* atomic */
+    int  fd_read;            /* -1 until the first start */
+    int  fd_write;           /* same as fd_read for an eventfd */
+    int* scratch;            /* three path rows of capacity ints, thread only */
+    int  capacity;
+    uint64_t iterations;     /* atomic */
+    uint64_t improvements;   /* atomic */
+};
+
+SolverLoop* solver_loop_create(void)
+{
+    SolverLoop* loop = (SolverLoop*)calloc(1, sizeof(SolverLoop));
+    if (!loop) {
+        return NULL;
+    }
+#ifndef _WIN32
+    pthread_mutex_init(&loop->control, NULL);
+    pthread_mutex_init(&loop->lock, NULL);
+    pthread_cond_init(&loop->wake, NULL);
+#endif
+    loop->fd_read  = -1;
+    loop->fd_write = -1;
+    return loop;
+}
+
+#ifndef _WIN32
+/*
+ * Internal helper: loop_open_fd
+ * Opens the non-blocking descriptor pair. Returns ERR_SUCCESS or ERR_INTERNAL_FAILURE.
+ */
+static int loop_open_fd(SolverLoop* loop)
+{
+#if defined(__linux__)
+    int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (fd < 0) {
+        return ERR_INTERNAL_FAILURE;
+    }
+    loop->fd_read  = fd;
+    loop->fd_write = fd;
+#else
+    int fds[2];
+    if (pipe(fds) != 0) {
+        return ERR_INTERNAL_FAILURE;
+    }
+    for (int i = 0; i < 2; i++) {
+        fcntl(fds[i], F_SETFL, fcntl(fds[i], F_GETFL) | O_NONBLOCK);
+        fcntl(fds[i], F_SETFD, FD_CLOEXEC);
+    }
+    loop->fd_read  = fds[0];
+    loop->fd_write = fds[1];
+#endif
+    return ERR_SUCCESS;
+}
+
+/*
+ * Internal helper: loop_signal
+ * Makes fd_read readable. A full pipe or counter already has a wakeup pending.
+ */
+static void loop_signal(SolverLoop* loop)
+{
+#if defined(__linux__)
+    uint64_t one = 1;
+#else
+    char one = 1;
+#endif
+    ssize_t written = write(loop->fd_write, &one, sizeof(one));
+    (void)written;
+}
+
+/*
+ * Internal helper: loop_idle
+ * Sleeps SOLVER_LOOP_IDLE_MS unless stopped. Returns non-zero once stop is set.
+ */
+static int loop_idle(SolverLoop* loop)
+{
+    struct timespec until;
+    clock_gettime(CLOCK_REALTIME, &until);
+    until.tv_nsec += SOLVER_LOOP_IDLE_MS * 1000000L;
+    if (until.tv_nsec >= 1000000000L) {
+        until.tv_sec  += 1;
+        until.tv_nsec -= 1000000000L;
+    }
+    pthread_mutex_lock(&loop->lock);
+    if (!loop->stop) {
+        pthread_cond_timedwait(&loop->wake, &loop->lock, &until);
+    }
+    int stop = loop->stop;
+    pthread_mutex_unlock(&loop->lock);
+    return stop;
+}
+
+/*
+ * Internal helper: loop_thread_main
+ * Runs iterations until stop is set. Each one takes ctx->run_lock, so pub_run_all_solvers
+ * and batch callers interleave with the loop rather than run concurrently with it.
+ */
+static void* loop_thread_main(void* arg)
+{
+    SolverLoop* loop = (SolverLoop*)arg;
+    struct AntNetContext* ctx = loop->ctx;
+    uint64_t next_progress = 0;
+
+    for (;;) {
+        pthread_mutex_lock(&loop->lock);
+        int stop = loop->stop;
+        pthread_mutex_unlock(&loop->lock);
+        if (stop) {
+            break;
+        }
+
+        /* The region is refreshed on the iterations that signal, so it is current at wake-up. */
+        int progress_ms = LOOP_LOAD(&loop->progress_ms);
+        int tick = progress_ms > 0 && antnet_perf_now_ns() >= next_progress;
+        int improved = 0;
+        int rc = priv_run_solvers_step(ctx, loop->scratch, loop->capacity, tick, &improved);
+        if (rc != ERR_SUCCESS) {
+            if (loop_idle(loop)) {
+                break;
+            }
+            continue;
+        }
+
+        LOOP_ADD(&loop->iterations, 1);
+        if (improved) {
+            LOOP_ADD(&loop->improvements, 1);
+        }
+        if (improved || tick) {
+            loop_signal(loop);
+            next_progress = antnet_perf_now_ns() + (uint64_t)progress_ms * 1000000ULL;
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Internal helper: loop_join
+ * Stops and joins the thread if it runs. Caller holds control.
+ */
+static void loop_join(SolverLoop* loop)
+{
+    if (!LOOP_LOAD(&loop->running)) {
+        return;
+    }
+    pthread_mutex_lock(&loop->lock);
+    loop->stop = 1;
+    pthread_cond_broadcast(&loop->wake);
+    pthread_mutex_unlock(&loop->lock);
+    pthread_join(loop->thread, NULL);
+    LOOP_STORE(&loop->running, 0);
+    ANTNET_LOGI(loop->context_id, "[solver_loop] stopped after %llu iterations",
+                (unsigned long long)LOOP_LOAD(&loop->iterations));
+}
+
+/*
+ * Internal helper: loop_launch
+ * Opens the descriptor and scratch rows on first use and starts the thread.
+ * Caller holds control; the loop is neither closed nor running.
+ */
+static int loop_launch(SolverLoop* loop, struct AntNetContext* ctx)
+{
+    if (loop->fd_read < 0) {
+        int rc = loop_open_fd(loop);
+        if (rc != ERR_SUCCESS) {
+            return rc;
+        }
+    }
+    if (!loop->scratch) {
+        /* max_hops is fixed per context, and max_hops + 2 bounds every path. */
+        int capacity = (ctx->max_hops > 0) ? ctx->max_hops + 2 : 2;
+        loop->scratch = (int*)malloc((size_t)capacity * 3 * sizeof(int));
+        if (!loop->scratch) {
+            return ERR_MEMORY_ALLOCATION;
+        }
+        loop->capacity = capacity;
+    }
+
+    loop->ctx        = ctx;
+    loop->context_id = priv_get_context_id(ctx);
+    loop->stop       = 0;
+    if (pthread_create(&loop->thread, NULL, loop_thread_main, loop) != 0) {
+        return ERR_INTERNAL_FAILURE;
+    }
+    LOOP_STORE(&loop->running, 1);
+    ANTNET_LOGI(loop->context_id, "[solver_loop] started, progress every %d ms",
+                LOOP_LOAD(&loop->progress_ms));
+    return ERR_SUCCESS;
+}
+#endif
+
+int solver_loop_start(SolverLoop* loop, struct AntNetContext* ctx, int progress_interval_ms,
+                      int* out_fd)
+{
+    if (!loop || !ctx || !out_fd || progress_interval_ms < 0) {
+        return ERR_INVALID_ARGS;
+    }
+#ifdef _WIN32
+    return ERR_UNIMPLEMENTED;
+#else
+    int rc = ERR_INVALID_CONTEXT;
+    pthread_mutex_lock(&loop->control);
+    if (!loop->closed) {
+        LOOP_STORE(&loop->progress_ms, progress_interval_ms);
+        rc = LOOP_LOAD(&loop->running) ? ERR_SUCCESS : loop_launch(loop, ctx);
+    }
+    if (rc == ERR_SUCCESS) {
+        *out_fd = loop->fd_read;
+    }
+    pthread_mutex_unlock(&loop->control);
+    return rc;
+#endif
+}
+
+int solver_loop_stop(SolverLoop* loop)
+{
+    if (!loop) {
+        return ERR_INVALID_ARGS;
+    }
+#ifndef _WIN32
+    pthread_mutex_lock(&loop->control);
+    loop_join(loop);
+    pthread_mutex_unlock(&loop->control);
+#endif
+    return ERR_SUCCESS;
+}
+
+void solver_loop_close(SolverLoop* loop)
+{
+    if (!loop) {
+        return;
+    }
+#ifndef _WIN32
+    pthread_mutex_lock(&loop->control);
+    loop_join(loop);
+    loop->closed = 1;
+    if (loop->fd_write >= 0 && loop->fd_write != loop->fd_read) {
+        close(loop->fd_write);
+    }
+    if (loop->fd_read >= 0) {
+        close(loop->fd_read);
+    }
+    loop->fd_read  = -1;
+    loop->fd_write = -1;
+    free(loop->scratch);
+    loop->scratch  = NULL;
+    loop->capacity = 0;
+    pthread_mutex_unlock(&loop->control);
+#endif
+}
+
+void solver_loop_destroy(SolverLoop* loop)
+{
+    if (!loop) {
+        return;
+    }
+    solver_loop_close(loop);
+#ifndef _WIN32
+    pthread_cond_destroy(&loop->wake);
+    pthread_mutex_destroy(&loop->lock);
+    pthread_mutex_destroy(&loop->control);
+#endif
+    free(loop);
+}
+
+void solver_loop_status(const SolverLoop* loop, int* out_running, uint64_t* out_iterations,
+                        uint64_t* out_improvements)
+{
+    if (out_running) {
+        *out_running = loop ? LOOP_LOAD(&loop->running) : 0;
+    }
+    if (out_iterations) {
+        *out_iterations = loop ? LOOP_LOAD(&loop->iterations) : 0;
+    }
+    if (out_improvements) {
+        *out_improvements = loop ? LOOP_LOAD(&loop->improvements) : 0;
+    }
+}
+
+/*
+ * pub_solver_loop_start
+ * Starts the context's solver loop, or updates its progress interval.
+ */
+int pub_solver_loop_start(int context_id, int progress_interval_ms, int* out_fd)
+{
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx) {
+        return ERR_INVALID_CONTEXT;
+    }
+    if (!ctx->solver_loop) {
+        return ERR_MEMORY_ALLOCATION;
+    }
+    return solver_loop_start(ctx->solver_loop, ctx, progress_interval_ms, out_fd);
+}
+
+/*
+ * pub_solver_loop_stop
+ * Stops the context's solver loop; the descriptor stays open.
+ */
+int pub_solver_loop_stop(int context_id)
+{
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx) {
+        return ERR_INVALID_CONTEXT;
+    }
+    return ctx->solver_loop ? solver_loop_stop(ctx->solver_loop) : ERR_SUCCESS;
+}
+
+/*
+ * pub_solver_loop_status
+ * Running flag and counters of the context's solver loop.
+ */
+int pub_solver_loop_status(int context_id, int* out_running, uint64_t* out_iterations,
+                           uint64_t* out_improvements)
+{
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx) {
+        return ERR_INVALID_CONTEXT;
+    }
+    solver_loop_status(ctx->solver_loop, out_running, out_iterations, out_improvements);
+    return ERR_SUCCESS;
+}
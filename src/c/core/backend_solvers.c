@@ -1,6 +1,6 @@
 /* Relative Path: src/c/core/backend_solvers.c */
 /*
- * Orchestrates solver operations (ACO, Random, Brute-Force) and retrieves best paths.
+ * Orchestrates solver operations (ACO, Random, Brute-Force, Exact) and retrieves best paths.
  * Manages thread-safe iteration counters and aggregator logic for solver outputs.
  * Key file for coordinating multi-solver pathfinding in AntNet.
 */
@@ -9,10 +9,15 @@
 #include "../../../include/managers/cpu_acoV1_algo_manager.h"
 #include "../../../include/managers/cpu_random_algo_manager.h"
 #include "../../../include/managers/cpu_brute_force_algo_manager.h"
+#include "../../../include/managers/cpu_exact_algo_manager.h"
 #include "../../../include/managers/ranking_manager.h"
 #include "../../../include/consts/error_codes.h"
+#include "../../../include/core/backend_worker_pool.h"
+#include "../../../include/core/backend_log.h"
+#include "../../../include/core/backend_perf.h"
 #include <limits.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 /*
@@ -27,7 +32,7 @@ int pub_run_iteration(int context_id)
         return ERR_INVALID_CONTEXT;
     }
 #ifndef _WIN32
-    pthread_mutex_lock(&ctx->lock);
+    antnet_perf_lock_context(ctx);
 #endif
     ctx->iteration++;
 #ifndef _WIN32
@@ -39,7 +44,7 @@ int pub_run_iteration(int context_id)
 /*
  * pub_get_best_path
  * Retrieves the current best path from the random solver, or returns a mock path
- * if none is available. Thread-safe. Retrieval from ACO and Brute-Force solvers
+ * if none is available. Thread-safe; waits for a running random solver. Retrieval from ACO and Brute-Force solvers
  * can be implemented separately or parameterized in the future.
  */
 int pub_get_best_path(
@@ -61,7 +66,8 @@ int pub_get_best_path(
     }
 
 #ifndef _WIN32
-    pthread_mutex_lock(&ctx->lock);
+    pthread_mutex_lock(&ctx->random_lock);
+    antnet_perf_lock_context(ctx);
 #endif
     if (ctx->random_best_length > 0)
     {
@@ -69,6 +75,7 @@ int pub_get_best_path(
         {
 #ifndef _WIN32
             pthread_mutex_unlock(&ctx->lock);
+            pthread_mutex_unlock(&ctx->random_lock);
 #endif
             return ERR_ARRAY_TOO_SMALL;
         }
@@ -86,6 +93,7 @@ int pub_get_best_path(
         {
 #ifndef _WIN32
             pthread_mutex_unlock(&ctx->lock);
+            pthread_mutex_unlock(&ctx->random_lock);
 #endif
             return ERR_ARRAY_TOO_SMALL;
         }
@@ -95,25 +103,305 @@ int pub_get_best_path(
     }
 #ifndef _WIN32
     pthread_mutex_unlock(&ctx->lock);
+    pthread_mutex_unlock(&ctx->random_lock);
 #endif
     return ERR_SUCCESS;
 }
 
+/*
+ * Internal helper: solvers_record_improvement
+ * Applies an improvement of solver 'improved' (0 ACO, 1 Random, 2 Brute, 3 Exact) to its
+ * SASA state, refreshes the scores of the others and logs the new order.
+ * Exact only takes part while enabled. Caller holds ctx->lock.
+ */
+static void solvers_record_improvement(AntNetContext* ctx, int improved, double latency,
+                                       const char* label)
+{
+    SasaState* all[4] = {&ctx->aco_sasa, &ctx->random_sasa, &ctx->brute_sasa, &ctx->exact_sasa};
+    int count = ctx->exact_state.enabled ? 4 : 3;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (i == improved)
+        {
+            priv_update_on_improvement(ctx->iteration, latency, all[i],
+                                       ctx->sasa_coeffs.alpha,
+                                       ctx->sasa_coeffs.beta,
+                                       ctx->sasa_coeffs.gamma);
+        }
+        else
+        {
+            priv_recalc_sasa_score(all[i], ctx->iteration,
+                                   ctx->sasa_coeffs.alpha,
+                                   ctx->sasa_coeffs.beta,
+                                   ctx->sasa_coeffs.gamma);
+        }
+    }
+
+    SasaState states[4];
+    int rank_order[4];
+    for (int i = 0; i < count; i++)
+    {
+        states[i] = *all[i];
+    }
+    priv_compute_ranking(states, count, rank_order);
+    ANTNET_LOGI(priv_get_context_id(ctx),
+                "[RANK] %s improved => order: #%d first, #%d second, #%d third",
+                label, rank_order[0], rank_order[1], rank_order[2]);
+}
+
+/* Solvers dispatched by pub_run_all_solvers, in SASA order. */
+#define SOLVER_ACO    0
+#define SOLVER_RANDOM 1
+#define SOLVER_BRUTE  2
+#define SOLVER_EXACT  3
+#define SOLVER_COUNT  4
+
+/*
+ * SolverBatch
+ * Shared by the solver tasks of one pub_run_all_solvers call. Each task writes only
+ * its own slot; the caller reads them after the join.
+ */
+typedef struct
+{
+    AntNetContext* ctx;
+    int* out_nodes[SOLVER_COUNT];
+    int  max_size[SOLVER_COUNT];
+    int* out_len[SOLVER_COUNT];
+    int* out_latency[SOLVER_COUNT];
+    int  exact_len;
+    int  exact_latency;
+    int  rc[SOLVER_COUNT];
+    int  old_latency[SOLVER_COUNT]; /* best before the step, INT_MAX if none */
+    int  new_latency[SOLVER_COUNT]; /* best after the step, INT_MAX if none */
+} SolverBatch;
+
+/*
+ * Internal helper: solvers_best_latency
+ * Best latency of solver 'which', INT_MAX while it has no path. Caller holds its lock.
+ */
+static int solvers_best_latency(const AntNetContext* ctx, int which)
+{
+    switch (which)
+    {
+        case SOLVER_ACO:
+            return (ctx->aco_best_length > 0) ? ctx->aco_best_latency : INT_MAX;
+        case SOLVER_RANDOM:
+            return (ctx->random_best_length > 0) ? ctx->random_best_latency : INT_MAX;
+        case SOLVER_BRUTE:
+            return (ctx->brute_best_length > 0) ? ctx->brute_best_latency : INT_MAX;
+        default:
+            return (ctx->exact_best_length > 0) ? ctx->exact_best_latency : INT_MAX;
+    }
+}
+
+/*
+ * Internal helper: solvers_run_task
+ * Worker pool task running solver 'task_index' under its own lock. Solvers only share
+ * the topology, which changes under all solver locks, so they never wait on each other.
+ */
+static void solvers_run_task(void* arg, int task_index)
+{
+    SolverBatch* batch = (SolverBatch*)arg;
+    AntNetContext* ctx = batch->ctx;
+    int rc = ERR_SUCCESS;
+
+#ifndef _WIN32
+    pthread_mutex_t* locks[SOLVER_COUNT] = {&ctx->aco_lock, &ctx->random_lock,
+                                            &ctx->brute_lock, &ctx->exact_lock};
+    pthread_mutex_lock(locks[task_index]);
+#endif
+    batch->old_latency[task_index] = solvers_best_latency(ctx, task_index);
+
+    switch (task_index)
+    {
+        case SOLVER_ACO:
+            /* ACO takes ctx->lock itself, briefly, to merge deltas and publish snapshots. */
+            rc = aco_algo_manager_run_iteration(ctx);
+            if (rc == ERR_SUCCESS || rc == ERR_NO_TOPOLOGY)
+            {
+                rc = aco_algo_manager_search_path(ctx, 0, 1,
+                                                  batch->out_nodes[task_index],
+                                                  batch->max_size[task_index],
+                                                  batch->out_len[task_index],
+                                                  batch->out_latency[task_index]);
+            }
+            break;
+        case SOLVER_RANDOM:
+            rc = random_algo_manager_run(ctx, 0, 1,
+                                         batch->out_nodes[task_index],
+                                         batch->max_size[task_index],
+                                         batch->out_len[task_index],
+                                         batch->out_latency[task_index]);
+            break;
+        case SOLVER_BRUTE:
+            rc = brute_force_algo_manager_run(ctx, 0, 1,
+                                              batch->out_nodes[task_index],
+                                              batch->max_size[task_index],
+                                              batch->out_len[task_index],
+                                              batch->out_latency[task_index]);
+            break;
+        default:
+            /* Solves only after a topology change; most calls return the cached optimum. */
+            if (ctx->path_capacity == 0)
+            {
+                rc = ERR_NO_TOPOLOGY;
+                break;
+            }
+            int* exact_nodes = (int*)malloc((size_t)ctx->path_capacity * sizeof(int));
+            if (!exact_nodes)
+            {
+                rc = ERR_MEMORY_ALLOCATION;
+                break;
+            }
+            rc = exact_algo_manager_run(ctx, 0, 1, exact_nodes, ctx->path_capacity,
+                                        &batch->exact_len, &batch->exact_latency);
+            free(exact_nodes);
+            break;
+    }
+
+    batch->new_latency[task_index] = solvers_best_latency(ctx, task_index);
+#ifndef _WIN32
+    pthread_mutex_unlock(locks[task_index]);
+#endif
+    batch->rc[task_index] = rc;
+}
+
+/*
+ * Internal helper: solvers_run_iteration
+ * One pub_run_all_solvers iteration on a prepared batch: runs the solvers side by side,
+ * then applies their SASA updates. On return batch->new_latency holds each best latency.
+ * The caller holds ctx->run_lock.
+ */
+static int solvers_run_iteration(AntNetContext* ctx, SolverBatch* batch)
+{
+    uint64_t iteration_start = antnet_perf_now_ns();
+
+    /* Step 1: briefly lock to increment the iteration and see whether exact takes part. */
+#ifndef _WIN32
+    antnet_perf_lock_context(ctx);
+#endif
+    ctx->iteration++;
+    int solver_count = ctx->exact_state.enabled ? SOLVER_COUNT : SOLVER_EXACT;
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+#endif
+
+    *batch->out_len[SOLVER_ACO]     = 0;
+    *batch->out_latency[SOLVER_ACO] = 0;
+    memset(batch->rc, 0, sizeof(batch->rc));
+
+    /*
+     * Step 2: run the solvers side by side. The shared worker pool is fetched first so a
+     * pending resize happens now, not while ACO and Brute both submit batches to it.
+     */
+    priv_get_worker_pool(ctx);
+    WorkerPool* pool = priv_get_solver_pool(ctx);
+    if (pool)
+    {
+        worker_pool_run(pool, solver_count, solvers_run_task, batch);
+    }
+    else
+    {
+        for (int i = 0; i < solver_count; i++)
+        {
+            solvers_run_task(batch, i);
+        }
+    }
+
+    /* Step 3: one SASA update per improved solver, in solver order. */
+    static const char* labels[SOLVER_COUNT] = {"ACO", "Random", "Brute", "Exact"};
+    int rc = ERR_SUCCESS;
+#ifndef _WIN32
+    antnet_perf_lock_context(ctx);
+#endif
+    uint64_t sasa_start = antnet_perf_now_ns();
+    for (int i = 0; i < solver_count; i++)
+    {
+        if (batch->rc[i] != ERR_SUCCESS && batch->rc[i] != ERR_NO_PATH_FOUND)
+        {
+            rc = batch->rc[i];
+            break;
+        }
+        if (batch->new_latency[i] < batch->old_latency[i])
+        {
+            solvers_record_improvement(ctx, i, (double)batch->new_latency[i], labels[i]);
+        }
+    }
+    antnet_perf_record(ctx, ANTNET_PERF_SASA_UPDATE, sasa_start);
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+#endif
+    antnet_perf_record(ctx, ANTNET_PERF_ITERATION, iteration_start);
+    return rc;
+}
+
+/*
+ * Internal helper: solvers_prepare_batch
+ * Points the ACO, Random and Brute slots of batch at the caller's output buffers.
+ */
+static void solvers_prepare_batch(SolverBatch* batch, AntNetContext* ctx,
+                                  int* out_nodes_aco, int max_size_aco,
+                                  int* out_len_aco, int* out_latency_aco,
+                                  int* out_nodes_random, int max_size_random,
+                                  int* out_len_random, int* out_latency_random,
+                                  int* out_nodes_brute, int max_size_brute,
+                                  int* out_len_brute, int* out_latency_brute)
+{
+    memset(batch, 0, sizeof(*batch));
+    batch->ctx = ctx;
+    batch->out_nodes[SOLVER_ACO]      = out_nodes_aco;
+    batch->max_size[SOLVER_ACO]       = max_size_aco;
+    batch->out_len[SOLVER_ACO]        = out_len_aco;
+    batch->out_latency[SOLVER_ACO]    = out_latency_aco;
+    batch->out_nodes[SOLVER_RANDOM]   = out_nodes_random;
+    batch->max_size[SOLVER_RANDOM]    = max_size_random;
+    batch->out_len[SOLVER_RANDOM]     = out_len_random;
+    batch->out_latency[SOLVER_RANDOM] = out_latency_random;
+    batch->out_nodes[SOLVER_BRUTE]    = out_nodes_brute;
+    batch->max_size[SOLVER_BRUTE]     = max_size_brute;
+    batch->out_len[SOLVER_BRUTE]      = out_len_brute;
+    batch->out_latency[SOLVER_BRUTE]  = out_latency_brute;
+}
+
+/*
+ * Internal helper: solvers_publish_results
+ * Refreshes the results region once a reader has asked for it. The caller holds
+ * ctx->run_lock; solver locks keep pub_get_exact_path and checkpoint restores out.
+ */
+static void solvers_publish_results(AntNetContext* ctx)
+{
+    if (!results_store_active(ctx->results))
+    {
+        return;
+    }
+    priv_lock_solvers(ctx);
+#ifndef _WIN32
+    antnet_perf_lock_context(ctx);
+#endif
+    ResultsPath paths[ANTNET_RESULTS_PATHS] = {
+        {ctx->aco_best_nodes,    ctx->aco_best_length,    ctx->aco_best_latency},
+        {ctx->random_best_nodes, ctx->random_best_length, ctx->random_best_latency},
+        {ctx->brute_best_nodes,  ctx->brute_best_length,  ctx->brute_best_latency},
+        {ctx->exact_best_nodes,  ctx->exact_best_length,  ctx->exact_best_latency},
+    };
+    results_store_publish(ctx->results, &ctx->aco_v1, ctx->path_capacity, paths,
+                          (uint64_t)ctx->iteration);
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+#endif
+    priv_unlock_solvers(ctx);
+}
+
 /*
  * pub_run_all_solvers
- * Executes the ACO, Random, and Brute-Force solvers in sequence.
- * Each solver may improve its internal best path. SASA states are updated accordingly,
- * and best paths from each algorithm are returned via the output arrays.
- *
- * OLD APPROACH:
- *     1) Held ctx->lock from start to end,
- *     2) Then called aco_v1_run_iteration_threaded, which tries locking again => deadlock.
- *
- * NEW APPROACH:
- *     1) Lock *briefly* to increment ctx->iteration,
- *     2) Unlock,
- *     3) Call each solver (they do internal locking),
- *     4) Re-lock only if needed for local tasks.
+ * Runs the ACO, Random and Brute-Force solvers concurrently on the solver pool, plus the
+ * exact solver when enabled (its path is read with pub_get_exact_path), and joins them.
+ * Each solver holds only its own lock while it runs, so an iteration takes about as long
+ * as the slowest solver. SASA states are then updated in the fixed order ACO, Random,
+ * Brute, Exact, which keeps the ranking independent of the finishing order.
+ * Best paths from each algorithm are returned via the output arrays.
+ * Concurrent calls on one context are serialized by ctx->run_lock.
  */
 int pub_run_all_solvers(
     int  context_id,
@@ -144,193 +432,159 @@ int pub_run_all_solvers(
         return ERR_INVALID_CONTEXT;
     }
 
-    /* Step 1: briefly lock just to increment iteration safely. */
+    SolverBatch batch;
+    solvers_prepare_batch(&batch, ctx,
+                          out_nodes_aco, max_size_aco, out_len_aco, out_latency_aco,
+                          out_nodes_random, max_size_random, out_len_random, out_latency_random,
+                          out_nodes_brute, max_size_brute, out_len_brute, out_latency_brute);
 #ifndef _WIN32
-    pthread_mutex_lock(&ctx->lock);
+    pthread_mutex_lock(&ctx->run_lock);
 #endif
-    ctx->iteration++;
+    int rc = solvers_run_iteration(ctx, &batch);
+    solvers_publish_results(ctx);
 #ifndef _WIN32
-    pthread_mutex_unlock(&ctx->lock);
+    pthread_mutex_unlock(&ctx->run_lock);
 #endif
+    return rc;
+}
 
-    /* Initialize outputs for ACO. */
-    *out_len_aco     = 0;
-    *out_latency_aco = 0;
-
-    /*
-     * 2) ACO solver
-     *    We do *not* hold ctx->lock here, to avoid nested lock in aco_shared_merge_deltas.
-     */
-    {
-        int old_aco_latency = (ctx->aco_best_length > 0) ? ctx->aco_best_latency : INT_MAX;
-        int rc = aco_algo_manager_run_iteration(ctx);
-        if (rc != ERR_SUCCESS && rc != ERR_NO_TOPOLOGY)
-        {
-            return rc;
-        }
-        rc = aco_algo_manager_search_path(ctx, 0, 1,
-                                          out_nodes_aco, max_size_aco,
-                                          out_len_aco, out_latency_aco);
-        if (rc != ERR_SUCCESS && rc != ERR_NO_PATH_FOUND)
-        {
-            return rc;
-        }
-
-        /*
-         * For SASA updating, we do need ctx->lock, but let's lock *only* here
-         * for the check & update. 
-         */
+/*
+ * priv_run_solvers_step
+ * See backend_solvers.h. The loop thread keeps no output of its own: readers use the
+ * results region. Publishing exports and scans the whole matrix under every lock, so it
+ * follows the loop's wake-ups rather than every iteration.
+ */
+int priv_run_solvers_step(AntNetContext* ctx, int* scratch, int capacity, int publish,
+                          int* out_improved)
+{
+    int lengths[ANTNET_BATCH_TRACE_WIDTH];
+    int latencies[ANTNET_BATCH_TRACE_WIDTH];
+    SolverBatch batch;
+    solvers_prepare_batch(&batch, ctx,
+                          scratch, capacity, &lengths[0], &latencies[0],
+                          scratch + capacity, capacity, &lengths[1], &latencies[1],
+                          scratch + 2 * capacity, capacity, &lengths[2], &latencies[2]);
 #ifndef _WIN32
-        pthread_mutex_lock(&ctx->lock);
+    pthread_mutex_lock(&ctx->run_lock);
 #endif
-        if (ctx->aco_best_length > 0 && ctx->aco_best_latency < old_aco_latency)
-        {
-            priv_update_on_improvement(
-                ctx->iteration,
-                (double)ctx->aco_best_latency,
-                &ctx->aco_sasa,
-                ctx->sasa_coeffs.alpha,
-                ctx->sasa_coeffs.beta,
-                ctx->sasa_coeffs.gamma
-            );
-
-            priv_recalc_sasa_score(&ctx->random_sasa, ctx->iteration,
-                                   ctx->sasa_coeffs.alpha,
-                                   ctx->sasa_coeffs.beta,
-                                   ctx->sasa_coeffs.gamma);
-            priv_recalc_sasa_score(&ctx->brute_sasa, ctx->iteration,
-                                   ctx->sasa_coeffs.alpha,
-                                   ctx->sasa_coeffs.beta,
-                                   ctx->sasa_coeffs.gamma);
-
-            SasaState states[3] = {ctx->aco_sasa, ctx->random_sasa, ctx->brute_sasa};
-            int rank_order[3];
-            priv_compute_ranking(states, 3, rank_order);
-            printf("[RANK] ACO improved => order: #%d first, #%d second, #%d third\n",
-                   rank_order[0], rank_order[1], rank_order[2]);
-        }
+    int rc = solvers_run_iteration(ctx, &batch);
+    int improved = 0;
+    for (int i = 0; i < SOLVER_COUNT; i++)
+    {
+        improved |= batch.new_latency[i] < batch.old_latency[i];
+    }
+    if (publish || improved || !results_store_has_region(ctx->results))
+    {
+        solvers_publish_results(ctx);
+    }
 #ifndef _WIN32
-        pthread_mutex_unlock(&ctx->lock);
+    pthread_mutex_unlock(&ctx->run_lock);
 #endif
+    *out_improved = improved;
+    return rc;
+}
+
+/*
+ * pub_run_solvers_batch
+ * Runs pub_run_all_solvers iterations back to back under one run_lock, until
+ * max_iterations, the time budget or stall_iterations iterations without a better ACO,
+ * Random or Brute path. Topology and parameter calls still interleave between iterations.
+ */
+int pub_run_solvers_batch(
+    int  context_id,
+    int  max_iterations,
+    int  time_budget_us,
+    int  stall_iterations,
+    int* out_nodes_aco,
+    int  max_size_aco,
+    int* out_len_aco,
+    int* out_latency_aco,
+    int* out_nodes_random,
+    int  max_size_random,
+    int* out_len_random,
+    int* out_latency_random,
+    int* out_nodes_brute,
+    int  max_size_brute,
+    int* out_len_brute,
+    int* out_latency_brute,
+    int* out_trace,
+    int  trace_rows,
+    int* out_iterations,
+    int* out_stop_reason
+)
+{
+    if (max_iterations <= 0 || time_budget_us < 0 || stall_iterations < 0 || trace_rows < 0 ||
+        (trace_rows > 0 && !out_trace) || !out_iterations ||
+        !out_nodes_aco || !out_len_aco || !out_latency_aco ||
+        !out_nodes_random || !out_len_random || !out_latency_random ||
+        !out_nodes_brute || !out_len_brute || !out_latency_brute)
+    {
+        return ERR_INVALID_ARGS;
     }
 
-    /*
-     * 3) RANDOM solver (similar approach, do not hold ctx->lock across entire run)
-     */
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx)
     {
-        int old_random_latency;
-#ifndef _WIN32
-        pthread_mutex_lock(&ctx->lock);
-#endif
-        old_random_latency = (ctx->random_best_length > 0) ? ctx->random_best_latency : INT_MAX;
-#ifndef _WIN32
-        pthread_mutex_unlock(&ctx->lock);
-#endif
+        return ERR_INVALID_CONTEXT;
+    }
 
-        int rc = random_algo_manager_run(
-            ctx, 0, 1,
-            out_nodes_random, max_size_random,
-            out_len_random, out_latency_random
-        );
-        if (rc != ERR_SUCCESS && rc != ERR_NO_PATH_FOUND)
-        {
-            return rc;
-        }
+    SolverBatch batch;
+    solvers_prepare_batch(&batch, ctx,
+                          out_nodes_aco, max_size_aco, out_len_aco, out_latency_aco,
+                          out_nodes_random, max_size_random, out_len_random, out_latency_random,
+                          out_nodes_brute, max_size_brute, out_len_brute, out_latency_brute);
 
-        /*
-         * If random improved, lock only for the SASA update portion.
-         */
-#ifndef _WIN32
-        pthread_mutex_lock(&ctx->lock);
-#endif
-        if (ctx->random_best_length > 0 && ctx->random_best_latency < old_random_latency)
-        {
-            priv_update_on_improvement(
-                ctx->iteration,
-                (double)ctx->random_best_latency,
-                &ctx->random_sasa,
-                ctx->sasa_coeffs.alpha,
-                ctx->sasa_coeffs.beta,
-                ctx->sasa_coeffs.gamma
-            );
-
-            priv_recalc_sasa_score(&ctx->aco_sasa, ctx->iteration,
-                                   ctx->sasa_coeffs.alpha,
-                                   ctx->sasa_coeffs.beta,
-                                   ctx->sasa_coeffs.gamma);
-            priv_recalc_sasa_score(&ctx->brute_sasa, ctx->iteration,
-                                   ctx->sasa_coeffs.alpha,
-                                   ctx->sasa_coeffs.beta,
-                                   ctx->sasa_coeffs.gamma);
+    uint64_t deadline = (time_budget_us > 0)
+                      ? antnet_perf_now_ns() + (uint64_t)time_budget_us * 1000ULL : 0;
+    int iterations = 0;
+    int stalled = 0;
+    int stop = ANTNET_BATCH_STOP_ITERATIONS;
+    int rc = ERR_SUCCESS;
 
-            SasaState states[3] = {ctx->aco_sasa, ctx->random_sasa, ctx->brute_sasa};
-            int rank_order[3];
-            priv_compute_ranking(states, 3, rank_order);
-            printf("[RANK] Random improved => order: #%d first, #%d second, #%d third\n",
-                   rank_order[0], rank_order[1], rank_order[2]);
-        }
 #ifndef _WIN32
-        pthread_mutex_unlock(&ctx->lock);
+    pthread_mutex_lock(&ctx->run_lock);
 #endif
-    }
-
-    /*
-     * 4) BRUTE solver (same pattern)
-     */
+    while (iterations < max_iterations)
     {
-        int old_brute_latency;
-#ifndef _WIN32
-        pthread_mutex_lock(&ctx->lock);
-#endif
-        old_brute_latency = (ctx->brute_best_length > 0) ? ctx->brute_best_latency : INT_MAX;
-#ifndef _WIN32
-        pthread_mutex_unlock(&ctx->lock);
-#endif
-
-        int rc = brute_force_algo_manager_run(
-            ctx, 0, 1,
-            out_nodes_brute, max_size_brute,
-            out_len_brute, out_latency_brute
-        );
-        if (rc != ERR_SUCCESS && rc != ERR_NO_PATH_FOUND)
+        rc = solvers_run_iteration(ctx, &batch);
+        if (rc != ERR_SUCCESS)
         {
-            return rc;
+            break;
         }
 
-#ifndef _WIN32
-        pthread_mutex_lock(&ctx->lock);
-#endif
-        if (ctx->brute_best_length > 0 && ctx->brute_best_latency < old_brute_latency)
+        int improved = 0;
+        for (int i = 0; i < ANTNET_BATCH_TRACE_WIDTH; i++)
         {
-            priv_update_on_improvement(
-                ctx->iteration,
-                (double)ctx->brute_best_latency,
-                &ctx->brute_sasa,
-                ctx->sasa_coeffs.alpha,
-                ctx->sasa_coeffs.beta,
-                ctx->sasa_coeffs.gamma
-            );
-
-            priv_recalc_sasa_score(&ctx->aco_sasa, ctx->iteration,
-                                   ctx->sasa_coeffs.alpha,
-                                   ctx->sasa_coeffs.beta,
-                                   ctx->sasa_coeffs.gamma);
-            priv_recalc_sasa_score(&ctx->random_sasa, ctx->iteration,
-                                   ctx->sasa_coeffs.alpha,
-                                   ctx->sasa_coeffs.beta,
-                                   ctx->sasa_coeffs.gamma);
+            improved |= batch.new_latency[i] < batch.old_latency[i];
+            if (iterations < trace_rows)
+            {
+                out_trace[iterations * ANTNET_BATCH_TRACE_WIDTH + i] =
+                    (batch.new_latency[i] == INT_MAX) ? -1 : batch.new_latency[i];
+            }
+        }
+        iterations++;
+        stalled = improved ? 0 : stalled + 1;
 
-            SasaState states[3] = {ctx->aco_sasa, ctx->random_sasa, ctx->brute_sasa};
-            int rank_order[3];
-            priv_compute_ranking(states, 3, rank_order);
-            printf("[RANK] Brute improved => order: #%d first, #%d second, #%d third\n",
-                   rank_order[0], rank_order[1], rank_order[2]);
+        if (stall_iterations > 0 && stalled >= stall_iterations)
+        {
+            stop = ANTNET_BATCH_STOP_CONVERGED;
+            break;
+        }
+        if (deadline && antnet_perf_now_ns() >= deadline)
+        {
+            stop = ANTNET_BATCH_STOP_DEADLINE;
+            break;
         }
+    }
+    solvers_publish_results(ctx);
 #ifndef _WIN32
-        pthread_mutex_unlock(&ctx->lock);
+    pthread_mutex_unlock(&ctx->run_lock);
 #endif
-    }
 
-    /* Done. No final context lock needed here. */
-    return ERR_SUCCESS;
+    *out_iterations = iterations;
+    if (out_stop_reason)
+    {
+        *out_stop_reason = stop;
+    }
+    return rc;
 }
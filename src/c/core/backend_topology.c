@@ -1,27 +1,30 @@
 /* Relative Path: src/c/core/backend_topology.c */
 /*
  * Updates and validates the network topology (nodes, edges) in a thread-safe manner.
- * Resets algorithm states when the topology changes, preventing stale data.
- * Central place for re-initializing internal memory for ACO or brute-force searches.
+ * A full update resets algorithm states; the incremental calls (delays, edges, disabled
+ * or added nodes) patch them in place so the ACO keeps what it learned.
 */
 
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <limits.h>
 
 #include "../../../include/rendering/heatmap_renderer_api.h"
 #include "../../../include/core/backend_topology.h"
 #include "../../../include/consts/error_codes.h"
 #include "../../../include/algo/cpu/cpu_brute_force.h"
-
-extern AntNetContext* priv_get_context_by_id(int);
+#include "../../../include/algo/cpu/cpu_ACOv1.h"
+#include "../../../include/core/backend_init.h"
+#include "../../../include/core/backend_log.h"
+#include "../../../include/core/backend_perf.h"
 
 /*
  * pub_update_topology
  * Updates the internal graph data within the context.
  * The function performs validation on the input data, replaces the nodes and edges
  * in memory, resets the brute-force state, and clears ACO-related data if needed.
- * Thread-safe through context locking.
+ * Thread-safe through context locking; waits for running solvers via the solver locks.
  */
 int pub_update_topology(
     int context_id,
@@ -32,57 +35,73 @@ int pub_update_topology(
 )
 {
     if (num_nodes < 0 || num_edges < 0 || !nodes || !edges) {
-        printf("[ERROR] pub_update_topology: Invalid arguments.\n");
+        ANTNET_LOGE(context_id, "[ERROR] pub_update_topology: Invalid arguments.");
         return ERR_INVALID_ARGS;
     }
 
     AntNetContext* ctx = priv_get_context_by_id(context_id);
     if (!ctx) {
-        printf("[ERROR] pub_update_topology: Invalid context ID.\n");
+        ANTNET_LOGE(context_id, "[ERROR] pub_update_topology: Invalid context ID.");
         return ERR_INVALID_CONTEXT;
     }
 
+    priv_lock_solvers(ctx);
 #ifndef _WIN32
-    pthread_mutex_lock(&ctx->lock);
+    antnet_perf_lock_context(ctx);
 #endif
+    uint64_t start = antnet_perf_now_ns();
 
     for (int i = 0; i < num_nodes; i++) {
         if (nodes[i].node_id < 0) {
-            printf("[ERROR] pub_update_topology: Negative node_id found: %d\n", nodes[i].node_id);
+            ANTNET_LOGE(context_id, "[ERROR] pub_update_topology: Negative node_id found: %d", nodes[i].node_id);
 #ifndef _WIN32
             pthread_mutex_unlock(&ctx->lock);
 #endif
+            priv_unlock_solvers(ctx);
             return ERR_INVALID_ARGS;
         }
 
         if (nodes[i].delay_ms < 0) {
-            printf("[ERROR] pub_update_topology: Negative latency found for node_id %d\n", nodes[i].node_id);
+            ANTNET_LOGE(context_id, "[ERROR] pub_update_topology: Negative latency found for node_id %d", nodes[i].node_id);
 #ifndef _WIN32
             pthread_mutex_unlock(&ctx->lock);
 #endif
+            priv_unlock_solvers(ctx);
             return ERR_INVALID_ARGS;
         }
     }
 
     for (int e = 0; e < num_edges; e++) {
         if (edges[e].from_id < 0 || edges[e].to_id < 0) {
-            printf("[ERROR] pub_update_topology: Negative edge IDs found.\n");
+            ANTNET_LOGE(context_id, "[ERROR] pub_update_topology: Negative edge IDs found.");
 #ifndef _WIN32
             pthread_mutex_unlock(&ctx->lock);
 #endif
+            priv_unlock_solvers(ctx);
             return ERR_INVALID_ARGS;
         }
     }
 
+    /* Solver buffers first: if they cannot grow, the old topology stays in place. */
+    if (priv_reserve_solver_buffers(ctx, num_nodes) != ERR_SUCCESS) {
+        ANTNET_LOGE(context_id, "[ERROR] pub_update_topology: Solver buffer allocation failed.");
+#ifndef _WIN32
+        pthread_mutex_unlock(&ctx->lock);
+#endif
+        priv_unlock_solvers(ctx);
+        return ERR_MEMORY_ALLOCATION;
+    }
+
     free(ctx->nodes);
     ctx->nodes = NULL;
     if (num_nodes > 0) {
         ctx->nodes = (NodeData*)malloc(sizeof(NodeData) * (size_t)num_nodes);
         if (!ctx->nodes) {
-            printf("[ERROR] pub_update_topology: Node memory allocation failed.\n");
+            ANTNET_LOGE(context_id, "[ERROR] pub_update_topology: Node memory allocation failed.");
 #ifndef _WIN32
             pthread_mutex_unlock(&ctx->lock);
 #endif
+            priv_unlock_solvers(ctx);
             return ERR_MEMORY_ALLOCATION;
         }
         memcpy(ctx->nodes, nodes, sizeof(NodeData) * (size_t)num_nodes);
@@ -94,21 +113,27 @@ int pub_update_topology(
     if (num_edges > 0) {
         ctx->edges = (EdgeData*)malloc(sizeof(EdgeData) * (size_t)num_edges);
         if (!ctx->edges) {
-            printf("[ERROR] pub_update_topology: Edge memory allocation failed.\n");
+            ANTNET_LOGE(context_id, "[ERROR] pub_update_topology: Edge memory allocation failed.");
             free(ctx->nodes);
             ctx->nodes = NULL;
 #ifndef _WIN32
             pthread_mutex_unlock(&ctx->lock);
 #endif
+            priv_unlock_solvers(ctx);
             return ERR_MEMORY_ALLOCATION;
         }
         memcpy(ctx->edges, edges, sizeof(EdgeData) * (size_t)num_edges);
-        printf("Edges updated (%d total):\n", num_edges);
+        ANTNET_LOGD(context_id, "Edges updated (%d total)", num_edges);
     }
     ctx->num_edges = num_edges;
 
-    printf("[pub_update_topology] Updated with %d nodes and %d edges.\n",
-           ctx->num_nodes, ctx->num_edges);
+    /* A new node set starts with every node enabled. */
+    free(ctx->node_disabled);
+    ctx->node_disabled = NULL;
+    ctx->topology_version++;
+
+    ANTNET_LOGI(context_id, "[pub_update_topology] Updated with %d nodes and %d edges.",
+                ctx->num_nodes, ctx->num_edges);
 
     /* Force re-init of Brute Force so it picks up new node counts */
     brute_force_reset_state(ctx);
@@ -118,20 +143,356 @@ int pub_update_topology(
      * This prevents stale pointers or size mismatches on adjacency/pheromones.
      */
     if (ctx->aco_v1.is_initialized) {
-        if (ctx->aco_v1.adjacency) {
-            free(ctx->aco_v1.adjacency);
-            ctx->aco_v1.adjacency = NULL;
+        aco_v1_free_buffers(&ctx->aco_v1);
+    }
+    pheromone_snapshots_invalidate(ctx->pheromone_snapshots);
+    antnet_perf_record(ctx, ANTNET_PERF_TOPOLOGY_UPDATE, start);
+
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+#endif
+    priv_unlock_solvers(ctx);
+
+    return ERR_SUCCESS;
+}
+
+/* What a mutation touched, for topology_apply_change. */
+#define TOPOLOGY_CHANGED_NODES 1 /* delays or the set of usable nodes */
+#define TOPOLOGY_CHANGED_EDGES 2 /* adjacency, node count included */
+
+/*
+ * Internal helper: topology_revalidate_path
+ * Keeps a stored best path only if every node still exists and is enabled and, when
+ * check_edges is set, every hop is still an edge; its latency is recomputed from the
+ * current delays. Otherwise the path is cleared so the solver finds a new one.
+ */
+static void topology_revalidate_path(const AntNetContext* ctx, int* nodes, int* length,
+                                     int* latency, int check_edges)
+{
+    const AcoV1State* aco = &ctx->aco_v1;
+    int sum = 0;
+    for (int p = 0; p < *length; p++) {
+        int id = nodes[p];
+        if (id < 0 || id >= ctx->num_nodes || !ANTNET_NODE_ENABLED(ctx, id)) {
+            *length  = 0;
+            *latency = 0;
+            return;
+        }
+        if (check_edges && p > 0) {
+            int prev = nodes[p - 1];
+            uint64_t word = aco->adjacency_bits[(size_t)prev * (size_t)aco->adjacency_words + (size_t)(id >> 6)];
+            if (!((word >> (id & 63)) & 1u)) {
+                *length  = 0;
+                *latency = 0;
+                return;
+            }
         }
-        if (ctx->aco_v1.pheromones) {
-            free(ctx->aco_v1.pheromones);
-            ctx->aco_v1.pheromones = NULL;
+        sum += ctx->nodes[id].delay_ms;
+    }
+    *latency = sum;
+}
+
+/*
+ * Internal helper: topology_apply_change
+ * Brings the solvers in line with an in-place mutation: the ACO state is patched rather
+ * than dropped, brute force restarts its enumeration when delays or candidates changed,
+ * and stored best paths are re-costed or cleared. Caller holds ctx->lock.
+ */
+static int topology_apply_change(AntNetContext* ctx, int changed)
+{
+    int rc = ERR_SUCCESS;
+    ctx->topology_version++;
+    if (changed & TOPOLOGY_CHANGED_EDGES) {
+        rc = aco_v1_sync_topology(ctx);
+    }
+    if (changed & TOPOLOGY_CHANGED_NODES) {
+        brute_force_reset_state(ctx);
+    }
+    /* The exact solver re-solves on the next run, seeing the version change. */
+
+    int walk = ctx->aco_v1.is_initialized && ctx->aco_v1.construction_mode == ACO_CONSTRUCT_EDGE_WALK;
+    topology_revalidate_path(ctx, ctx->aco_best_nodes, &ctx->aco_best_length, &ctx->aco_best_latency, walk);
+    topology_revalidate_path(ctx, ctx->random_best_nodes, &ctx->random_best_length, &ctx->random_best_latency, 0);
+    topology_revalidate_path(ctx, ctx->brute_best_nodes, &ctx->brute_best_length, &ctx->brute_best_latency, 0);
+    topology_revalidate_path(ctx, ctx->exact_best_nodes, &ctx->exact_best_length, &ctx->exact_best_latency, 0);
+
+    /* The matrix may have grown or been dropped: readers must not see the old size. */
+    if (changed & TOPOLOGY_CHANGED_EDGES) {
+        if (!ctx->aco_v1.is_initialized) {
+            pheromone_snapshots_invalidate(ctx->pheromone_snapshots);
+        } else if (pheromone_snapshots_active(ctx->pheromone_snapshots)) {
+            pheromone_snapshots_publish(ctx->pheromone_snapshots, &ctx->aco_v1);
+        }
+    }
+    return rc;
+}
+
+/*
+ * Internal helper: topology_set_node_delay
+ */
+static int topology_set_node_delay(AntNetContext* ctx, int node_id, int delay_ms)
+{
+    if (node_id < 0 || node_id >= ctx->num_nodes || delay_ms < 0) {
+        return ERR_INVALID_ARGS;
+    }
+    ctx->nodes[node_id].delay_ms = delay_ms;
+    return topology_apply_change(ctx, TOPOLOGY_CHANGED_NODES);
+}
+
+/*
+ * pub_set_node_delay
+ * Changes one node's delay without touching the learned pheromones. Edge-walk ants see
+ * the new delay at the next iteration, when choice_info is refreshed. Thread-safe.
+ */
+int pub_set_node_delay(int context_id, int node_id, int delay_ms)
+{
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx) {
+        return ERR_INVALID_CONTEXT;
+    }
+    priv_lock_solvers(ctx);
+#ifndef _WIN32
+    antnet_perf_lock_context(ctx);
+#endif
+    uint64_t start = antnet_perf_now_ns();
+    int rc = topology_set_node_delay(ctx, node_id, delay_ms);
+    antnet_perf_record(ctx, ANTNET_PERF_TOPOLOGY_UPDATE, start);
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+#endif
+    priv_unlock_solvers(ctx);
+    return rc;
+}
+
+/*
+ * Internal helper: topology_has_edge
+ * Non-zero if ctx->edges holds from-to in either direction.
+ */
+static int topology_has_edge(const AntNetContext* ctx, int from_id, int to_id)
+{
+    for (int e = 0; e < ctx->num_edges; e++) {
+        const EdgeData* edge = &ctx->edges[e];
+        if ((edge->from_id == from_id && edge->to_id == to_id) ||
+            (edge->from_id == to_id && edge->to_id == from_id)) {
+            return 1;
         }
-        ctx->aco_v1.is_initialized = 0;
+    }
+    return 0;
+}
+
+/*
+ * Internal helper: topology_add_edge
+ */
+static int topology_add_edge(AntNetContext* ctx, int from_id, int to_id)
+{
+    if (from_id < 0 || from_id >= ctx->num_nodes || to_id < 0 || to_id >= ctx->num_nodes ||
+        from_id == to_id) {
+        return ERR_INVALID_ARGS;
+    }
+    if (topology_has_edge(ctx, from_id, to_id)) {
+        return ERR_SUCCESS;
     }
 
+    EdgeData* edges = (EdgeData*)realloc(ctx->edges, sizeof(EdgeData) * ((size_t)ctx->num_edges + 1));
+    if (!edges) {
+        return ERR_MEMORY_ALLOCATION;
+    }
+    edges[ctx->num_edges].from_id = from_id;
+    edges[ctx->num_edges].to_id   = to_id;
+    ctx->edges = edges;
+    ctx->num_edges++;
+    return topology_apply_change(ctx, TOPOLOGY_CHANGED_EDGES);
+}
+
+/*
+ * pub_add_edge
+ * Adds the undirected edge from_id - to_id; the pheromones on it keep their value.
+ * Adding an existing edge is a no-op. Thread-safe.
+ */
+int pub_add_edge(int context_id, int from_id, int to_id)
+{
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx) {
+        return ERR_INVALID_CONTEXT;
+    }
+    priv_lock_solvers(ctx);
+#ifndef _WIN32
+    antnet_perf_lock_context(ctx);
+#endif
+    uint64_t start = antnet_perf_now_ns();
+    int rc = topology_add_edge(ctx, from_id, to_id);
+    antnet_perf_record(ctx, ANTNET_PERF_TOPOLOGY_UPDATE, start);
 #ifndef _WIN32
     pthread_mutex_unlock(&ctx->lock);
 #endif
+    priv_unlock_solvers(ctx);
+    return rc;
+}
 
-    return ERR_SUCCESS;
+/*
+ * Internal helper: topology_remove_edge
+ */
+static int topology_remove_edge(AntNetContext* ctx, int from_id, int to_id)
+{
+    if (from_id < 0 || to_id < 0) {
+        return ERR_INVALID_ARGS;
+    }
+
+    int kept = 0;
+    for (int e = 0; e < ctx->num_edges; e++) {
+        const EdgeData edge = ctx->edges[e];
+        if ((edge.from_id == from_id && edge.to_id == to_id) ||
+            (edge.from_id == to_id && edge.to_id == from_id)) {
+            continue;
+        }
+        ctx->edges[kept++] = edge;
+    }
+    if (kept == ctx->num_edges) {
+        return ERR_SUCCESS;
+    }
+    ctx->num_edges = kept;
+    return topology_apply_change(ctx, TOPOLOGY_CHANGED_EDGES);
+}
+
+/*
+ * pub_remove_edge
+ * Removes the undirected edge from_id - to_id, every duplicate included. Removing an
+ * absent edge is a no-op. Thread-safe.
+ */
+int pub_remove_edge(int context_id, int from_id, int to_id)
+{
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx) {
+        return ERR_INVALID_CONTEXT;
+    }
+    priv_lock_solvers(ctx);
+#ifndef _WIN32
+    antnet_perf_lock_context(ctx);
+#endif
+    uint64_t start = antnet_perf_now_ns();
+    int rc = topology_remove_edge(ctx, from_id, to_id);
+    antnet_perf_record(ctx, ANTNET_PERF_TOPOLOGY_UPDATE, start);
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+#endif
+    priv_unlock_solvers(ctx);
+    return rc;
+}
+
+/*
+ * Internal helper: topology_disable_node
+ */
+static int topology_disable_node(AntNetContext* ctx, int node_id, int disabled)
+{
+    /* Nodes 0 and 1 are the start and end of every path. */
+    if (node_id < 2 || node_id >= ctx->num_nodes) {
+        return ERR_INVALID_ARGS;
+    }
+    disabled = disabled ? 1 : 0;
+    if ((ANTNET_NODE_ENABLED(ctx, node_id) ? 0 : 1) == disabled) {
+        return ERR_SUCCESS;
+    }
+
+    if (!ctx->node_disabled) {
+        ctx->node_disabled = (unsigned char*)calloc((size_t)ctx->num_nodes, 1);
+        if (!ctx->node_disabled) {
+            return ERR_MEMORY_ALLOCATION;
+        }
+    }
+    ctx->node_disabled[node_id] = (unsigned char)disabled;
+    return topology_apply_change(ctx, TOPOLOGY_CHANGED_NODES | TOPOLOGY_CHANGED_EDGES);
+}
+
+/*
+ * pub_disable_node
+ * disabled != 0 takes node_id out of every solver: it is no longer a candidate and its
+ * edges leave the ACO adjacency, but they stay configured, so disabled == 0 brings the
+ * node back with its links. Nodes 0 and 1 cannot be disabled. Thread-safe.
+ */
+int pub_disable_node(int context_id, int node_id, int disabled)
+{
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx) {
+        return ERR_INVALID_CONTEXT;
+    }
+    priv_lock_solvers(ctx);
+#ifndef _WIN32
+    antnet_perf_lock_context(ctx);
+#endif
+    uint64_t start = antnet_perf_now_ns();
+    int rc = topology_disable_node(ctx, node_id, disabled);
+    antnet_perf_record(ctx, ANTNET_PERF_TOPOLOGY_UPDATE, start);
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+#endif
+    priv_unlock_solvers(ctx);
+    return rc;
+}
+
+/*
+ * Internal helper: topology_add_nodes
+ */
+static int topology_add_nodes(AntNetContext* ctx, const NodeData* nodes, int count)
+{
+    if (!nodes || count <= 0) {
+        return ERR_INVALID_ARGS;
+    }
+    for (int i = 0; i < count; i++) {
+        /* Solvers index nodes by id, so new ids must extend the current range. */
+        if (nodes[i].node_id != ctx->num_nodes + i || nodes[i].delay_ms < 0) {
+            ANTNET_LOGE(priv_get_context_id(ctx),
+                        "[ERROR] pub_add_nodes: node %d must have id %d and a non-negative delay.",
+                        i, ctx->num_nodes + i);
+            return ERR_INVALID_ARGS;
+        }
+    }
+
+    size_t total = (size_t)ctx->num_nodes + (size_t)count;
+    if (total > INT_MAX || priv_reserve_solver_buffers(ctx, (int)total) != ERR_SUCCESS) {
+        return ERR_MEMORY_ALLOCATION;
+    }
+    /* Resized brute force buffers start empty: the failure paths re-list the candidates. */
+    NodeData* grown = (NodeData*)realloc(ctx->nodes, sizeof(NodeData) * total);
+    if (!grown) {
+        brute_force_reset_state(ctx);
+        return ERR_MEMORY_ALLOCATION;
+    }
+    ctx->nodes = grown;
+    if (ctx->node_disabled) {
+        unsigned char* flags = (unsigned char*)realloc(ctx->node_disabled, total);
+        if (!flags) {
+            brute_force_reset_state(ctx);
+            return ERR_MEMORY_ALLOCATION;
+        }
+        memset(flags + ctx->num_nodes, 0, (size_t)count);
+        ctx->node_disabled = flags;
+    }
+    memcpy(ctx->nodes + ctx->num_nodes, nodes, sizeof(NodeData) * (size_t)count);
+    ctx->num_nodes = (int)total;
+    return topology_apply_change(ctx, TOPOLOGY_CHANGED_NODES | TOPOLOGY_CHANGED_EDGES);
+}
+
+/*
+ * pub_add_nodes
+ * Appends count nodes, with ids num_nodes .. num_nodes+count-1, without edges. The ACO
+ * matrices grow in place: learned values are kept, new cells start at 1.0. Thread-safe.
+ */
+int pub_add_nodes(int context_id, const NodeData* nodes, int count)
+{
+    AntNetContext* ctx = priv_get_context_by_id(context_id);
+    if (!ctx) {
+        return ERR_INVALID_CONTEXT;
+    }
+    priv_lock_solvers(ctx);
+#ifndef _WIN32
+    antnet_perf_lock_context(ctx);
+#endif
+    uint64_t start = antnet_perf_now_ns();
+    int rc = topology_add_nodes(ctx, nodes, count);
+    antnet_perf_record(ctx, ANTNET_PERF_TOPOLOGY_UPDATE, start);
+#ifndef _WIN32
+    pthread_mutex_unlock(&ctx->lock);
+#endif
+    priv_unlock_solvers(ctx);
+    return rc;
 }
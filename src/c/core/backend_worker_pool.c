@@ -0,0 +1,251 @@
+/* Relative Path: src/c/core/backend_worker_pool.c */
+/*
+ * Implements the persistent worker pool used by the multi-ant ACO iteration.
+ * Workers sleep on a condition variable, claim task chunks from the posted batch, and
+ * signal the submitting thread once the last chunk completes.
+*/
+
+#include "../../../include/core/backend_worker_pool.h"
+#include "../../../include/consts/error_codes.h"
+
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+/*
+ * WorkerPool
+ * Batch bookkeeping is guarded by 'lock'. next_task is the first unclaimed index,
+ * pending_tasks counts claimed-or-unclaimed tasks that have not finished yet.
+ */
+struct WorkerPool
+{
+#ifndef _WIN32
+    pthread_mutex_t lock;        /* guards every field below */
+    pthread_cond_t  work_cond;   /* signaled when a batch is posted or on shutdown */
+    pthread_cond_t  done_cond;   /* signaled when the last task of a batch completes */
+    pthread_mutex_t submit_lock; /* serializes concurrent worker_pool_run callers */
+    pthread_t*      threads;     /* nb_threads-1 spawned workers */
+#endif
+    int nb_threads;
+
+    worker_pool_task_fn fn;
+    void* arg;
+    int   task_count;
+    int   next_task;
+    int   pending_tasks;
+    int   chunk_size;
+
+    int   shutting_down;
+};
+
+int worker_pool_default_thread_count(void)
+{
+    long cores = 1;
+#if !defined(_WIN32) && defined(_SC_NPROCESSORS_ONLN)
+    cores = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    if (cores < 1) {
+        cores = 1;
+    }
+    if (cores > WORKER_POOL_MAX_THREADS) {
+        cores = WORKER_POOL_MAX_THREADS;
+    }
+    return (int)cores;
+}
+
+#ifndef _WIN32
+/*
+ * Internal helper: worker_pool_drain
+ * Claims and runs chunks of the current batch until none is left.
+ * Must be called with pool->lock held; the lock is released while tasks run.
+ */
+static void worker_pool_drain(WorkerPool* pool)
+{
+    while (pool->next_task < pool->task_count) {
+        int begin = pool->next_task;
+        int end   = begin + pool->chunk_size;
+        if (end > pool->task_count) {
+            end = pool->task_count;
+        }
+        pool->next_task = end;
+
+        worker_pool_task_fn fn = pool->fn;
+        void* arg = pool->arg;
+
+        pthread_mutex_unlock(&pool->lock);
+        for (int i = begin; i < end; i++) {
+            fn(arg, i);
+        }
+        pthread_mutex_lock(&pool->lock);
+
+        pool->pending_tasks -= end - begin;
+        if (pool->pending_tasks == 0) {
+            pthread_cond_broadcast(&pool->done_cond);
+        }
+    }
+}
+
+/*
+ * Internal function: worker_pool_thread_main
+ * Parks on work_cond until a batch has unclaimed tasks or the pool shuts down.
+ */
+static void* worker_pool_thread_main(void* arg)
+{
+    WorkerPool* pool = (WorkerPool*)arg;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (!pool->shutting_down && pool->next_task >= pool->task_count) {
+            pthread_cond_wait(&pool->work_cond, &pool->lock);
+        }
+        if (pool->shutting_down) {
+            break;
+        }
+        worker_pool_drain(pool);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+/*
+ * Internal helper: worker_pool_join_started
+ * Stops and joins the first 'started' workers. Used by destroy and by a failed create.
+ */
+static void worker_pool_join_started(WorkerPool* pool, int started)
+{
+    pthread_mutex_lock(&pool->lock);
+    pool->shutting_down = 1;
+    pthread_cond_broadcast(&pool->work_cond);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 0; i < started; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+}
+#endif /* _WIN32 */
+
+WorkerPool* worker_pool_create(int nb_threads)
+{
+    if (nb_threads <= 0) {
+        nb_threads = worker_pool_default_thread_count();
+    }
+    if (nb_threads > WORKER_POOL_MAX_THREADS) {
+        nb_threads = WORKER_POOL_MAX_THREADS;
+    }
+
+    WorkerPool* pool = (WorkerPool*)malloc(sizeof(WorkerPool));
+    if (!pool) {
+        return NULL;
+    }
+    memset(pool, 0, sizeof(WorkerPool));
+
+#ifndef _WIN32
+    pool->nb_threads = nb_threads;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_mutex_init(&pool->submit_lock, NULL);
+    pthread_cond_init(&pool->work_cond, NULL);
+    pthread_cond_init(&pool->done_cond, NULL);
+
+    int spawn = nb_threads - 1;
+    if (spawn > 0) {
+        pool->threads = (pthread_t*)malloc((size_t)spawn * sizeof(pthread_t));
+        if (!pool->threads) {
+            pthread_cond_destroy(&pool->done_cond);
+            pthread_cond_destroy(&pool->work_cond);
+            pthread_mutex_destroy(&pool->submit_lock);
+            pthread_mutex_destroy(&pool->lock);
+            free(pool);
+            return NULL;
+        }
+    }
+
+    for (int i = 0; i < spawn; i++) {
+        if (pthread_create(&pool->threads[i], NULL, worker_pool_thread_main, pool) != 0) {
+            worker_pool_join_started(pool, i);
+            free(pool->threads);
+            pthread_cond_destroy(&pool->done_cond);
+            pthread_cond_destroy(&pool->work_cond);
+            pthread_mutex_destroy(&pool->submit_lock);
+            pthread_mutex_destroy(&pool->lock);
+            free(pool);
+            return NULL;
+        }
+    }
+#else
+    /* Windows fallback: no worker threads, batches run sequentially in the caller. */
+    pool->nb_threads = 1;
+#endif
+
+    return pool;
+}
+
+void worker_pool_destroy(WorkerPool* pool)
+{
+    if (!pool) {
+        return;
+    }
+
+#ifndef _WIN32
+    worker_pool_join_started(pool, pool->nb_threads - 1);
+    free(pool->threads);
+    pthread_cond_destroy(&pool->done_cond);
+    pthread_cond_destroy(&pool->work_cond);
+    pthread_mutex_destroy(&pool->submit_lock);
+    pthread_mutex_destroy(&pool->lock);
+#endif
+
+    free(pool);
+}
+
+int worker_pool_size(const WorkerPool* pool)
+{
+    return pool ? pool->nb_threads : 0;
+}
+
+int worker_pool_run(WorkerPool* pool, int task_count, worker_pool_task_fn fn, void* arg)
+{
+    if (!pool || !fn || task_count < 0) {
+        return ERR_INVALID_ARGS;
+    }
+    if (task_count == 0) {
+        return ERR_SUCCESS;
+    }
+
+#ifndef _WIN32
+    if (pool->nb_threads > 1) {
+        pthread_mutex_lock(&pool->submit_lock);
+        pthread_mutex_lock(&pool->lock);
+
+        /* A few chunks per thread keeps the claim rate low while still balancing load. */
+        int chunk = task_count / (pool->nb_threads * 4);
+        pool->chunk_size    = (chunk < 1) ? 1 : chunk;
+        pool->fn            = fn;
+        pool->arg           = arg;
+        pool->task_count    = task_count;
+        pool->next_task     = 0;
+        pool->pending_tasks = task_count;
+        pthread_cond_broadcast(&pool->work_cond);
+
+        /* The caller works on the batch too, then waits for chunks still held by workers. */
+        worker_pool_drain(pool);
+        while (pool->pending_tasks > 0) {
+            pthread_cond_wait(&pool->done_cond, &pool->lock);
+        }
+
+        pool->fn  = NULL;
+        pool->arg = NULL;
+        pthread_mutex_unlock(&pool->lock);
+        pthread_mutex_unlock(&pool->submit_lock);
+        return ERR_SUCCESS;
+    }
+#endif
+
+    for (int i = 0; i < task_count; i++) {
+        fn(arg, i);
+    }
+    return ERR_SUCCESS;
+}
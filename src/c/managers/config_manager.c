@@ -15,6 +15,8 @@
 
 #include "../../../third_party/ini.h"      /* Unmodified inih header */
 #include "../../../include/managers/config_manager.h"
+#include "../../../include/types/antnet_aco_v1_types.h"
+#include "../../../include/types/antnet_brute_force_types.h"
 
 /*
  * Internal mutex to ensure thread safety when loading or saving config files.
@@ -34,6 +36,7 @@ void pub_config_set_defaults(AppConfig* cfg)
     cfg->set_nb_nodes  = 16;
     cfg->min_hops      = 3;
     cfg->max_hops      = 6;
+    cfg->seed          = 0;
 
     /* [node] defaults */
     cfg->default_min_delay = 3;
@@ -46,6 +49,7 @@ void pub_config_set_defaults(AppConfig* cfg)
     cfg->simulate_ddos           = true;
     cfg->show_random_performance = true;
     cfg->show_brute_performance  = false;
+    cfg->exact_solver            = false;
 
     /* [ranking] defaults */
     cfg->ranking_alpha = 0.4;
@@ -57,6 +61,111 @@ void pub_config_set_defaults(AppConfig* cfg)
     cfg->ant_beta        = 2.0f;
     cfg->ant_Q           = 500.0f;
     cfg->ant_evaporation = 0.1f;
+    cfg->ant_construction = ACO_CONSTRUCT_SUBSET;
+    cfg->ant_evaporation_mode = ACO_EVAPORATE_PATH;
+    cfg->ant_storage_mode       = ACO_STORAGE_FLOAT;
+    cfg->ant_colonies           = 1;
+    cfg->ant_migration_interval = 10;
+    cfg->ant_migration_mode     = ACO_MIGRATE_BEST_PATH;
+
+    /* [brute] defaults */
+    cfg->brute_mode            = BRUTE_MODE_PERMUTATION;
+    cfg->brute_step_candidates = 100000;
+    cfg->brute_step_time_us    = 2000;
+}
+
+/*
+ * parse_construction_value: converts "subset"/"edge_walk" (or 0/1) to an
+ * ACO_CONSTRUCT_* mode. Unrecognized strings fall back to subset.
+ */
+static int parse_construction_value(const char* str)
+{
+    if (!str) return ACO_CONSTRUCT_SUBSET;
+
+    while (*str && isspace((unsigned char)*str)) {
+        str++;
+    }
+    if (strncmp(str, "edge_walk", 9) == 0 || strcmp(str, "1") == 0) {
+        return ACO_CONSTRUCT_EDGE_WALK;
+    }
+    return ACO_CONSTRUCT_SUBSET;
+}
+
+/*
+ * parse_evaporation_mode_value: converts "path"/"global"/"lazy" (or 0/1/2) to an
+ * ACO_EVAPORATE_* mode. Unrecognized strings fall back to path.
+ */
+static int parse_evaporation_mode_value(const char* str)
+{
+    if (!str) return ACO_EVAPORATE_PATH;
+
+    while (*str && isspace((unsigned char)*str)) {
+        str++;
+    }
+    if (strncmp(str, "global", 6) == 0 || strcmp(str, "1") == 0) {
+        return ACO_EVAPORATE_GLOBAL;
+    }
+    if (strncmp(str, "lazy", 4) == 0 || strcmp(str, "2") == 0) {
+        return ACO_EVAPORATE_LAZY;
+    }
+    return ACO_EVAPORATE_PATH;
+}
+
+/*
+ * parse_storage_value: converts "float"/"fp16"/"log16" (or 0/1/2) to an
+ * ACO_STORAGE_* format. Unrecognized strings fall back to float.
+ */
+static int parse_storage_value(const char* str)
+{
+    if (!str) return ACO_STORAGE_FLOAT;
+
+    while (*str && isspace((unsigned char)*str)) {
+        str++;
+    }
+    if (strncmp(str, "fp16", 4) == 0 || strcmp(str, "1") == 0) {
+        return ACO_STORAGE_FP16;
+    }
+    if (strncmp(str, "log16", 5) == 0 || strcmp(str, "2") == 0) {
+        return ACO_STORAGE_LOG16;
+    }
+    return ACO_STORAGE_FLOAT;
+}
+
+/*
+ * parse_migration_value: converts "best_path"/"blend" (or 0/1) to an
+ * ACO_MIGRATE_* mode. Unrecognized strings fall back to best_path.
+ */
+static int parse_migration_value(const char* str)
+{
+    if (!str) return ACO_MIGRATE_BEST_PATH;
+
+    while (*str && isspace((unsigned char)*str)) {
+        str++;
+    }
+    if (strncmp(str, "blend", 5) == 0 || strcmp(str, "1") == 0) {
+        return ACO_MIGRATE_BLEND;
+    }
+    return ACO_MIGRATE_BEST_PATH;
+}
+
+/*
+ * parse_brute_mode_value: converts "permutation"/"branch_bound"/"parallel" (or 0/1/2) to a
+ * BRUTE_MODE_* value. Unrecognized strings fall back to permutation.
+ */
+static int parse_brute_mode_value(const char* str)
+{
+    if (!str) return BRUTE_MODE_PERMUTATION;
+
+    while (*str && isspace((unsigned char)*str)) {
+        str++;
+    }
+    if (strncmp(str, "branch_bound", 12) == 0 || strcmp(str, "1") == 0) {
+        return BRUTE_MODE_BRANCH_BOUND;
+    }
+    if (strncmp(str, "parallel", 8) == 0 || strcmp(str, "2") == 0) {
+        return BRUTE_MODE_PARALLEL;
+    }
+    return BRUTE_MODE_PERMUTATION;
 }
 
 /*
@@ -109,6 +218,7 @@ static int config_ini_handler(void* user, const char* section,
         else if (strcmp(name, "set_nb_nodes") == 0) { cfg->set_nb_nodes = atoi(value); }
         else if (strcmp(name, "min_hops")     == 0) { cfg->min_hops     = atoi(value); }
         else if (strcmp(name, "max_hops")     == 0) { cfg->max_hops     = atoi(value); }
+        else if (strcmp(name, "seed")         == 0) { cfg->seed         = (uint64_t)strtoull(value, NULL, 10); }
     }
     /* [node] */
     else if (strcmp(section, "node") == 0) {
@@ -123,6 +233,7 @@ static int config_ini_handler(void* user, const char* section,
         if      (strcmp(name, "simulate_ddos")          == 0) { cfg->simulate_ddos          = parse_bool_value(value); }
         else if (strcmp(name, "show_random_performance")== 0) { cfg->show_random_performance= parse_bool_value(value); }
         else if (strcmp(name, "show_brute_performance") == 0) { cfg->show_brute_performance = parse_bool_value(value); }
+        else if (strcmp(name, "exact_solver")           == 0) { cfg->exact_solver           = parse_bool_value(value); }
     }
     /* [ranking] */
     else if (strcmp(section, "ranking") == 0) {
@@ -136,6 +247,18 @@ static int config_ini_handler(void* user, const char* section,
         else if (strcmp(name, "ant_beta")     == 0) { cfg->ant_beta        = (float)atof(value); }
         else if (strcmp(name, "Q")            == 0) { cfg->ant_Q           = (float)atof(value); }
         else if (strcmp(name, "evaporation")  == 0) { cfg->ant_evaporation = (float)atof(value); }
+        else if (strcmp(name, "construction") == 0) { cfg->ant_construction = parse_construction_value(value); }
+        else if (strcmp(name, "evaporation_mode") == 0) { cfg->ant_evaporation_mode = parse_evaporation_mode_value(value); }
+        else if (strcmp(name, "storage")      == 0) { cfg->ant_storage_mode = parse_storage_value(value); }
+        else if (strcmp(name, "colonies")     == 0) { cfg->ant_colonies    = atoi(value); }
+        else if (strcmp(name, "migration_interval") == 0) { cfg->ant_migration_interval = atoi(value); }
+        else if (strcmp(name, "migration")    == 0) { cfg->ant_migration_mode = parse_migration_value(value); }
+    }
+    /* [brute] */
+    else if (strcmp(section, "brute") == 0) {
+        if      (strcmp(name, "mode")            == 0) { cfg->brute_mode            = parse_brute_mode_value(value); }
+        else if (strcmp(name, "step_candidates") == 0) { cfg->brute_step_candidates = atoi(value); }
+        else if (strcmp(name, "step_time_us")    == 0) { cfg->brute_step_time_us    = atoi(value); }
     }
 
     return 1; /* continue parsing */
@@ -202,6 +325,7 @@ bool pub_config_save(const AppConfig* cfg, const char* filepath)
     fprintf(fp, "set_nb_nodes = %d\n",    cfg->set_nb_nodes);
     fprintf(fp, "min_hops = %d\n",        cfg->min_hops);
     fprintf(fp, "max_hops = %d\n",        cfg->max_hops);
+    fprintf(fp, "seed = %llu\n",          (unsigned long long)cfg->seed);
 
     /* [node] */
     fprintf(fp, "\n[node]\n");
@@ -216,6 +340,7 @@ bool pub_config_save(const AppConfig* cfg, const char* filepath)
     fprintf(fp, "simulate_ddos = %s\n",          cfg->simulate_ddos ? "true" : "false");
     fprintf(fp, "show_random_performance = %s\n",cfg->show_random_performance ? "true" : "false");
     fprintf(fp, "show_brute_performance = %s\n", cfg->show_brute_performance  ? "true" : "false");
+    fprintf(fp, "exact_solver = %s\n",           cfg->exact_solver ? "true" : "false");
 
     /* [ranking] */
     fprintf(fp, "\n[ranking]\n");
@@ -229,6 +354,21 @@ bool pub_config_save(const AppConfig* cfg, const char* filepath)
     fprintf(fp, "ant_beta = %f\n",     cfg->ant_beta);
     fprintf(fp, "Q = %f\n",            cfg->ant_Q);
     fprintf(fp, "evaporation = %f\n",  cfg->ant_evaporation);
+    fprintf(fp, "construction = %s\n", cfg->ant_construction == ACO_CONSTRUCT_EDGE_WALK ? "edge_walk" : "subset");
+    fprintf(fp, "evaporation_mode = %s\n", cfg->ant_evaporation_mode == ACO_EVAPORATE_GLOBAL ? "global" :
+                                           cfg->ant_evaporation_mode == ACO_EVAPORATE_LAZY   ? "lazy"   : "path");
+    fprintf(fp, "storage = %s\n",      cfg->ant_storage_mode == ACO_STORAGE_FP16  ? "fp16"  :
+                                           cfg->ant_storage_mode == ACO_STORAGE_LOG16 ? "log16" : "float");
+    fprintf(fp, "colonies = %d\n",     cfg->ant_colonies);
+    fprintf(fp, "migration_interval = %d\n", cfg->ant_migration_interval);
+    fprintf(fp, "migration = %s\n",    cfg->ant_migration_mode == ACO_MIGRATE_BLEND ? "blend" : "best_path");
+
+    /* [brute] */
+    fprintf(fp, "\n[brute]\n");
+    fprintf(fp, "mode = %s\n",            cfg->brute_mode == BRUTE_MODE_BRANCH_BOUND ? "branch_bound" :
+                                           cfg->brute_mode == BRUTE_MODE_PARALLEL     ? "parallel"     : "permutation");
+    fprintf(fp, "step_candidates = %d\n", cfg->brute_step_candidates);
+    fprintf(fp, "step_time_us = %d\n",    cfg->brute_step_time_us);
 
     fclose(fp);
 
@@ -9,6 +9,7 @@
 #include "../../../include/rendering/heatmap_renderer_api.h"
 #include "../../../include/managers/cpu_brute_force_algo_manager.h"
 #include "../../../include/algo/cpu/cpu_brute_force.h"
+#include "../../../include/core/backend_perf.h"
 
 
 /* brute_force_algo_manager_init
@@ -42,7 +43,8 @@ int brute_force_algo_manager_run(
     {
         return ERR_INVALID_CONTEXT;
     }
-    return brute_force_search_step(
+    uint64_t start = antnet_perf_now_ns();
+    int rc = brute_force_search_step(
         ctx,
         start_node,
         end_node,
@@ -51,6 +53,8 @@ int brute_force_algo_manager_run(
         out_length,
         out_latency
     );
+    antnet_perf_record(ctx, ANTNET_PERF_BRUTE_STEP, start);
+    return rc;
 }
 
 /* brute_force_algo_manager_cleanup
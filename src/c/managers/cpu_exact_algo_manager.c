@@ -0,0 +1,66 @@
+/* Relative Path: src/c/managers/cpu_exact_algo_manager.c */
+/*
+ * Manages the exact minimum-latency solver within AntNet.
+ * Solves once per topology change and hands back the cached optimum otherwise.
+ * Serves as ground truth when comparing heuristic solvers.
+*/
+
+#include "../../../include/rendering/heatmap_renderer_api.h"
+#include "../../../include/managers/cpu_exact_algo_manager.h"
+#include "../../../include/algo/cpu/cpu_exact_solver.h"
+
+/* exact_algo_manager_init
+ * Initializes the exact solver (if needed).
+ */
+int exact_algo_manager_init(AntNetContext* ctx)
+{
+    if (!ctx)
+    {
+        return ERR_INVALID_CONTEXT;
+    }
+    /* Nothing to allocate: the first run solves the current topology. */
+    ctx->exact_state.solved = 0;
+    return ERR_SUCCESS;
+}
+
+/* exact_algo_manager_run
+ * Returns the exact optimum from start_node to end_node.
+ * Returns 0 (ERR_SUCCESS) or negative error code.
+ */
+int exact_algo_manager_run(
+    AntNetContext* ctx,
+    int start_node,
+    int end_node,
+    int* out_nodes,
+    int max_size,
+    int* out_length,
+    int* out_latency
+)
+{
+    if (!ctx)
+    {
+        return ERR_INVALID_CONTEXT;
+    }
+    return exact_solver_search(
+        ctx,
+        start_node,
+        end_node,
+        out_nodes,
+        max_size,
+        out_length,
+        out_latency
+    );
+}
+
+/* exact_algo_manager_cleanup
+ * Cleans up any allocated resources for the exact solver (if needed).
+ */
+int exact_algo_manager_cleanup(AntNetContext* ctx)
+{
+    if (!ctx)
+    {
+        return ERR_INVALID_CONTEXT;
+    }
+    /* No specific cleanup required at this time. */
+    return ERR_SUCCESS;
+}
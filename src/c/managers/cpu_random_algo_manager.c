@@ -8,6 +8,7 @@
 #include "../../../include/rendering/heatmap_renderer_api.h"
 #include "../../../include/managers/cpu_random_algo_manager.h"
 #include "../../../include/algo/cpu/cpu_random_algo.h"
+#include "../../../include/core/backend_perf.h"
 
 /* random_algo_manager_init
  * Initializes the random solver (if needed).
@@ -40,7 +41,8 @@ int random_algo_manager_run(
     {
         return ERR_INVALID_CONTEXT;
     }
-    return random_search_path(
+    uint64_t start = antnet_perf_now_ns();
+    int rc = random_search_path(
         ctx,
         start_node,
         end_node,
@@ -49,6 +51,8 @@ int random_algo_manager_run(
         out_length,
         out_latency
     );
+    antnet_perf_record(ctx, ANTNET_PERF_RANDOM_STEP, start);
+    return rc;
 }
 
 /* random_algo_manager_cleanup
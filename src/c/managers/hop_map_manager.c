@@ -13,12 +13,13 @@
 #include <string.h>
 #include <stdio.h>
 #include <math.h>
-#include <time.h>
 
 #include "../../../include/managers/hop_map_manager.h"
 #include "../../../include/consts/error_codes.h"
 #include "../../../include/core/backend_init.h"       /* priv_get_context_by_id */
+#include "../../../include/core/backend_rng.h"        /* AntNetRng streams */
 #include "../../../include/managers/hop_map_manager.h"/* HopMapManager, NodeData, EdgeData */
+#include "../../../include/core/backend_perf.h"       /* antnet_perf_lock_context */
 
 /*
   Minimal reference implementation of a HopMapManager in C.
@@ -56,7 +57,8 @@ HopMapManager* hop_map_manager_create() {
     mgr->default_min_delay = 10;
     mgr->default_max_delay = 50;
 
-    srand((unsigned int)time(NULL));
+    /* Clock seed until the owning context calls hop_map_manager_set_seed. */
+    antnet_rng_seed_stream(&mgr->rng, antnet_rng_time_seed(), ANTNET_RNG_STREAM_HOP_MAP);
 
     return mgr;
 }
@@ -96,15 +98,32 @@ void hop_map_manager_set_delay_range(HopMapManager *mgr, int min_delay, int max_
 #endif
 }
 
+/*
+ * Reseeds the delay generator from the context seed, under the manager lock.
+ */
+void hop_map_manager_set_seed(HopMapManager *mgr, uint64_t seed) {
+    if (!mgr) return;
+#ifndef _WIN32
+    pthread_mutex_lock(&mgr->lock);
+#endif
+
+    antnet_rng_seed_stream(&mgr->rng, seed, ANTNET_RNG_STREAM_HOP_MAP);
+
+#ifndef _WIN32
+    pthread_mutex_unlock(&mgr->lock);
+#endif
+}
+
 /*
  * Returns a random delay within the configured range.
+ * Called with mgr->lock held, which also guards mgr->rng.
  */
-static int hop_map_manager_get_random_delay(const HopMapManager *mgr) {
+static int hop_map_manager_get_random_delay(HopMapManager *mgr) {
     int range = mgr->default_max_delay - mgr->default_min_delay + 1;
     if (range < 1) {
         return mgr->default_min_delay;
     }
-    int rnd = rand() % range;
+    int rnd = antnet_rng_next_int(&mgr->rng, range);
     return mgr->default_min_delay + rnd;
 }
 
@@ -420,6 +439,63 @@ void hop_map_manager_create_default_edges(HopMapManager *mgr) {
 #endif
 }
 
+/*
+ * hop_map_manager_add_grid_edges
+ * Grid as laid out by hop_map_manager_initialize_map: hop i sits at row i / cols,
+ * column i % cols.
+ */
+void hop_map_manager_add_grid_edges(HopMapManager *mgr) {
+    if (!mgr) return;
+
+#ifndef _WIN32
+    pthread_mutex_lock(&mgr->lock);
+#endif
+
+    int hops = (int)mgr->hop_count;
+    if (!mgr->start_node || !mgr->end_node || !mgr->hop_nodes || hops == 0) {
+#ifndef _WIN32
+        pthread_mutex_unlock(&mgr->lock);
+#endif
+        return;
+    }
+
+    int row_count = (int)ceilf(sqrtf((float)hops));
+    int col_count = (int)ceilf((float)hops / (float)row_count);
+    size_t extra = 2 * (size_t)hops + 2 * (size_t)row_count;
+
+    EdgeData *grown = (EdgeData*)realloc(mgr->edges, sizeof(EdgeData) * (mgr->edge_count + extra));
+    if (!grown) {
+#ifndef _WIN32
+        pthread_mutex_unlock(&mgr->lock);
+#endif
+        return;
+    }
+    mgr->edges = grown;
+
+    int start_id = mgr->start_node->node_id;
+    int end_id   = mgr->end_node->node_id;
+    for (int i = 0; i < hops; i++) {
+        int col = i % col_count;
+        int id  = mgr->hop_nodes[i].node_id;
+        if (col + 1 < col_count && i + 1 < hops) {
+            mgr->edges[mgr->edge_count++] = (EdgeData){ id, mgr->hop_nodes[i + 1].node_id };
+        }
+        if (i + col_count < hops) {
+            mgr->edges[mgr->edge_count++] = (EdgeData){ id, mgr->hop_nodes[i + col_count].node_id };
+        }
+        if (col == 0) {
+            mgr->edges[mgr->edge_count++] = (EdgeData){ start_id, id };
+        }
+        if (col == col_count - 1 || i == hops - 1) {
+            mgr->edges[mgr->edge_count++] = (EdgeData){ id, end_id };
+        }
+    }
+
+#ifndef _WIN32
+    pthread_mutex_unlock(&mgr->lock);
+#endif
+}
+
 void hop_map_manager_export_topology(HopMapManager *mgr,
                                      NodeData *out_nodes, size_t *out_node_count,
                                      EdgeData *out_edges, size_t *out_edge_count)
@@ -490,7 +566,7 @@ int pub_hop_map_set_delay_range(int context_id, int min_d, int max_d)
         return ERR_INVALID_CONTEXT;
     }
 #ifndef _WIN32
-    pthread_mutex_lock(&ctx->lock);
+    antnet_perf_lock_context(ctx);
 #endif
     if (!ctx->hop_map_mgr) {
         /* Create if missing. This is optional logic. */
@@ -501,6 +577,7 @@ int pub_hop_map_set_delay_range(int context_id, int min_d, int max_d)
 #endif
             return ERR_MEMORY_ALLOCATION;
         }
+        hop_map_manager_set_seed(ctx->hop_map_mgr, ctx->rng_seed);
     }
     /* HopMapManager usage is also locked internally, but we hold this outer
      * lock to keep everything consistent if solver or other calls happen. */
@@ -524,7 +601,7 @@ int pub_hop_map_initialize(int context_id, int total_nodes)
     }
 
 #ifndef _WIN32
-    pthread_mutex_lock(&ctx->lock);
+    antnet_perf_lock_context(ctx);
 #endif
     if (!ctx->hop_map_mgr) {
         ctx->hop_map_mgr = hop_map_manager_create();
@@ -534,6 +611,7 @@ int pub_hop_map_initialize(int context_id, int total_nodes)
 #endif
             return ERR_MEMORY_ALLOCATION;
         }
+        hop_map_manager_set_seed(ctx->hop_map_mgr, ctx->rng_seed);
     }
 #ifndef _WIN32
     pthread_mutex_unlock(&ctx->lock);
@@ -556,7 +634,7 @@ int pub_hop_map_create_default_edges(int context_id)
     }
 
 #ifndef _WIN32
-    pthread_mutex_lock(&ctx->lock);
+    antnet_perf_lock_context(ctx);
 #endif
     if (!ctx->hop_map_mgr) {
 #ifndef _WIN32
@@ -584,7 +662,7 @@ int pub_hop_map_recalc_positions(int context_id, float scene_w, float scene_h)
     }
 
 #ifndef _WIN32
-    pthread_mutex_lock(&ctx->lock);
+    antnet_perf_lock_context(ctx);
 #endif
     if (!ctx->hop_map_mgr) {
 #ifndef _WIN32
@@ -620,7 +698,7 @@ int pub_hop_map_export_topology(int context_id,
     }
 
 #ifndef _WIN32
-    pthread_mutex_lock(&ctx->lock);
+    antnet_perf_lock_context(ctx);
 #endif
     if (!ctx->hop_map_mgr) {
         /* 0 nodes/edges if not inited */
@@ -4,7 +4,6 @@ QCCallbackToSignal bridges C/Worker callbacks to Qt signals, enabling thread-saf
 Converts direct solver notifications into Qt signals consumable by the main thread.
 """
 
-from typing import List
 from qtpy.QtCore import QObject, Signal, Slot
 
 from structs._generated.auto_structs import AntNetPathInfo, RankingEntry
@@ -18,7 +17,7 @@ class QCCallbackToSignal(QObject):
 
     signal_best_path_updated = Signal(dict)          # AntNetPathInfo (TypedDict emits as dict)
     signal_iteration_done = Signal()
-    signal_pheromone_matrix = Signal(list)           # raw list, no generic
+    signal_node_strength = Signal(object)            # numpy float32 array, one value per node
     signal_ranking_updated = Signal(list)            # raw list, for list[RankingEntry]
 
     def __init__(self):
@@ -38,9 +37,9 @@ class QCCallbackToSignal(QObject):
         """
         self.signal_iteration_done.emit()
 
-    @Slot(list)
-    def on_pheromone_matrix_callback(self, matrix: List[float]):
+    @Slot(object)
+    def on_node_strength_callback(self, strength):
         """
-        Called by backend/worker to send updated pheromone matrix.
+        Called by backend/worker to send the strongest outgoing pheromone of each node.
         """
-        self.signal_pheromone_matrix.emit(matrix)
+        self.signal_node_strength.emit(strength)
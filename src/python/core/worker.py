@@ -1,15 +1,15 @@
 # Relative Path: src/python/core/worker.py
 """
 Worker runs the C backend logic in a separate thread, wrapping solver updates in a loop.
-Loads config (from .ini or dict), periodically invokes solvers, and sends updates via callbacks.
-Ensures concurrency and synchronization between the GUI and the backend.
+Loads config (from .ini or dict), starts the native solver loop, and sends updates via callbacks
+whenever the backend signals progress. Ensures synchronization between the GUI and the backend.
 """
 
 
 import time
 from threading import Event, Lock
 from typing import cast
-from qtpy.QtCore import QObject
+from qtpy.QtCore import QObject, QSocketNotifier, Qt
 
 from core.callback_adapter import QCCallbackToSignal
 from ffi.backend_api import AntNetWrapper
@@ -28,6 +28,9 @@ class Worker(QObject):
         self._stop_event = Event()
         self._ctx_lock = Lock()
         self._topology_ready = False
+        self._results_version = 0  # last results region version sent to the GUI
+        self._loop_fd = -1
+        self._notifier = None
 
         self.callback_adapter = QCCallbackToSignal()
 
@@ -58,9 +61,49 @@ class Worker(QObject):
                 })
             self.backend = AntNetWrapper(app_config=app_config)
 
+    # Upper bound between GUI updates while solvers run without improving.
+    PROGRESS_INTERVAL_MS = 150
+
     def run(self):
         """
-        Main loop for backend processing. Waits until topology is ready.
+        Starts the native solver loop and returns to this thread's event loop, where a
+        QSocketNotifier on the loop descriptor wakes the worker only when the backend
+        has something new. Falls back to polling if the loop cannot start.
+        """
+        # The first acquire turns results publishing on; solvers idle until a topology.
+        with self._ctx_lock:
+            self._read_results()
+        try:
+            self._loop_fd = self.backend.start_solver_loop(self.PROGRESS_INTERVAL_MS)
+        except ValueError as e:
+            print(f"[WARN][Worker] native solver loop unavailable ({e}); polling instead")
+            self._run_polling()
+            return
+        self._notifier = QSocketNotifier(self._loop_fd, QSocketNotifier.Type.Read)
+        self._notifier.activated.connect(self._on_loop_event)
+        # Direct: runs on this thread as it finishes, where the notifier must be torn down.
+        self.thread().finished.connect(self._close_notifier, Qt.ConnectionType.DirectConnection)
+
+    def _close_notifier(self):
+        if self._notifier is not None:
+            self._notifier.setEnabled(False)
+            self._notifier = None
+
+    def _on_loop_event(self, *_):
+        if not AntNetWrapper.drain_solver_loop_fd(self._loop_fd):
+            return
+        if self._stop_event.is_set():
+            return
+        with self._ctx_lock:
+            results = self._read_results()
+        if results is None:
+            return
+        path_info, node_strength = results
+        self._emit_update(path_info, node_strength)
+
+    def _run_polling(self):
+        """
+        Loop for backends without the native solver loop: one iteration per tick.
         """
         while not self._stop_event.is_set():
             time.sleep(0.15)
@@ -75,22 +118,62 @@ class Worker(QObject):
                 continue
 
             with self._ctx_lock:
-                try:
-                    pheromones = self.backend.get_pheromone_matrix()
-                except ValueError:
-                    pheromones = []
-
-            self.callback_adapter.on_best_path_callback(result_dict)
-            self.callback_adapter.on_iteration_callback()
-            self.callback_adapter.on_pheromone_matrix_callback(pheromones)
-            try:
-                ranking = self.backend.get_algo_ranking()
-                self.callback_adapter.signal_ranking_updated.emit(ranking)
-            except Exception as e:
-                print(f"[ERROR][Worker] Failed to emit ranking: {e}")
+                results = self._read_results()
+            self._emit_update(result_dict, results[1] if results else None)
+
+    def _emit_update(self, path_info, node_strength):
+        # Backend log lines are buffered in C; printing them here keeps stdout off the solvers.
+        for entry in AntNetWrapper.drain_logs():
+            print(entry["message"])
+
+        self.callback_adapter.on_best_path_callback(path_info)
+        self.callback_adapter.on_iteration_callback()
+        if node_strength is not None:
+            self.callback_adapter.on_node_strength_callback(node_strength)
+        try:
+            ranking = self.backend.get_algo_ranking()
+            self.callback_adapter.signal_ranking_updated.emit(ranking)
+        except Exception as e:
+            print(f"[ERROR][Worker] Failed to emit ranking: {e}")
+
+    def _read_results(self):
+        """
+        (best paths, node strengths) copied from the results region if it changed since
+        the last call, else None. The paths match the run_all_solvers result. A torn read
+        is retried; the backend rewrites the region once per iteration.
+        """
+        try:
+            view = self.backend.acquire_results()
+        except ValueError:
+            return None
+        if view is None:
+            return None
+        names = (("aco", view.PATH_ACO), ("random", view.PATH_RANDOM), ("brute", view.PATH_BRUTE))
+        with view:
+            for _ in range(4):
+                seq = view.read_begin()
+                version = view.version
+                if version == self._results_version:
+                    return None
+                strength = view.strength.copy()
+                path_info = {
+                    name: {"nodes": view.path(which).tolist(),
+                           "total_latency": view.latency(which)}
+                    for name, which in names
+                }
+                if not view.read_retry(seq):
+                    self._results_version = version
+                    return path_info, strength
+        return None
 
     def stop(self):
+        """
+        Stops the native loop; callable from any thread. The descriptor is closed by
+        shutdown_backend, after the worker thread has finished.
+        """
         self._stop_event.set()
+        if self.backend is not None and self._loop_fd >= 0:
+            self.backend.stop_solver_loop()
 
     def shutdown_backend(self):
         if self.backend is not None:
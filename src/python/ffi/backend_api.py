@@ -8,7 +8,11 @@ import os
 import sys
 import importlib
 
-from consts._generated.error_codes_generated import ERR_SUCCESS
+import numpy as np
+
+from consts._generated.error_codes_generated import (
+    ERR_SUCCESS, ERR_NO_PATH_FOUND, ERR_NO_TOPOLOGY, ERR_ARRAY_TOO_SMALL
+)
 from structs._generated.auto_structs import AppConfig  # generated by tools/generate_structs.py
 
 # ----------------------------------------------------------------------
@@ -98,12 +102,14 @@ class AntNetWrapper:
     def get_config(self) -> AppConfig:
         """
         Returns the current AppConfig as a dict with new fields:
-          nb_ants, set_nb_nodes, min_hops, max_hops,
+          nb_ants, set_nb_nodes, min_hops, max_hops, seed,
           default_min_delay, default_max_delay, death_delay,
           under_attack_id, attack_started,
-          simulate_ddos, show_random_performance, show_brute_performance,
+          simulate_ddos, show_random_performance, show_brute_performance, exact_solver,
           ranking_alpha, ranking_beta, ranking_gamma,
-          ant_alpha, ant_beta, ant_Q, ant_evaporation
+          ant_alpha, ant_beta, ant_Q, ant_evaporation, ant_construction,
+          ant_evaporation_mode, ant_storage_mode, ant_colonies, ant_migration_interval,
+          ant_migration_mode, brute_mode, brute_step_candidates, brute_step_time_us
         """
         if self.context_id is None:
             raise ValueError("No valid context_id")
@@ -116,6 +122,7 @@ class AntNetWrapper:
             "set_nb_nodes":          cfg_ptr.set_nb_nodes,
             "min_hops":              cfg_ptr.min_hops,
             "max_hops":              cfg_ptr.max_hops,
+            "seed":                  int(cfg_ptr.seed),
             "default_min_delay":     cfg_ptr.default_min_delay,
             "default_max_delay":     cfg_ptr.default_max_delay,
             "death_delay":           cfg_ptr.death_delay,
@@ -124,6 +131,7 @@ class AntNetWrapper:
             "simulate_ddos":         bool(cfg_ptr.simulate_ddos),
             "show_random_performance": bool(cfg_ptr.show_random_performance),
             "show_brute_performance":  bool(cfg_ptr.show_brute_performance),
+            "exact_solver":          bool(cfg_ptr.exact_solver),
             "ranking_alpha":         float(cfg_ptr.ranking_alpha),
             "ranking_beta":          float(cfg_ptr.ranking_beta),
             "ranking_gamma":         float(cfg_ptr.ranking_gamma),
@@ -131,8 +139,25 @@ class AntNetWrapper:
             "ant_beta":              float(cfg_ptr.ant_beta),
             "ant_Q":                 float(cfg_ptr.ant_Q),
             "ant_evaporation":       float(cfg_ptr.ant_evaporation),
+            "ant_construction":      cfg_ptr.ant_construction,
+            "ant_evaporation_mode":  cfg_ptr.ant_evaporation_mode,
+            "ant_storage_mode":      cfg_ptr.ant_storage_mode,
+            "ant_colonies":          cfg_ptr.ant_colonies,
+            "ant_migration_interval": cfg_ptr.ant_migration_interval,
+            "ant_migration_mode":    cfg_ptr.ant_migration_mode,
+            "brute_mode":            cfg_ptr.brute_mode,
+            "brute_step_candidates": cfg_ptr.brute_step_candidates,
+            "brute_step_time_us":    cfg_ptr.brute_step_time_us,
         }
 
+    def _path_buffer_size(self) -> int:
+        """Longest path a solver can return: source, destination and max_hops hops."""
+        cfg_ptr = ffi.new("AppConfig*")
+        rc = lib.pub_get_config(self.context_id, cfg_ptr)
+        if rc != 0:
+            raise ValueError(f"pub_get_config failed with code {rc}")
+        return max(cfg_ptr.max_hops, 0) + 2
+
     # ────────────────────────── iteration ───────────────────────────
     def run_iteration(self) -> None:
         rc = lib.pub_run_iteration(self.context_id)
@@ -144,7 +169,7 @@ class AntNetWrapper:
 
     # ─────────────────────── best-path helper ───────────────────────
     def get_best_path_struct(self):
-        max_nodes = 1024
+        max_nodes = self._path_buffer_size()
         nodes_buf = ffi.new("int[]", max_nodes)
         len_ptr   = ffi.new("int*")
         lat_ptr   = ffi.new("int*")
@@ -203,9 +228,62 @@ class AntNetWrapper:
             raise ValueError(f"update_topology failed with code {rc}")
         raise RuntimeError(f"update_topology returned unexpected {rc}")
 
+    # ─────────────── incremental topology (keeps pheromones) ───────────────
+    def _check_topology_rc(self, name: str, rc: int) -> None:
+        if rc < 0:
+            raise ValueError(f"{name} failed with code {rc}")
+
+    def set_node_delay(self, node_id: int, delay_ms: int) -> None:
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        self._check_topology_rc("set_node_delay",
+                                lib.pub_set_node_delay(self.context_id, node_id, delay_ms))
+
+    def add_edge(self, from_id: int, to_id: int) -> None:
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        self._check_topology_rc("add_edge", lib.pub_add_edge(self.context_id, from_id, to_id))
+
+    def remove_edge(self, from_id: int, to_id: int) -> None:
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        self._check_topology_rc("remove_edge", lib.pub_remove_edge(self.context_id, from_id, to_id))
+
+    def disable_node(self, node_id: int, disabled: bool = True) -> None:
+        """
+        Takes node_id out of every solver, or brings it back with disabled=False.
+        Nodes 0 and 1 (start and end) cannot be disabled.
+        """
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        self._check_topology_rc("disable_node",
+                                lib.pub_disable_node(self.context_id, node_id, 1 if disabled else 0))
+
+    def add_nodes(self, nodes: list[dict]) -> None:
+        """
+        Appends nodes without edges. Ids must continue the current range:
+        num_nodes, num_nodes+1, ... Each node → {"node_id": int, "delay_ms": int >=0}
+        """
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        if not nodes:
+            raise ValueError("Empty node list")
+        node_arr = ffi.new("NodeData[]", len(nodes))
+        for i, nd in enumerate(nodes):
+            node_id  = nd.get("node_id")
+            delay_ms = nd.get("delay_ms")
+            if not isinstance(node_id, int) or node_id < 0:
+                raise ValueError(f"Invalid node_id: {node_id}")
+            if not isinstance(delay_ms, int) or delay_ms < 0:
+                raise ValueError(f"Invalid delay_ms: {delay_ms}")
+            node_arr[i].node_id  = node_id
+            node_arr[i].delay_ms = delay_ms
+        self._check_topology_rc("add_nodes",
+                                lib.pub_add_nodes(self.context_id, node_arr, len(nodes)))
+
     # ───────────────────── run all solvers in C ─────────────────────
     def run_all_solvers(self):
-        max_nodes = 1024
+        max_nodes = self._path_buffer_size()
         a_nodes = ffi.new("int[]", max_nodes)
         r_nodes = ffi.new("int[]", max_nodes)
         b_nodes = ffi.new("int[]", max_nodes)
@@ -237,17 +315,175 @@ class AntNetWrapper:
             },
         }
 
+    # ──────────────────── batched solver iterations ─────────────────
+    BATCH_STOP_ITERATIONS = 0
+    BATCH_STOP_DEADLINE = 1
+    BATCH_STOP_CONVERGED = 2
+    BATCH_TRACE_WIDTH = 3
+
+    def run_solvers_batch(self, max_iterations: int, time_budget_us: int = 0,
+                          stall_iterations: int = 0, trace: bool = True) -> dict:
+        """
+        Runs up to max_iterations solver iterations in one native call, stopping early at
+        the time budget or after stall_iterations iterations without improvement (0 = off).
+        Returns the run_all_solvers result of the last iteration plus "iterations",
+        "stop_reason" (a BATCH_STOP_* value) and "trace": one (aco, random, brute) best
+        latency tuple per iteration, -1 while a solver has no path.
+        """
+        max_nodes = self._path_buffer_size()
+        a_nodes = ffi.new("int[]", max_nodes)
+        r_nodes = ffi.new("int[]", max_nodes)
+        b_nodes = ffi.new("int[]", max_nodes)
+
+        a_len = ffi.new("int*"); r_len = ffi.new("int*"); b_len = ffi.new("int*")
+        a_lat = ffi.new("int*"); r_lat = ffi.new("int*"); b_lat = ffi.new("int*")
+
+        trace_rows = max_iterations if trace else 0
+        trace_buf = ffi.new("int[]", max(trace_rows, 1) * self.BATCH_TRACE_WIDTH)
+        iterations = ffi.new("int*")
+        stop_reason = ffi.new("int*")
+
+        rc = lib.pub_run_solvers_batch(
+            self.context_id, max_iterations, time_budget_us, stall_iterations,
+            a_nodes, max_nodes, a_len, a_lat,
+            r_nodes, max_nodes, r_len, r_lat,
+            b_nodes, max_nodes, b_len, b_lat,
+            trace_buf, trace_rows, iterations, stop_reason
+        )
+        if rc != 0:
+            raise ValueError(f"run_solvers_batch failed with code {rc}")
+
+        w = self.BATCH_TRACE_WIDTH
+        rows = min(iterations[0], trace_rows)
+        return {
+            "aco": {
+                "nodes": [a_nodes[i] for i in range(a_len[0])],
+                "total_latency": a_lat[0],
+            },
+            "random": {
+                "nodes": [r_nodes[i] for i in range(r_len[0])],
+                "total_latency": r_lat[0],
+            },
+            "brute": {
+                "nodes": [b_nodes[i] for i in range(b_len[0])],
+                "total_latency": b_lat[0],
+            },
+            "iterations": iterations[0],
+            "stop_reason": stop_reason[0],
+            "trace": [tuple(trace_buf[r * w + c] for c in range(w)) for r in range(rows)],
+        }
+
     # ───────────────────── pheromone matrix read ────────────────────
+    def _read_pheromones(self, name: str, read) -> tuple[int, "ffi.CData"]:
+        """
+        Calls read(buf, max_count) with a buffer sized to the current n*n, asking the
+        backend for the size first; retried if the topology grows in between.
+        """
+        while True:
+            count = read(ffi.NULL, 0)
+            if count < 0:
+                raise ValueError(f"{name} failed with code {count}")
+            buf = ffi.new("float[]", max(count, 1))
+            rc = read(buf, count)
+            if rc != ERR_ARRAY_TOO_SMALL:
+                break
+        if rc < 0:
+            raise ValueError(f"{name} failed with code {rc}")
+        return rc, buf
+
     def get_pheromone_matrix(self) -> list[float]:
         if self.context_id is None:
             raise ValueError("Invalid context_id")
-        max_floats = 1024 * 1024
-        buf = ffi.new("float[]", max_floats)
-        rc = lib.pub_get_pheromone_matrix(self.context_id, buf, max_floats)
-        if rc < 0:
-            raise ValueError(f"get_pheromone_matrix failed with code {rc}")
+        rc, buf = self._read_pheromones(
+            "get_pheromone_matrix",
+            lambda out, count: lib.pub_get_pheromone_matrix(self.context_id, out, count))
         return [buf[i] for i in range(rc)]
 
+    def get_pheromone_snapshot(self, known_version: int = 0) -> tuple[int, list[float] | None]:
+        """
+        Lock-free read of the matrix published after the last iteration.
+        Returns (version, matrix), with matrix None when version == known_version.
+        """
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        version = ffi.new("uint64_t*")
+        rc, buf = self._read_pheromones(
+            "get_pheromone_snapshot",
+            lambda out, count: lib.pub_get_pheromone_snapshot(self.context_id, out, count,
+                                                              known_version, version))
+        if rc == 0:
+            return int(version[0]), None
+        return int(version[0]), [buf[i] for i in range(rc)]
+
+    # ─────────────────────── zero-copy results ──────────────────────
+    def acquire_results(self) -> "ResultsView | None":
+        """
+        Pins the context's results region and wraps it without copying, or returns None
+        before the first solver call that follows the first acquire. Use as a context
+        manager, or call release(), before the next solver call has to pick a new layout.
+        """
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        region = ffi.new("void **")
+        size = ffi.new("uint64_t *")
+        rc = lib.pub_results_acquire(self.context_id, region, size)
+        if rc == ERR_NO_TOPOLOGY:
+            return None
+        if rc != 0:
+            raise ValueError(f"pub_results_acquire failed with code {rc}")
+        return ResultsView(self.context_id, region[0], int(size[0]))
+
+    # ──────────────────────── native solver loop ────────────────────
+    def start_solver_loop(self, progress_interval_ms: int = 100) -> int:
+        """
+        Runs solver iterations continuously on a native thread and returns a non-blocking
+        descriptor (e.g. for QSocketNotifier) that becomes readable after improvements and
+        every progress_interval_ms (0 = improvements only). Results are read from
+        acquire_results(). Calling it again while running only changes the interval.
+        """
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        fd = ffi.new("int *")
+        rc = lib.pub_solver_loop_start(self.context_id, progress_interval_ms, fd)
+        if rc != 0:
+            raise ValueError(f"pub_solver_loop_start failed with code {rc}")
+        return fd[0]
+
+    def stop_solver_loop(self) -> None:
+        """Stops the loop after its iteration in progress; the descriptor stays open."""
+        if self.context_id is None:
+            return
+        rc = lib.pub_solver_loop_stop(self.context_id)
+        if rc != 0:
+            raise ValueError(f"pub_solver_loop_stop failed with code {rc}")
+
+    def get_solver_loop_status(self) -> dict:
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        running = ffi.new("int *")
+        iterations = ffi.new("uint64_t *")
+        improvements = ffi.new("uint64_t *")
+        rc = lib.pub_solver_loop_status(self.context_id, running, iterations, improvements)
+        if rc != 0:
+            raise ValueError(f"pub_solver_loop_status failed with code {rc}")
+        return {
+            "running": bool(running[0]),
+            "iterations": int(iterations[0]),
+            "improvements": int(improvements[0]),
+        }
+
+    @staticmethod
+    def drain_solver_loop_fd(fd: int) -> bool:
+        """Re-arms the descriptor; True if a wakeup was pending."""
+        pending = False
+        while True:
+            try:
+                if not os.read(fd, 4096):
+                    return pending
+            except BlockingIOError:
+                return pending
+            pending = True
+
     # ─────────────────────────── ranking ────────────────────────────
     def get_algo_ranking(self) -> list[dict]:
         if self.context_id is None:
@@ -267,6 +503,292 @@ class AntNetWrapper:
             })
         return result
 
+    # ─────────────────────── worker threads ─────────────────────────
+    def set_worker_threads(self, nb_threads: int) -> None:
+        """0 selects the number of online cores."""
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        rc = lib.pub_set_worker_threads(self.context_id, nb_threads)
+        if rc != 0:
+            raise ValueError(f"set_worker_threads failed with code {rc}")
+
+    # ────────────────── ACO construction / evaporation ──────────────
+    ACO_CONSTRUCT_SUBSET = 0
+    ACO_CONSTRUCT_EDGE_WALK = 1
+
+    def set_aco_construction_mode(self, mode: int) -> None:
+        """ACO_CONSTRUCT_SUBSET or ACO_CONSTRUCT_EDGE_WALK; pheromones are kept."""
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        rc = lib.pub_set_aco_construction_mode(self.context_id, mode)
+        if rc != 0:
+            raise ValueError(f"set_aco_construction_mode failed with code {rc}")
+
+    def get_aco_construction_mode(self) -> int:
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        out = ffi.new("int*")
+        rc = lib.pub_get_aco_construction_mode(self.context_id, out)
+        if rc != 0:
+            raise ValueError(f"get_aco_construction_mode failed with code {rc}")
+        return int(out[0])
+
+    ACO_EVAPORATE_PATH = 0
+    ACO_EVAPORATE_GLOBAL = 1
+    ACO_EVAPORATE_LAZY = 2
+
+    def set_aco_evaporation_mode(self, mode: int) -> None:
+        """ACO_EVAPORATE_PATH, ACO_EVAPORATE_GLOBAL or ACO_EVAPORATE_LAZY."""
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        rc = lib.pub_set_aco_evaporation_mode(self.context_id, mode)
+        if rc != 0:
+            raise ValueError(f"set_aco_evaporation_mode failed with code {rc}")
+
+    def get_aco_evaporation_mode(self) -> int:
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        out = ffi.new("int*")
+        rc = lib.pub_get_aco_evaporation_mode(self.context_id, out)
+        if rc != 0:
+            raise ValueError(f"get_aco_evaporation_mode failed with code {rc}")
+        return int(out[0])
+
+    ACO_STORAGE_FLOAT = 0
+    ACO_STORAGE_FP16 = 1
+    ACO_STORAGE_LOG16 = 2
+
+    def set_aco_storage_mode(self, mode: int) -> None:
+        """ACO_STORAGE_FLOAT, ACO_STORAGE_FP16 or ACO_STORAGE_LOG16."""
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        rc = lib.pub_set_aco_storage_mode(self.context_id, mode)
+        if rc != 0:
+            raise ValueError(f"set_aco_storage_mode failed with code {rc}")
+
+    def get_aco_storage_mode(self) -> int:
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        out = ffi.new("int*")
+        rc = lib.pub_get_aco_storage_mode(self.context_id, out)
+        if rc != 0:
+            raise ValueError(f"get_aco_storage_mode failed with code {rc}")
+        return int(out[0])
+
+    # ─────────────────────────── colonies ───────────────────────────
+    ACO_MIGRATE_BEST_PATH = 0
+    ACO_MIGRATE_BLEND = 1
+
+    def set_aco_colonies(self, colony_count: int, migration_interval: int = 10,
+                         migration_mode: int = ACO_MIGRATE_BEST_PATH) -> None:
+        """colony_count 1..64; migration_interval 0 disables migration."""
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        rc = lib.pub_set_aco_colonies(self.context_id, colony_count,
+                                      migration_interval, migration_mode)
+        if rc != 0:
+            raise ValueError(f"set_aco_colonies failed with code {rc}")
+
+    def get_aco_colonies(self) -> dict:
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        count = ffi.new("int*")
+        interval = ffi.new("int*")
+        mode = ffi.new("int*")
+        rc = lib.pub_get_aco_colonies(self.context_id, count, interval, mode)
+        if rc != 0:
+            raise ValueError(f"get_aco_colonies failed with code {rc}")
+        return {
+            "colony_count": count[0],
+            "migration_interval": interval[0],
+            "migration_mode": mode[0],
+        }
+
+    # ──────────────────────────── seeding ───────────────────────────
+    def set_seed(self, seed: int) -> None:
+        """0 picks a clock-based seed; read it back with get_seed()."""
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        rc = lib.pub_set_seed(self.context_id, seed)
+        if rc != 0:
+            raise ValueError(f"set_seed failed with code {rc}")
+
+    def get_seed(self) -> int:
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        out = ffi.new("uint64_t*")
+        rc = lib.pub_get_seed(self.context_id, out)
+        if rc != 0:
+            raise ValueError(f"get_seed failed with code {rc}")
+        return int(out[0])
+
+    # ───────────────────────── exact solver ─────────────────────────
+    def set_exact_solver(self, enabled: bool) -> None:
+        """Adds the exact solver to run_all_solvers and the ranking as "EXACT"."""
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        rc = lib.pub_set_exact_solver(self.context_id, 1 if enabled else 0)
+        if rc != 0:
+            raise ValueError(f"set_exact_solver failed with code {rc}")
+
+    def get_exact_solver(self) -> bool:
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        out = ffi.new("int*")
+        rc = lib.pub_get_exact_solver(self.context_id, out)
+        if rc != 0:
+            raise ValueError(f"get_exact_solver failed with code {rc}")
+        return bool(out[0])
+
+    def get_exact_path(self) -> dict | None:
+        """
+        Exact optimum for the current topology, or None when no route fits the hop range.
+        lower_bound is the cheapest walk: below total_latency in edge mode when it repeats a node.
+        """
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        max_nodes = self._path_buffer_size()
+        nodes = ffi.new("int[]", max_nodes)
+        length = ffi.new("int*")
+        latency = ffi.new("int*")
+        bound = ffi.new("int*")
+        rc = lib.pub_get_exact_path(self.context_id, nodes, max_nodes, length, latency, bound)
+        if rc == ERR_NO_PATH_FOUND:
+            return None
+        if rc != 0:
+            raise ValueError(f"get_exact_path failed with code {rc}")
+        return {
+            "nodes": [nodes[i] for i in range(length[0])],
+            "total_latency": latency[0],
+            "lower_bound": bound[0],
+        }
+
+    # ───────────────────────── brute force ──────────────────────────
+    BRUTE_MODE_PERMUTATION = 0
+    BRUTE_MODE_BRANCH_BOUND = 1
+    BRUTE_MODE_PARALLEL = 2
+
+    def set_brute_force_mode(self, mode: int, step_candidates: int = 100000,
+                             step_time_us: int = 2000) -> None:
+        """Budgets apply to branch_bound mode per run_all_solvers call; 0 disables a limit."""
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        rc = lib.pub_set_brute_force_mode(self.context_id, mode, step_candidates, step_time_us)
+        if rc != 0:
+            raise ValueError(f"set_brute_force_mode failed with code {rc}")
+
+    def get_brute_force_mode(self) -> dict:
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        mode = ffi.new("int*")
+        candidates = ffi.new("int*")
+        time_us = ffi.new("int*")
+        done = ffi.new("int*")
+        rc = lib.pub_get_brute_force_mode(self.context_id, mode, candidates, time_us, done)
+        if rc != 0:
+            raise ValueError(f"get_brute_force_mode failed with code {rc}")
+        return {
+            "mode": mode[0],
+            "step_candidates": candidates[0],
+            "step_time_us": time_us[0],
+            "done": bool(done[0]),
+        }
+
+    def get_brute_force_checkpoint(self) -> bytes:
+        """Opaque snapshot of a branch_bound / parallel enumeration, safe to write to disk."""
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        max_path = self._path_buffer_size()
+        cp = ffi.new("BruteForceCheckpoint*", max_path)
+        rc = lib.pub_get_brute_force_checkpoint(self.context_id, cp, max_path)
+        if rc != 0:
+            raise ValueError(f"get_brute_force_checkpoint failed with code {rc}")
+        size = ffi.sizeof("BruteForceCheckpoint") + cp.best_length * ffi.sizeof("int")
+        return ffi.buffer(cp, size)[:]
+
+    def restore_brute_force_checkpoint(self, data: bytes) -> None:
+        """Resumes from get_brute_force_checkpoint(); the topology and hop range must match."""
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        fixed, int_size = ffi.sizeof("BruteForceCheckpoint"), ffi.sizeof("int")
+        if len(data) < fixed or (len(data) - fixed) % int_size:
+            raise ValueError("checkpoint size mismatch")
+        cp = ffi.new("BruteForceCheckpoint*", (len(data) - fixed) // int_size)
+        ffi.memmove(cp, data, len(data))
+        if len(data) != fixed + cp.best_length * int_size:
+            raise ValueError("checkpoint size mismatch")
+        rc = lib.pub_restore_brute_force_checkpoint(self.context_id, cp)
+        if rc != 0:
+            raise ValueError(f"restore_brute_force_checkpoint failed with code {rc}")
+
+    # ─────────────────────────── logging ────────────────────────────
+    LOG_ERROR = 0
+    LOG_WARN = 1
+    LOG_INFO = 2
+    LOG_DEBUG = 3
+
+    @staticmethod
+    def drain_logs(max_count: int = 256) -> list[dict]:
+        """Pending backend log lines of every context and thread, oldest first."""
+        entries = ffi.new("AntNetLogEntry[]", max_count)
+        rc = lib.pub_drain_logs(entries, max_count)
+        if rc < 0:
+            raise ValueError(f"drain_logs failed with code {rc}")
+        return [
+            {
+                "seq": entries[i].seq,
+                "time_us": entries[i].time_us,
+                "level": entries[i].level,
+                "context_id": entries[i].context_id,
+                "message": ffi.string(entries[i].message).decode("utf-8", "replace"),
+            }
+            for i in range(rc)
+        ]
+
+    @staticmethod
+    def set_log_level(level: int) -> None:
+        rc = lib.pub_set_log_level(level)
+        if rc != 0:
+            raise ValueError(f"set_log_level failed with code {rc}")
+
+    @staticmethod
+    def get_log_dropped() -> int:
+        out = ffi.new("uint64_t*")
+        rc = lib.pub_get_log_dropped(out)
+        if rc != 0:
+            raise ValueError(f"get_log_dropped failed with code {rc}")
+        return out[0]
+
+    # ───────────────────── performance counters ─────────────────────
+    # Index order of AntNetPerfCounters (ANTNET_PERF_* in antnet_perf_types.h).
+    PERF_PHASES = ("aco_construct", "aco_weighting", "aco_sampling", "aco_merge",
+                   "sasa_update", "brute_step", "random_step", "topology_update",
+                   "lock_wait", "iteration")
+
+    def get_perf_counters(self) -> dict:
+        """Per phase: calls, total_ns and max_ns since creation or the last reset."""
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        pc = ffi.new("AntNetPerfCounters*")
+        rc = lib.pub_get_perf_counters(self.context_id, pc)
+        if rc != 0:
+            raise ValueError(f"get_perf_counters failed with code {rc}")
+        return {
+            name: {
+                "calls": pc.calls[i],
+                "total_ns": pc.total_ns[i],
+                "max_ns": pc.max_ns[i],
+            }
+            for i, name in enumerate(self.PERF_PHASES)
+        }
+
+    def reset_perf_counters(self) -> None:
+        if self.context_id is None:
+            raise ValueError("Invalid context_id")
+        rc = lib.pub_reset_perf_counters(self.context_id)
+        if rc != 0:
+            raise ValueError(f"reset_perf_counters failed with code {rc}")
+
     # ───────────────────────── shutdown ─────────────────────────────
     def shutdown(self) -> None:
         if self.context_id is None:
@@ -286,6 +808,73 @@ class AntNetWrapper:
             pass
 
 
+class ResultsView:
+    """
+    numpy views over a pinned results region (AntNetResultsHeader in antnet_results_types.h).
+    The backend rewrites the arrays in place; wrap each read in read_begin/read_retry
+    and start over while read_retry is True:
+
+        seq = view.read_begin()
+        strength = view.strength.copy()
+        if view.read_retry(seq): ...  # torn read
+
+    The arrays are valid until release(); copy anything kept beyond it.
+    """
+
+    PATH_ACO, PATH_RANDOM, PATH_BRUTE, PATH_EXACT = range(4)
+
+    def __init__(self, context_id: int, region, size: int):
+        self._context_id = context_id
+        self._region = region
+        self.header = ffi.cast("AntNetResultsHeader *", region)
+        buf = ffi.buffer(region, size)
+        h = self.header
+        n, cap = h.num_nodes, h.path_capacity
+        self.pheromone = np.frombuffer(buf, dtype=np.float32, count=n * n,
+                                       offset=h.pheromone_offset).reshape(n, n)
+        self.strength = np.frombuffer(buf, dtype=np.float32, count=n,
+                                      offset=h.strength_offset)
+        self.paths = np.frombuffer(buf, dtype=np.intc, count=4 * cap,
+                                   offset=h.paths_offset).reshape(4, cap)
+
+    def read_begin(self) -> int:
+        """Waits out a write in progress and returns the even sequence number."""
+        while True:
+            seq = self.header.seq
+            if seq % 2 == 0:
+                return seq
+
+    def read_retry(self, seq: int) -> bool:
+        """True if the region changed since read_begin returned seq."""
+        return self.header.seq != seq
+
+    @property
+    def version(self) -> int:
+        return int(self.header.version)
+
+    def path(self, which: int) -> np.ndarray:
+        """Nodes of best path 'which' (PATH_*), a view into the region."""
+        return self.paths[which, :self.header.path_length[which]]
+
+    def latency(self, which: int) -> int:
+        return int(self.header.path_latency[which])
+
+    def release(self) -> None:
+        if self._region is None:
+            return
+        region, self._region = self._region, None
+        self.pheromone = self.strength = self.paths = None
+        rc = lib.pub_results_release(self._context_id, region)
+        if rc != 0:
+            raise ValueError(f"pub_results_release failed with code {rc}")
+
+    def __enter__(self) -> "ResultsView":
+        return self
+
+    def __exit__(self, *exc) -> None:
+        self.release()
+
+
 
 
 
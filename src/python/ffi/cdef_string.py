@@ -16,6 +16,7 @@ typedef struct {
     int set_nb_nodes;
     int min_hops;
     int max_hops;
+    uint64_t seed;
     int default_min_delay;
     int default_max_delay;
     int death_delay;
@@ -24,6 +25,7 @@ typedef struct {
     _Bool simulate_ddos;
     _Bool show_random_performance;
     _Bool show_brute_performance;
+    _Bool exact_solver;
     double ranking_alpha;
     double ranking_beta;
     double ranking_gamma;
@@ -31,17 +33,59 @@ typedef struct {
     float ant_beta;
     float ant_Q;
     float ant_evaporation;
+    int ant_construction;
+    int ant_evaporation_mode;
+    int ant_storage_mode;
+    int ant_colonies;
+    int ant_migration_interval;
+    int ant_migration_mode;
+    int brute_mode;
+    int brute_step_candidates;
+    int brute_step_time_us;
 } AppConfig;
 typedef struct {
-    int candidate_nodes[1024];
+    int candidate_capacity;
+    int hop_capacity;
+    int *candidate_nodes;
     int candidate_count;
     int current_L;
-    int permutation[1024];
-    int combination[1024];
+    int *permutation;
+    int *combination;
     int at_first_permutation;
     int at_first_combination;
     int done;
+    int mode;
+    int step_candidates;
+    int step_time_us;
+    int bb_depth;
+    long long bb_best;
+    long long *bb_partial;
+    long long *bb_prefix;
+    long long evaluated;
+    uint64_t signature;
+    int par_L;
+    int par_ranges;
+    uint64_t par_next[64];
+    uint64_t par_end[64];
+    long long par_best[64];
+    uint64_t par_best_rank[64];
+    int *par_comb;
 } BruteForceState;
+typedef struct {
+    uint64_t signature;
+    int mode;
+    int current_L;
+    int done;
+    long long best_latency;
+    int range_count;
+    uint64_t range_next[64];
+    uint64_t range_end[64];
+    long long range_best[64];
+    uint64_t range_best_rank[64];
+    int best_path_latency;
+    int best_length;
+    int best_nodes[];
+} BruteForceCheckpoint;
 typedef struct {
     int *nodes;
     int node_count;
@@ -93,10 +137,42 @@ typedef struct {
     int latency_ms;
 } RankingEntry;
 typedef struct {
-    int *adjacency;
+    uint64_t seq;
+    uint64_t time_us;
+    int level;
+    int context_id;
+    char message[128];
+} AntNetLogEntry;
+typedef struct {
+    uint64_t calls[10];
+    uint64_t total_ns[10];
+    uint64_t max_ns[10];
+} AntNetPerfCounters;
+typedef struct AcoColonySet AcoColonySet;
+typedef struct {
+    uint64_t *adjacency_bits;
+    int adjacency_words;
     int adjacency_size;
     float *pheromones;
+    uint16_t *pheromones_q;
+    int storage_mode;
     int pheromone_size;
+    double *row_sums;
+    int *nbr_offsets;
+    int *nbr_targets;
+    float *choice_info;
+    int construction_mode;
+    int evaporation_mode;
+    int *cell_stamps;
+    int *row_stamps;
+    int evap_clock;
+    float *decay_table;
+    int decay_table_size;
+    float decay_rate;
+    int colony_count;
+    int migration_interval;
+    int migration_mode;
+    AcoColonySet *colonies;
     float alpha;
     float beta;
     float evaporation;
@@ -104,7 +180,19 @@ typedef struct {
     int num_ants;
     int is_initialized;
 } AcoV1State;
+typedef struct {
+    int enabled;
+    int solved;
+    unsigned int topology_version;
+    int mode;
+    int min_hops;
+    int max_hops;
+    int lower_bound;
+} ExactSolverState;
 typedef struct HeatmapRenderer HeatmapRenderer;
+typedef struct {
+    uint64_t s[4];
+} AntNetRng;
 typedef struct {
     pthread_mutex_t lock;
     NodeData *start_node;
@@ -115,7 +203,24 @@ typedef struct {
     size_t edge_count;
     int default_min_delay;
     int default_max_delay;
+    AntNetRng rng;
 } HopMapManager;
+typedef struct WorkerPool WorkerPool;
+typedef struct PheromoneSnapshots PheromoneSnapshots;
+typedef struct ResultsStore ResultsStore;
+typedef struct SolverLoop SolverLoop;
+typedef struct {
+    uint64_t seq;
+    uint64_t version;
+    uint64_t iteration;
+    uint64_t pheromone_offset;
+    uint64_t strength_offset;
+    uint64_t paths_offset;
+    int num_nodes;
+    int path_capacity;
+    int path_length[4];
+    int path_latency[4];
+} AntNetResultsHeader;
 typedef struct {
     int node_count;
     int min_hops;
@@ -125,24 +230,47 @@ typedef struct {
     EdgeData *edges;
     int num_edges;
     int iteration;
+    unsigned char *node_disabled;
+    unsigned int topology_version;
+    int path_capacity;
     pthread_mutex_t lock;
-    int random_best_nodes[1024];
+    pthread_mutex_t run_lock;
+    pthread_mutex_t aco_lock;
+    pthread_mutex_t random_lock;
+    pthread_mutex_t brute_lock;
+    pthread_mutex_t exact_lock;
+    int *random_best_nodes;
     int random_best_length;
     int random_best_latency;
     AppConfig config;
-    int brute_best_nodes[1024];
+    int *brute_best_nodes;
     int brute_best_length;
     int brute_best_latency;
     BruteForceState brute_state;
-    int aco_best_nodes[1024];
+    int *aco_best_nodes;
     int aco_best_length;
     int aco_best_latency;
     AcoV1State aco_v1;
+    int *exact_best_nodes;
+    int exact_best_length;
+    int exact_best_latency;
+    ExactSolverState exact_state;
     SasaState aco_sasa;
     SasaState random_sasa;
     SasaState brute_sasa;
+    SasaState exact_sasa;
     SasaCoeffs sasa_coeffs;
     HopMapManager *hop_map_mgr;
+    WorkerPool *worker_pool;
+    int worker_threads;
+    WorkerPool *solver_pool;
+    PheromoneSnapshots *pheromone_snapshots;
+    ResultsStore *results;
+    SolverLoop *solver_loop;
+    uint64_t rng_seed;
+    AntNetRng random_rng;
+    AntNetRng aco_rng;
+    AntNetPerfCounters perf;
 } AntNetContext;
 
 
@@ -152,9 +280,11 @@ int pub_run_iteration(int context_id);
 int pub_shutdown(int context_id);
 int pub_get_best_path(int context_id, int *out_nodes, int max_size, int *out_path_len, int *out_total_latency);
 int pub_run_all_solvers(int context_id, int *out_nodes_aco, int max_size_aco, int *out_len_aco, int *out_latency_aco, int *out_nodes_random, int max_size_random, int *out_len_random, int *out_latency_random, int *out_nodes_brute, int max_size_brute, int *out_len_brute, int *out_latency_brute);
+int pub_run_solvers_batch(int context_id, int max_iterations, int time_budget_us, int stall_iterations, int *out_nodes_aco, int max_size_aco, int *out_len_aco, int *out_latency_aco, int *out_nodes_random, int max_size_random, int *out_len_random, int *out_latency_random, int *out_nodes_brute, int max_size_brute, int *out_len_brute, int *out_latency_brute, int *out_trace, int trace_rows, int *out_iterations, int *out_stop_reason);
 int pub_init_from_config(const char *config_path);
 int pub_get_config(int context_id, AppConfig *out);
 int pub_get_pheromone_matrix(int context_id, float *out, int max_count);
+int pub_get_pheromone_snapshot(int context_id, float *out, int max_count, uint64_t known_version, uint64_t *out_version);
 int pub_render_heatmap_rgba(const float *pts_xy, const float *strength, int n, unsigned char *out_rgba, int width, int height);
 int pub_renderer_async_init(int initial_width, int initial_height);
 int pub_renderer_async_shutdown(void);
@@ -163,7 +293,41 @@ int pub_set_sasa_params(int context_id, double alpha, double beta, double gamma)
 int pub_get_sasa_params(int context_id, double *out_alpha, double *out_beta, double *out_gamma);
 int pub_set_aco_params(int context_id, float alpha, float beta, float Q, float evaporation, int num_ants);
 int pub_get_aco_params(int context_id, float *out_alpha, float *out_beta, float *out_Q, float *out_evaporation, int *out_num_ants);
+int pub_set_aco_construction_mode(int context_id, int mode);
+int pub_get_aco_construction_mode(int context_id, int *out_mode);
+int pub_set_aco_evaporation_mode(int context_id, int mode);
+int pub_get_aco_evaporation_mode(int context_id, int *out_mode);
+int pub_set_aco_storage_mode(int context_id, int mode);
+int pub_get_aco_storage_mode(int context_id, int *out_mode);
+int pub_set_aco_colonies(int context_id, int colony_count, int migration_interval, int migration_mode);
+int pub_get_aco_colonies(int context_id, int *out_colony_count, int *out_migration_interval, int *out_migration_mode);
+int pub_set_worker_threads(int context_id, int nb_threads);
+int pub_set_seed(int context_id, uint64_t seed);
+int pub_get_seed(int context_id, uint64_t *out_seed);
+int pub_set_exact_solver(int context_id, int enabled);
+int pub_get_exact_solver(int context_id, int *out_enabled);
+int pub_get_exact_path(int context_id, int *out_nodes, int max_size, int *out_len, int *out_latency, int *out_lower_bound);
+int pub_set_brute_force_mode(int context_id, int mode, int step_candidates, int step_time_us);
+int pub_get_brute_force_mode(int context_id, int *out_mode, int *out_step_candidates, int *out_step_time_us, int *out_done);
+int pub_get_brute_force_checkpoint(int context_id, BruteForceCheckpoint *out, int max_path);
+int pub_restore_brute_force_checkpoint(int context_id, const BruteForceCheckpoint *cp);
+int pub_drain_logs(AntNetLogEntry *out, int max_count);
+int pub_set_log_level(int level);
+int pub_get_log_dropped(uint64_t *out_dropped);
+int pub_get_perf_counters(int context_id, AntNetPerfCounters *out);
+int pub_reset_perf_counters(int context_id);
+int pub_results_acquire(int context_id, void **out_region, uint64_t *out_bytes);
+int pub_results_release(int context_id, void *region);
+int pub_solver_loop_start(int context_id, int progress_interval_ms, int *out_fd);
+int pub_solver_loop_stop(int context_id);
+int pub_solver_loop_status(int context_id, int *out_running, uint64_t *out_iterations,
+                           uint64_t *out_improvements);
 int pub_update_topology(int context_id, const NodeData *nodes, int num_nodes, const EdgeData *edges, int num_edges);
+int pub_set_node_delay(int context_id, int node_id, int delay_ms);
+int pub_add_edge(int context_id, int from_id, int to_id);
+int pub_remove_edge(int context_id, int from_id, int to_id);
+int pub_disable_node(int context_id, int node_id, int disabled);
+int pub_add_nodes(int context_id, const NodeData *nodes, int count);
 void pub_config_set_defaults(AppConfig *cfg);
 _Bool pub_config_load(AppConfig *cfg, const char *filepath);
 _Bool pub_config_save(const AppConfig *cfg, const char *filepath);
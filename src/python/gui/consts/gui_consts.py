@@ -5,7 +5,8 @@ Contains color constants used across the GUI.
 ALGO_COLORS = {
     "aco":    "#0a87ba",
     "random": "#52be80",
-    "brute":  "#FF5733"
+    "brute":  "#FF5733",
+    "exact":  "#8E44AD"
 }
 
 # Additional node color constants for consistent usage
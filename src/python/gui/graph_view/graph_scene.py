@@ -297,12 +297,13 @@ class GraphScene(QGraphicsScene):
     # ─────────────────────────────────────────────────────────────────
     # Heat-map
     # ─────────────────────────────────────────────────────────────────
-    def update_heatmap(self, pheromone_matrix: list[float]):
+    def update_heatmap(self, node_strength):
         """
         Called by solver signals to refresh or generate a new heatmap overlay,
         layering below all nodes & edges (ZValue=-9999).
+        node_strength holds the strongest outgoing pheromone of each node.
         """
-        if not pheromone_matrix:
+        if node_strength is None or len(node_strength) == 0:
             return
 
         node_positions = self._ordered_node_positions()
@@ -313,7 +314,7 @@ class GraphScene(QGraphicsScene):
                 scene_w = int(self.sceneRect().width())
                 scene_h = int(self.sceneRect().height())
                 pixmap = generate_heatmap_gl(
-                    pheromone_matrix,
+                    node_strength,
                     node_positions=node_positions,
                     width=scene_w,
                     height=scene_h,
@@ -324,7 +325,7 @@ class GraphScene(QGraphicsScene):
 
         if pixmap is None or pixmap.isNull():
             pixmap = generate_heatmap(
-                pheromone_matrix,
+                node_strength,
                 node_positions=node_positions,
                 size_factor=1.25,
             )
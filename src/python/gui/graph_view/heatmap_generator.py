@@ -51,38 +51,45 @@ def _jet_color(value: float, vmin: float, vmax: float, alpha: int):
     return (int(r * 255), int(g * 255), int(b * 255), alpha)
 
 
+def _strength_range(node_strength, n: int):
+    """
+    Returns node_strength as a float32 array with the (vmin, vmax) range of its
+    non-zero values, or None when it does not match the n nodes or is all zero.
+    """
+    if node_strength is None:
+        return None
+    out_vals = np.asarray(node_strength, dtype=np.float32)
+    if n == 0 or out_vals.shape != (n,):
+        return None
+    non_zero = out_vals[out_vals > 0.0]
+    if non_zero.size == 0:
+        return None
+    vmin, vmax = float(non_zero.min()), float(non_zero.max())
+    if vmax - vmin < 1e-6:
+        vmax = vmin + 1e-6
+    return out_vals, vmin, vmax
+
+
 def generate_heatmap(
-    pheromone_matrix: list[float],
+    node_strength,
     node_positions: list[tuple[float, float]] | None = None,
     size_factor: float = 1.25
 ) -> QPixmap:
     """
-    generate_heatmap: draws a square under each node based on its total outgoing pheromone.
+    generate_heatmap: draws a square under each node based on its strongest outgoing
+    pheromone (node_strength, one value per node, as published by the backend).
     This version avoids interpolation, matplotlib, or slow raster loops.
     Each node emits a visible square scaled by size_factor and colored via a jet map.
     Returns a QPixmap for overlay in the scene.
     """
-    print("Entering generate_heatmap")
-
     from qtpy.QtGui import QImage, QPainter, QColor
-    if not pheromone_matrix or not node_positions:
+    if not node_positions:
         return QPixmap()
 
-    n = len(node_positions)
-    if n * n != len(pheromone_matrix):
+    ranged = _strength_range(node_strength, len(node_positions))
+    if ranged is None:
         return QPixmap()
-
-    # Compute outgoing pheromone per node (max over row, ignoring self).
-    out_vals = [0.0] * n
-    for i in range(n):
-        out_vals[i] = max(pheromone_matrix[i*n + j] for j in range(n) if j != i)
-
-    non_zero = [v for v in out_vals if v > 0.0]
-    if not non_zero:
-        return QPixmap()
-    vmin, vmax = min(non_zero), max(non_zero)
-    if vmax - vmin < 1e-6:
-        vmax = vmin + 1e-6
+    out_vals, vmin, vmax = ranged
 
     max_x = max(x for x, _ in node_positions)
     max_y = max(y for _, y in node_positions)
@@ -102,7 +109,7 @@ def generate_heatmap(
 
     count_drawn = 0
     for i, (x, y) in enumerate(node_positions):
-        strength = out_vals[i]
+        strength = float(out_vals[i])
         if strength <= 0:
             continue
         r, g, b, a = _jet_color(strength, vmin, vmax, 150)
@@ -118,31 +125,20 @@ def generate_heatmap(
     return QPixmap.fromImage(image)
 
 
-def prepare_heatmap_input(pheromone_matrix, node_positions, width=800, height=600):
+def prepare_heatmap_input(node_strength, node_positions, width=800, height=600):
     """
     Prepares the data for GPU offscreen rendering. Scales node coordinates
-    into clip space [-1..1], normalizes the pheromone values, then calls
+    into clip space [-1..1], normalizes the node strengths, then calls
     render_heatmap_rgba. Returns the raw RGBA bytes and the used w/h.
     """
-    if not pheromone_matrix or not node_positions:
-        return b"", 0, 0
-
-    n = len(node_positions)
-    if n * n != len(pheromone_matrix):
+    if not node_positions:
         return b"", 0, 0
 
-    # Max outgoing pheromone per node (excluding self)
-    out_vals = [max(pheromone_matrix[i * n + j] for j in range(n) if j != i) for i in range(n)]
-    non_zero = [v for v in out_vals if v > 0.0]
-    if not non_zero:
+    ranged = _strength_range(node_strength, len(node_positions))
+    if ranged is None:
         return b"", 0, 0
-
-    # Normalize
-    vmin = min(non_zero)
-    vmax = max(non_zero)
-    if vmax - vmin < 1e-6:
-        vmax = vmin + 1e-6
-    norm_vals = [(v - vmin) / (vmax - vmin) for v in out_vals]
+    out_vals, vmin, vmax = ranged
+    norm_vals = ((out_vals - vmin) / (vmax - vmin)).tolist()
 
     # Map each (x, y) from scene coords to OpenGL clip space
     def to_clip_space(x, y):
@@ -161,7 +157,7 @@ def prepare_heatmap_input(pheromone_matrix, node_positions, width=800, height=60
 
 
 def generate_heatmap_gl(
-    pheromone_matrix: list[float],
+    node_strength,
     node_positions: list[tuple[float, float]],
     width: int,
     height: int
@@ -170,7 +166,7 @@ def generate_heatmap_gl(
     Uses the backend OpenGL pipeline (via render_heatmap_rgba) to create the heatmap.
     Then converts the returned RGBA bytes to QPixmap.
     """
-    rgba_data, real_w, real_h = prepare_heatmap_input(pheromone_matrix, node_positions, width, height)
+    rgba_data, real_w, real_h = prepare_heatmap_input(node_strength, node_positions, width, height)
     if not rgba_data:
         return QPixmap()
     return rgba_to_qpixmap(rgba_data, real_w, real_h)
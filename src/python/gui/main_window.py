@@ -201,7 +201,7 @@ class MainWindow(QMainWindow):
                 lambda path_info, idx=idx: self.update_best_path(idx, path_info)
             )
             adapter.signal_iteration_done.connect(self.on_iteration_done)
-            adapter.signal_pheromone_matrix.connect(self.on_pheromone_matrix)
+            adapter.signal_node_strength.connect(self.on_node_strength)
             adapter.signal_ranking_updated.connect(self.on_ranking_updated)
 
     def showEvent(self, event):
@@ -279,8 +279,8 @@ class MainWindow(QMainWindow):
         print("[DEBUG] on_button_update_topology called; sending to CoreManager...")
         self.core_manager.update_topology(topology_data)
 
-    def on_pheromone_matrix(self, matrix: list[float]):
-        self.graph_canvas.scene.update_heatmap(matrix)
+    def on_node_strength(self, strength):
+        self.graph_canvas.scene.update_heatmap(strength)
 
     def on_ranking_updated(self, ranking: list):
         self.aco_visu.showRanking(ranking)
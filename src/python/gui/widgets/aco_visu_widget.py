@@ -84,9 +84,9 @@ class AcoVisuWidget(QWidget):
             self._auto_scroll_enabled = True
 
     def showRanking(self, ranking_list: list[dict]):
-        """Clear and print 3-line ranking (color-coded)."""
+        """Clear and print one ranking line per solver (color-coded)."""
         self.clearLog()
-        for entry in ranking_list[:3]:
+        for entry in ranking_list:
             name   = entry["name"]
             color  = ALGO_COLORS.get(name.lower(), "#000000")
             score  = entry["score"]
@@ -22,6 +22,7 @@ class AppConfig(TypedDict):
     set_nb_nodes: int
     min_hops: int
     max_hops: int
+    seed: int
     default_min_delay: int
     default_max_delay: int
     death_delay: int
@@ -30,6 +31,7 @@ class AppConfig(TypedDict):
     simulate_ddos: bool
     show_random_performance: bool
     show_brute_performance: bool
+    exact_solver: bool
     ranking_alpha: float
     ranking_beta: float
     ranking_gamma: float
@@ -37,6 +39,15 @@ class AppConfig(TypedDict):
     ant_beta: float
     ant_Q: float
     ant_evaporation: float
+    ant_construction: int
+    ant_evaporation_mode: int
+    ant_storage_mode: int
+    ant_colonies: int
+    ant_migration_interval: int
+    ant_migration_mode: int
+    brute_mode: int
+    brute_step_candidates: int
+    brute_step_time_us: int
 
 # from include/types/antnet_path_types.h
 class AntNetPathInfo(TypedDict):
@@ -46,21 +57,63 @@ class AntNetPathInfo(TypedDict):
 
 # from include/types/antnet_brute_force_types.h
 class BruteForceState(TypedDict):
-    candidate_nodes: List[int]
+    candidate_capacity: int
+    hop_capacity: int
     candidate_count: int
     current_L: int
-    permutation: List[int]
-    combination: List[int]
     at_first_permutation: int
     at_first_combination: int
     done: int
+    mode: int
+    step_candidates: int
+    step_time_us: int
+    bb_depth: int
+    signature: int
+    par_L: int
+    par_ranges: int
+    par_next: List[int]
+    par_end: List[int]
+    par_best_rank: List[int]
+
+# from include/types/antnet_brute_force_types.h
+class BruteForceCheckpoint(TypedDict):
+    signature: int
+    mode: int
+    current_L: int
+    done: int
+    range_count: int
+    range_next: List[int]
+    range_end: List[int]
+    range_best_rank: List[int]
+    best_path_latency: int
+    best_length: int
+    best_nodes: List[int]
 
 # from include/types/antnet_aco_v1_types.h
 class AcoV1State(TypedDict):
-    adjacency: List[int]
+    adjacency_bits: List[int]
+    adjacency_words: int
     adjacency_size: int
     pheromones: List[float]
+    pheromones_q: List[int]
+    storage_mode: int
     pheromone_size: int
+    row_sums: List[float]
+    nbr_offsets: List[int]
+    nbr_targets: List[int]
+    choice_info: List[float]
+    construction_mode: int
+    evaporation_mode: int
+    cell_stamps: List[int]
+    row_stamps: List[int]
+    evap_clock: int
+    decay_table: List[float]
+    decay_table_size: int
+    decay_rate: float
+    colony_count: int
+    migration_interval: int
+    migration_mode: int
+    colonies: Any
     alpha: float
     beta: float
     evaporation: float
@@ -88,3 +141,30 @@ class RankingEntry(TypedDict):
     name: Any
     score: float
     latency_ms: int
+
+# from include/types/antnet_log_types.h
+class AntNetLogEntry(TypedDict):
+    seq: int
+    time_us: int
+    level: int
+    context_id: int
+    message: Any
+
+# from include/types/antnet_perf_types.h
+class AntNetPerfCounters(TypedDict):
+    calls: List[int]
+    total_ns: List[int]
+    max_ns: List[int]
+
+# from include/types/antnet_results_types.h
+class AntNetResultsHeader(TypedDict):
+    seq: int
+    version: int
+    iteration: int
+    pheromone_offset: int
+    strength_offset: int
+    paths_offset: int
+    num_nodes: int
+    path_capacity: int
+    path_length: List[int]
+    path_latency: List[int]
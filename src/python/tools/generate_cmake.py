@@ -5,6 +5,8 @@ generate_cmake.py
 Auto-generates a CMakeLists.txt for the AntNet project by scanning:
 - include/ recursively for header paths
 - src/c/ and third_party/ recursively for .c sources
+- bench/ for standalone benchmark programs (one executable per .c file)
+- cli/ for the headless command-line runners (one executable per .c file, installed)
 
 Usage:
     python tools/generate_cmake.py --dry-run
@@ -19,6 +21,8 @@ REPO_ROOT = Path(__file__).resolve().parents[3]
 SRC_DIR = REPO_ROOT / "src" / "c"
 INCLUDE_DIR = REPO_ROOT / "include"
 THIRD_PARTY_DIR = REPO_ROOT / "third_party"
+BENCH_DIR = REPO_ROOT / "bench"
+CLI_DIR = REPO_ROOT / "cli"
 CMAKE_PATH = REPO_ROOT / "CMakeLists.txt"
 
 HEADER_EXCLUDES = {".git", "__pycache__"}
@@ -43,9 +47,37 @@ def collect_c_sources(*roots: Path) -> list[str]:
     return sorted(sources)
 
 
-def generate_cmake(includes: list[str], sources: list[str]) -> str:
+def collect_programs(root: Path) -> list[str]:
+    """Top-level .c files of root; each one holds a main() and becomes an executable."""
+    if not root.is_dir():
+        return []
+    return sorted(str(file.relative_to(REPO_ROOT)) for file in root.glob("*.c"))
+
+
+def generate_program_block(option: str, description: str, programs: list[str],
+                           libraries: str = "antnet_backend m", install: bool = False) -> str:
+    if not programs:
+        return ""
+    lines = [f'option({option} "{description}" ON)', f"if({option})"]
+    for src in programs:
+        name = Path(src).stem
+        lines.append(f"    add_executable({name} {src})")
+        lines.append(f"    target_link_libraries({name} PRIVATE {libraries})")
+        if install:
+            lines.append(f"    install(TARGETS {name} RUNTIME DESTINATION bin)")
+    lines.append("endif()")
+    return "\n".join(lines)
+
+
+def generate_cmake(includes: list[str], sources: list[str], benches: list[str],
+                   clis: list[str]) -> str:
     includes_block = "\n".join(f"    ${{CMAKE_SOURCE_DIR}}/{inc}" for inc in includes)
     sources_block = "\n".join(f"    {src}" for src in sources)
+    bench_block = generate_program_block(
+        "ANTNET_BUILD_BENCHMARKS", "Build the bench/ programs", benches)
+    cli_block = generate_program_block(
+        "ANTNET_BUILD_CLI", "Build the headless cli/ runners", clis,
+        libraries="antnet_backend m Threads::Threads", install=True)
 
     return f"""cmake_minimum_required(VERSION 3.10)
 
@@ -97,6 +129,12 @@ if(UNIX AND NOT APPLE)
     )
 endif()
 
+# ------------------ Benchmarks ------------------------------------
+{bench_block}
+
+# ------------------ Command-line runners --------------------------
+{cli_block}
+
 # ------------------ Install targets -------------------------------
 install(TARGETS antnet_backend
         LIBRARY DESTINATION lib
@@ -119,7 +157,9 @@ def main():
 
     includes = collect_include_dirs(INCLUDE_DIR)
     sources = collect_c_sources(SRC_DIR, THIRD_PARTY_DIR)
-    content = generate_cmake(includes, sources)
+    benches = collect_programs(BENCH_DIR)
+    clis = collect_programs(CLI_DIR)
+    content = generate_cmake(includes, sources, benches, clis)
 
     if args.dry_run:
         print(content)
@@ -19,6 +19,8 @@ TYPE_MAP = {
     "int": "int",
     "float": "float",
     "double": "float",
+    "uint64_t": "int",
+    "uint16_t": "int",
     "_Bool": "bool",
     "bool": "bool",
     "char": "str",  # assume char* = str for now
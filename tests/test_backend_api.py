@@ -10,10 +10,13 @@ Prints bypass PyTest's capture so they always appear in build logs.
 import os
 import sys
 import pytest
+import select
 import threading
 import time
 import os as _os
 
+import numpy as np
+
 
 # -------------------------------------------------------------------- util
 def _announce(msg: str) -> None:
@@ -31,6 +34,47 @@ from ffi.backend_api import AntNetWrapper
 from backend_cffi import ffi, lib
 
 
+# ---------------------------------------------------------------- fixtures
+def _chain_topology(n):
+    """Nodes 0..n-1 with delays 5 + (i * 37) % 50, linked in a chain i - i+1."""
+    nodes = [{"node_id": i, "delay_ms": 5 + (i * 37) % 50} for i in range(n)]
+    edges = [{"from_id": i, "to_id": i + 1} for i in range(n - 1)]
+    return nodes, edges
+
+
+def _ring_topology(n):
+    """Nodes 0..n-1 with delays 1 + (i * 7919) % 13, each linked to i + 7, 14 and 21 mod n."""
+    nodes = [{"node_id": i, "delay_ms": 1 + (i * 7919) % 13} for i in range(n)]
+    edges = [{"from_id": i, "to_id": (i + j * 7) % n} for i in range(n) for j in (1, 2, 3)]
+    return nodes, edges
+
+
+def _spine_topology(n):
+    """
+    Ring-topology delays on the single route 0 - 2 - 3 - ... - n-1 - 1, so with
+    min_hops = n - 2 every solver must return the n-node path 0, 2..n-1, 1.
+    """
+    nodes, _ = _ring_topology(n)
+    edges = [{"from_id": i, "to_id": i + 1} for i in range(2, n - 1)]
+    edges += [{"from_id": 0, "to_id": 2}, {"from_id": n - 1, "to_id": 1}]
+    return nodes, edges
+
+
+def _loaded_wrapper(topology, min_hops, max_hops, brute=None, construction=None):
+    """
+    AntNetWrapper over topology = (nodes, edges). brute = (mode, budget) sets the brute
+    force mode, construction the ACO construction mode.
+    """
+    nodes, edges = topology
+    w = AntNetWrapper(len(nodes), min_hops, max_hops)
+    w.update_topology(nodes, edges)
+    if construction is not None:
+        w.set_aco_construction_mode(construction)
+    if brute is not None:
+        w.set_brute_force_mode(brute[0], brute[1], 0)
+    return w
+
+
 # -------------------------------------------------------------- basic flow
 def test_basic_backend_integration():
     """
@@ -200,3 +244,703 @@ def test_multiple_invalid_context_ids():
     assert lib.pub_run_iteration(9999) < 0
     assert lib.pub_shutdown(9999) < 0
     _announce("🛡️ SECURITY ✅ multiple_invalid_context_ids")
+
+
+# ------------------------------------------------------ seeded replay
+def test_seed_replay():
+    """
+    Same seed and topology must replay bit-for-bit, whatever the worker count.
+    """
+    nodes, edges = _chain_topology(20)
+
+    def run(seed, threads):
+        w = AntNetWrapper(20, 2, 6)
+        w.update_topology(nodes, edges)
+        assert lib.pub_set_aco_params(w.context_id, 1.0, 2.0, 100.0, 0.1, 8) == 0
+        w.set_worker_threads(threads)
+        w.set_seed(seed)
+        assert w.get_seed() == seed
+        for _ in range(25):
+            w.run_all_solvers()
+        out = (w.run_all_solvers(), w.get_pheromone_matrix())
+        w.shutdown()
+        return out
+
+    assert run(1234, 1) == run(1234, 4)
+    _announce("✅ seed_replay")
+
+
+def test_aco_edge_walk_follows_edges():
+    """
+    In edge-walk mode every consecutive pair of the ACO best path must be an edge.
+    """
+    n = 12
+    nodes = [{"node_id": i, "delay_ms": 5 + (i * 13) % 40} for i in range(n)]
+    # ring 0-2-3-...-11-1-0 plus two chords
+    ring = [0] + list(range(2, n)) + [1]
+    edges = [{"from_id": ring[i], "to_id": ring[i + 1]} for i in range(len(ring) - 1)]
+    edges += [{"from_id": 1, "to_id": 0}, {"from_id": 3, "to_id": 8}, {"from_id": 5, "to_id": 1}]
+    linked = {(e["from_id"], e["to_id"]) for e in edges}
+    linked |= {(b, a) for a, b in linked}
+
+    w = AntNetWrapper(n, 1, 10)
+    w.update_topology(nodes, edges)
+    w.set_seed(99)
+    assert lib.pub_set_aco_params(w.context_id, 1.0, 2.0, 100.0, 0.1, 4) == 0
+    w.set_aco_construction_mode(AntNetWrapper.ACO_CONSTRUCT_EDGE_WALK)
+    assert w.get_aco_construction_mode() == AntNetWrapper.ACO_CONSTRUCT_EDGE_WALK
+
+    for _ in range(20):
+        res = w.run_all_solvers()
+    path = res["aco"]["nodes"]
+    w.shutdown()
+
+    assert path[0] == 0 and path[-1] == 1
+    assert len(set(path)) == len(path)
+    assert all((path[i], path[i + 1]) in linked for i in range(len(path) - 1))
+    _announce("✅ aco_edge_walk_follows_edges")
+
+
+def test_lazy_evaporation_matches_global():
+    """
+    Lazy evaporation must export the same matrix as the eager global sweep.
+    """
+    nodes, edges = _chain_topology(30)
+
+    def run(mode):
+        w = AntNetWrapper(30, 2, 6)
+        w.update_topology(nodes, edges)
+        assert lib.pub_set_aco_params(w.context_id, 1.0, 2.0, 100.0, 0.1, 4) == 0
+        w.set_seed(77)
+        w.set_aco_evaporation_mode(mode)
+        for _ in range(30):
+            w.run_all_solvers()
+        out = w.get_pheromone_matrix()
+        w.shutdown()
+        return out
+
+    eager = run(AntNetWrapper.ACO_EVAPORATE_GLOBAL)
+    lazy = run(AntNetWrapper.ACO_EVAPORATE_LAZY)
+    assert len(eager) == len(lazy)
+    assert all(abs(a - b) <= 1e-4 * max(abs(a), 1e-6) for a, b in zip(eager, lazy))
+    _announce("✅ lazy_evaporation_matches_global")
+
+
+def test_aco_colonies_replay_across_threads():
+    """
+    Multi-colony ACO must return a valid path and replay identically
+    whatever the worker count.
+    """
+    nodes, edges = _chain_topology(30)
+
+    def run(threads, migration):
+        w = AntNetWrapper(30, 2, 6)
+        w.update_topology(nodes, edges)
+        assert lib.pub_set_aco_params(w.context_id, 1.0, 2.0, 100.0, 0.1, 8) == 0
+        w.set_seed(123)
+        w.set_worker_threads(threads)
+        w.set_aco_colonies(4, 3, migration)
+        assert w.get_aco_colonies()["colony_count"] == 4
+        for _ in range(20):
+            res = w.run_all_solvers()
+        assert res["aco"]["nodes"]
+        out = w.get_pheromone_matrix()
+        w.shutdown()
+        return out
+
+    for migration in (AntNetWrapper.ACO_MIGRATE_BEST_PATH, AntNetWrapper.ACO_MIGRATE_BLEND):
+        assert run(1, migration) == run(4, migration)
+    _announce("✅ aco_colonies_replay_across_threads")
+
+
+def test_aco_storage_modes_round_trip():
+    """
+    16-bit pheromone storage must convert a live matrix within its precision,
+    keep returning floats, and keep the solver running.
+    """
+    nodes, edges = _chain_topology(30)
+
+    w = AntNetWrapper(30, 2, 6)
+    w.update_topology(nodes, edges)
+    assert lib.pub_set_aco_params(w.context_id, 1.0, 2.0, 100.0, 0.1, 4) == 0
+    w.set_seed(99)
+    for _ in range(20):
+        w.run_all_solvers()
+    reference = w.get_pheromone_matrix()
+
+    for mode in (AntNetWrapper.ACO_STORAGE_FP16, AntNetWrapper.ACO_STORAGE_LOG16):
+        w.set_aco_storage_mode(mode)
+        assert w.get_aco_storage_mode() == mode
+        packed = w.get_pheromone_matrix()
+        assert len(packed) == len(reference)
+        # fp16 subnormals are coarse, so only cells clear of the floor are compared
+        assert all(abs(a - b) <= 1e-3 * a for a, b in zip(reference, packed) if a > 1e-4)
+        w.set_aco_storage_mode(AntNetWrapper.ACO_STORAGE_FLOAT)
+        w.set_aco_storage_mode(mode)
+
+    for _ in range(5):
+        res = w.run_all_solvers()
+    assert res["aco"]["nodes"]
+    with pytest.raises(ValueError):
+        w.set_aco_storage_mode(3)
+    w.shutdown()
+    _announce("✅ aco_storage_modes_round_trip")
+
+
+def test_pheromone_snapshot_versions():
+    """
+    Snapshots must advance once per solver run, skip the copy for a known version,
+    and match the locked matrix read.
+    """
+    nodes, edges = _chain_topology(30)
+
+    w = AntNetWrapper(30, 2, 6)
+    w.update_topology(nodes, edges)
+    w.set_seed(7)
+    w.run_all_solvers()
+
+    version, matrix = w.get_pheromone_snapshot()
+    assert version > 0 and matrix == w.get_pheromone_matrix()
+    assert w.get_pheromone_snapshot(version) == (version, None)
+
+    w.run_all_solvers()
+    newer, matrix = w.get_pheromone_snapshot(version)
+    assert newer > version and matrix is not None
+    w.shutdown()
+    _announce("✅ pheromone_snapshot_versions")
+
+
+def test_pheromone_snapshot_readers_race_topology_and_solvers():
+    """
+    Snapshot readers running alongside topology changes and solver runs only ever see
+    whole matrices: the first-publish fallback reads the ACO matrix under aco_lock.
+    """
+    sizes = (20, 30, 40)
+
+    for _ in range(5):
+        w = AntNetWrapper(40, 2, 8)
+        stop = threading.Event()
+        errors = []
+
+        def reader():
+            while not stop.is_set() and not errors:
+                try:
+                    matrices = (w.get_pheromone_snapshot()[1], w.get_pheromone_matrix())
+                except ValueError:
+                    continue  # no topology yet
+                for matrix in matrices:
+                    if not matrix:
+                        continue
+                    values = np.asarray(matrix, dtype=np.float32)
+                    if values.size not in {n * n for n in sizes}:
+                        errors.append(f"matrix of {values.size} floats")
+                    elif not (np.all(np.isfinite(values)) and np.all(values >= 0.0)):
+                        errors.append("non-finite or negative pheromone")
+
+        readers = [threading.Thread(target=reader) for _ in range(3)]
+        for t in readers:
+            t.start()
+        for k in range(15):
+            w.update_topology(*_ring_topology(sizes[k % 3]))
+            w.run_all_solvers()
+        stop.set()
+        for t in readers:
+            t.join()
+        w.shutdown()
+        assert not errors, errors[0]
+    _announce("✅ pheromone_snapshot_readers_race_topology_and_solvers")
+
+
+def test_incremental_topology_keeps_pheromones():
+    """
+    Delay changes, edge edits and added nodes must patch the solver in place:
+    learned pheromones survive and disabled nodes leave every best path.
+    """
+    nodes, edges = _chain_topology(30)
+
+    w = AntNetWrapper(30, 2, 6)
+    w.update_topology(nodes, edges)
+    w.set_seed(3)
+    for _ in range(20):
+        w.run_all_solvers()
+    learned = w.get_pheromone_matrix()
+
+    w.set_node_delay(5, 1)
+    assert w.get_pheromone_matrix() == learned
+
+    w.add_nodes([{"node_id": 30 + i, "delay_ms": 3} for i in range(2)])
+    grown = w.get_pheromone_matrix()
+    assert len(grown) == 32 * 32
+    assert all(grown[r * 32 + c] == learned[r * 30 + c] for r in range(30) for c in range(30))
+    w.add_edge(30, 0)
+    w.add_edge(30, 1)
+    w.remove_edge(30, 0)
+
+    for node_id in (4, 7, 30):
+        w.disable_node(node_id)
+    for _ in range(30):
+        res = w.run_all_solvers()
+    for key in ("aco", "random", "brute"):
+        assert not {4, 7, 30} & set(res[key]["nodes"])
+    w.disable_node(7, False)
+    with pytest.raises(ValueError):
+        w.disable_node(1)
+    with pytest.raises(ValueError):
+        w.add_nodes([{"node_id": 40, "delay_ms": 1}])
+    w.shutdown()
+    _announce("✅ incremental_topology_keeps_pheromones")
+
+
+def test_exact_solver_is_ground_truth():
+    """
+    The exact solver never loses to a heuristic: in subset mode its latency is the
+    proven optimum, and enabling it adds a fourth "EXACT" ranking entry.
+    """
+    nodes, edges = _chain_topology(12)
+
+    w = AntNetWrapper(12, 2, 4)
+    w.update_topology(nodes, edges)
+    w.set_seed(11)
+    assert not w.get_exact_solver()
+    assert len(w.get_algo_ranking()) == 3
+
+    w.set_exact_solver(True)
+    for _ in range(40):
+        res = w.run_all_solvers()
+    exact = w.get_exact_path()
+    assert exact is not None
+    assert exact["lower_bound"] == exact["total_latency"]
+    assert exact["nodes"][0] == 0 and exact["nodes"][-1] == 1
+    for key in ("aco", "random", "brute"):
+        if res[key]["nodes"]:
+            assert exact["total_latency"] <= res[key]["total_latency"]
+
+    names = [entry["name"] for entry in w.get_algo_ranking()]
+    assert sorted(names) == ["ACO", "BRUTE", "EXACT", "RANDOM"]
+    w.shutdown()
+    _announce("✅ exact_solver_is_ground_truth")
+
+
+def test_exact_solver_clamps_hops_to_candidates():
+    """
+    With fewer candidates than min_hops the subset solvers route through all of them;
+    the exact solver answers the same clamped problem instead of reporting no path.
+    """
+    nodes = [{"node_id": i, "delay_ms": 3 + i} for i in range(6)]
+    edges = [{"from_id": i, "to_id": i + 1} for i in range(5)]
+    w = AntNetWrapper(6, 8, 10)
+    w.update_topology(nodes, edges)
+    exact = w.get_exact_path()
+    assert exact["nodes"] == [0, 2, 3, 4, 5, 1]
+    assert exact["total_latency"] == sum(n["delay_ms"] for n in nodes)
+    res = w.run_all_solvers()
+    assert res["random"]["total_latency"] == exact["total_latency"]
+    w.shutdown()
+    _announce("✅ exact_solver_clamps_hops_to_candidates")
+
+
+def test_exact_solver_edge_mode_finds_simple_paths():
+    """
+    In edge mode the exact solver searches simple paths: when the cheapest walk repeats
+    nodes (0-2-3-2-3-1) it still returns the simple route, which no edge-walking ant beats.
+    """
+    delays = [1, 1, 1, 1, 10, 10, 10, 10]
+    nodes = [{"node_id": i, "delay_ms": d} for i, d in enumerate(delays)]
+    pairs = [(0, 2), (2, 3), (3, 1), (0, 4), (4, 5), (5, 6), (6, 7), (7, 1)]
+    edges = [{"from_id": a, "to_id": b} for a, b in pairs]
+
+    w = AntNetWrapper(8, 4, 4)
+    w.update_topology(nodes, edges)
+    w.set_aco_construction_mode(AntNetWrapper.ACO_CONSTRUCT_EDGE_WALK)
+    w.set_exact_solver(True)
+    exact = w.get_exact_path()
+    assert exact["nodes"] == [0, 4, 5, 6, 7, 1] and exact["total_latency"] == 42
+    assert exact["lower_bound"] == 6  # the walk, not a route
+
+    for _ in range(20):
+        res = w.run_all_solvers()
+    if res["aco"]["nodes"]:
+        assert res["aco"]["total_latency"] >= exact["total_latency"]
+    assert w.get_exact_path() == exact
+    w.shutdown()
+    _announce("✅ exact_solver_edge_mode_finds_simple_paths")
+
+
+def test_brute_force_branch_bound_finishes():
+    """
+    Branch and bound skips orderings and prunes by a lower bound, so a budgeted run
+    finishes the whole enumeration and lands on the exact optimum.
+    """
+    nodes, edges = _chain_topology(16)
+
+    w = AntNetWrapper(16, 3, 6)
+    w.update_topology(nodes, edges)
+    w.set_brute_force_mode(AntNetWrapper.BRUTE_MODE_BRANCH_BOUND, 10000, 0)
+    state = w.get_brute_force_mode()
+    assert state["mode"] == AntNetWrapper.BRUTE_MODE_BRANCH_BOUND and not state["done"]
+
+    res = w.run_all_solvers()
+    assert w.get_brute_force_mode()["done"]
+    assert res["brute"]["total_latency"] == w.get_exact_path()["total_latency"]
+    with pytest.raises(ValueError):
+        w.set_brute_force_mode(7)
+    w.shutdown()
+    _announce("✅ brute_force_branch_bound_finishes")
+
+
+def test_brute_force_parallel_checkpoint_resume():
+    """
+    The parallel enumeration splits each length into rank ranges; a checkpoint taken
+    midway resumes in a fresh context and reaches the same optimum as an uninterrupted run.
+    """
+    topology = _chain_topology(40)
+    brute = (AntNetWrapper.BRUTE_MODE_PARALLEL, 64)
+
+    w = _loaded_wrapper(topology, 4, 8, brute)
+    w.run_all_solvers()
+    assert not w.get_brute_force_mode()["done"]
+    blob = w.get_brute_force_checkpoint()
+
+    resumed = _loaded_wrapper(topology, 4, 8, brute)
+    resumed.restore_brute_force_checkpoint(blob)
+    while not resumed.get_brute_force_mode()["done"]:
+        res = resumed.run_all_solvers()
+    assert res["brute"]["total_latency"] == resumed.get_exact_path()["total_latency"]
+
+    other = _loaded_wrapper(topology, 3, 8)
+    with pytest.raises(ValueError):
+        other.restore_brute_force_checkpoint(blob)
+    for wrapper in (w, resumed, other):
+        wrapper.shutdown()
+    _announce("✅ brute_force_parallel_checkpoint_resume")
+
+
+def test_brute_force_restored_path_respects_buffer_size():
+    """
+    A best path restored from a checkpoint is longer than a small output buffer: the
+    run reports ERR_ARRAY_TOO_SMALL instead of copying past the buffer.
+    """
+    n = 20
+    topology = _spine_topology(n)
+    brute = (AntNetWrapper.BRUTE_MODE_BRANCH_BOUND, 100000)
+
+    w = _loaded_wrapper(topology, n - 2, n - 2, brute)
+    assert len(w.run_all_solvers()["brute"]["nodes"]) == n
+    assert w.get_brute_force_mode()["done"]
+    resumed = _loaded_wrapper(topology, n - 2, n - 2, brute)
+    resumed.restore_brute_force_checkpoint(w.get_brute_force_checkpoint())
+
+    sentinel = -7
+    a_nodes, r_nodes = ffi.new("int[]", n), ffi.new("int[]", n)
+    b_nodes = ffi.new("int[]", [sentinel] * n)
+    out = [ffi.new("int*") for _ in range(6)]
+    rc = lib.pub_run_all_solvers(resumed.context_id,
+                                 a_nodes, n, out[0], out[1],
+                                 r_nodes, n, out[2], out[3],
+                                 b_nodes, 4, out[4], out[5])
+    assert rc == -4  # ERR_ARRAY_TOO_SMALL
+    assert all(b_nodes[i] == sentinel for i in range(4, n))
+    for wrapper in (w, resumed):
+        wrapper.shutdown()
+    _announce("✅ brute_force_restored_path_respects_buffer_size")
+
+
+def test_run_all_solvers_alongside_topology_edits():
+    """
+    The solvers of one run_all_solvers call run side by side under their own locks;
+    topology edits and ranking reads from another thread wait for them instead of racing.
+    """
+    nodes, _ = _ring_topology(30)
+    edges = [{"from_id": i, "to_id": (i * 3 + j) % 30} for i in range(30) for j in (1, 5, 11)]
+    w = AntNetWrapper(30, 3, 6)
+    w.update_topology(nodes, edges)
+    w.set_seed(5)
+    w.set_exact_solver(True)
+    w.set_brute_force_mode(AntNetWrapper.BRUTE_MODE_PARALLEL, 500, 0)
+
+    stop = threading.Event()
+    errors = []
+
+    def editor():
+        k = 0
+        while not stop.is_set() and not errors:
+            try:
+                w.set_node_delay(2 + k % 25, 1 + k % 17)
+                ranking = w.get_algo_ranking()
+            except Exception as exc:
+                errors.append(f"editor raised {exc!r}")
+                break
+            if len(ranking) != 4:
+                errors.append(f"ranking of {len(ranking)} entries")
+            k += 1
+
+    t = threading.Thread(target=editor)
+    t.start()
+    try:
+        for _ in range(30):
+            res = w.run_all_solvers()
+    finally:
+        stop.set()
+        t.join()
+
+    assert not errors, errors[0]
+    for name in ("aco", "random", "brute"):
+        if res[name]["nodes"]:
+            assert res[name]["nodes"][0] == 0 and res[name]["nodes"][-1] == 1
+    w.shutdown()
+    _announce("✅ run_all_solvers_alongside_topology_edits")
+
+
+def test_drain_logs_collects_solver_lines():
+    """
+    Topology and ranking messages go to the backend log rings instead of stdout;
+    drain_logs returns them in sequence order and empties the rings.
+    """
+    AntNetWrapper.drain_logs(4096)
+    w = AntNetWrapper(10, 1, 4)
+    w.update_topology([{"node_id": i, "delay_ms": 3 + i} for i in range(10)],
+                      [{"from_id": i, "to_id": i + 1} for i in range(9)])
+    w.run_all_solvers()
+
+    logs = AntNetWrapper.drain_logs()
+    mine = [e["message"] for e in logs if e["context_id"] == w.context_id]
+    assert any("pub_update_topology" in m for m in mine)
+    seqs = [e["seq"] for e in logs]
+    assert seqs == sorted(seqs)
+    assert AntNetWrapper.drain_logs() == []
+
+    AntNetWrapper.set_log_level(AntNetWrapper.LOG_ERROR)
+    w.run_all_solvers()
+    assert AntNetWrapper.drain_logs() == []
+    AntNetWrapper.set_log_level(AntNetWrapper.LOG_INFO)
+    with pytest.raises(ValueError):
+        AntNetWrapper.set_log_level(9)
+    w.shutdown()
+    _announce("✅ drain_logs_collects_solver_lines")
+
+
+def test_perf_counters_cover_solver_phases():
+    """
+    Each run_all_solvers call adds one iteration sample plus samples for the phases it
+    went through; a reset starts a new window.
+    """
+    w = AntNetWrapper(12, 1, 4)
+    w.update_topology([{"node_id": i, "delay_ms": 2 + i % 5} for i in range(12)],
+                      [{"from_id": i, "to_id": i + 1} for i in range(11)])
+    w.reset_perf_counters()
+    for _ in range(5):
+        w.run_all_solvers()
+    perf = w.get_perf_counters()
+    assert perf["iteration"]["calls"] == 5
+    for phase in ("aco_construct", "sasa_update", "brute_step", "random_step"):
+        assert perf[phase]["calls"] >= 5
+        assert perf[phase]["max_ns"] <= perf[phase]["total_ns"]
+    assert perf["aco_merge"]["calls"] > 0
+
+    w.set_node_delay(3, 9)
+    assert w.get_perf_counters()["topology_update"]["calls"] == 1
+    w.reset_perf_counters()
+    assert all(v["calls"] == 0 for v in w.get_perf_counters().values())
+    w.shutdown()
+    _announce("✅ perf_counters_cover_solver_phases")
+
+
+def test_paths_longer_than_1024_nodes():
+    """
+    Path buffers are sized from max_hops at topology load. On a 1500-node chain with
+    min_hops = n - 2 every route visits all nodes, so the solvers return 1500-node paths,
+    the pheromone reads return the full matrix and the brute force checkpoint carries a
+    1500-node path across a restore.
+    """
+    n = 1500
+    topology = _spine_topology(n)
+    chain = [0] + list(range(2, n)) + [1]
+    options = {"brute": (AntNetWrapper.BRUTE_MODE_PARALLEL, 64),
+               "construction": AntNetWrapper.ACO_CONSTRUCT_EDGE_WALK}
+
+    w = _loaded_wrapper(topology, n - 2, n - 2, **options)
+    res = w.run_all_solvers()
+    assert res["aco"]["nodes"] == chain
+    assert w.get_exact_path()["nodes"] == chain
+    for name in ("random", "brute"):
+        path = res[name]["nodes"]
+        assert len(path) == n > 1024 and path[0] == 0 and path[-1] == 1
+        assert len(set(path)) == n
+
+    # Pheromone buffers follow the node count instead of a fixed 1024 x 1024.
+    assert len(w.get_pheromone_matrix()) == n * n
+    version, matrix = w.get_pheromone_snapshot()
+    assert len(matrix) == n * n and w.get_pheromone_snapshot(version) == (version, None)
+
+    blob = w.get_brute_force_checkpoint()
+    best_nodes = (len(blob) - ffi.sizeof("BruteForceCheckpoint")) // ffi.sizeof("int")
+    assert best_nodes == n
+    resumed = _loaded_wrapper(topology, n - 2, n - 2, **options)
+    resumed.restore_brute_force_checkpoint(blob)
+    assert resumed.get_brute_force_checkpoint() == blob
+    assert resumed.run_all_solvers()["brute"] == res["brute"]
+    with pytest.raises(ValueError):
+        resumed.restore_brute_force_checkpoint(blob[:-4])
+    for wrapper in (w, resumed):
+        wrapper.shutdown()
+    _announce("✅ paths_longer_than_1024_nodes")
+
+
+def test_context_registry_grows_and_retires_handles():
+    """
+    The registry grows past its first 16-slot segment; a handle kept after shutdown
+    stays invalid even once its slot serves a new context.
+    """
+    wrappers = [AntNetWrapper(6, 1, 4) for _ in range(40)]
+    ids = [w.context_id for w in wrappers]
+    assert len(set(ids)) == len(ids)
+
+    stale = wrappers[5].context_id
+    wrappers[5].shutdown()
+    assert lib.pub_run_iteration(stale) < 0
+    assert lib.pub_shutdown(stale) < 0
+
+    wrappers[5] = AntNetWrapper(6, 1, 4)
+    assert wrappers[5].context_id != stale
+    assert lib.pub_run_iteration(stale) < 0
+    for w in wrappers:
+        w.run_iteration()
+        w.shutdown()
+    _announce("✅ context_registry_grows_and_retires_handles")
+
+
+def test_run_solvers_batch_stops_and_traces():
+    """
+    One batch call runs many iterations natively; it stops on the iteration count, the
+    time budget or a stall, and traces each iteration's best latencies.
+    """
+    nodes, edges = _ring_topology(30)
+    w = AntNetWrapper(30, 2, 8)
+    w.update_topology(nodes, edges)
+    w.set_seed(3)
+
+    res = w.run_solvers_batch(7)
+    assert res["iterations"] == 7 and len(res["trace"]) == 7
+    assert res["stop_reason"] == AntNetWrapper.BATCH_STOP_ITERATIONS
+    assert res["trace"][-1] == (res["aco"]["total_latency"], res["random"]["total_latency"],
+                                res["brute"]["total_latency"])
+    for col in range(AntNetWrapper.BATCH_TRACE_WIDTH):
+        seen = [row[col] for row in res["trace"] if row[col] >= 0]
+        assert seen == sorted(seen, reverse=True)
+
+    res = w.run_solvers_batch(100000, stall_iterations=20, trace=False)
+    assert res["stop_reason"] == AntNetWrapper.BATCH_STOP_CONVERGED and res["trace"] == []
+    res = w.run_solvers_batch(10**7, time_budget_us=20000, trace=False)
+    assert res["stop_reason"] == AntNetWrapper.BATCH_STOP_DEADLINE
+
+    with pytest.raises(ValueError):
+        w.run_solvers_batch(0)
+    w.shutdown()
+    _announce("✅ run_solvers_batch_stops_and_traces")
+
+
+def test_results_region_zero_copy_views():
+    """
+    The results region is wrapped by numpy without copying and rewritten in place under
+    a sequence lock; a pinned region survives a layout change that moves readers on.
+    """
+    nodes, edges = _ring_topology(30)
+    w = AntNetWrapper(30, 2, 8)
+    w.update_topology(nodes, edges)
+    assert w.acquire_results() is None  # the first acquire starts publishing
+    res = w.run_all_solvers()
+
+    view = w.acquire_results()
+    seq = view.read_begin()
+    assert view.pheromone.shape == (30, 30)
+    off_diag = view.pheromone.copy()
+    np.fill_diagonal(off_diag, 0.0)
+    assert np.array_equal(view.strength, off_diag.max(axis=1))
+    assert view.path(view.PATH_ACO).tolist() == res["aco"]["nodes"]
+    assert view.latency(view.PATH_BRUTE) == res["brute"]["total_latency"]
+    assert not view.read_retry(seq)
+
+    version = view.version
+    w.run_all_solvers()
+    assert view.read_retry(seq) and view.version == version + 1
+
+    w.add_nodes([{"node_id": 30, "delay_ms": 4}])
+    w.run_all_solvers()
+    assert view.header.num_nodes == 30
+    with w.acquire_results() as grown:
+        assert grown.pheromone.shape == (31, 31)
+    view.release()
+    w.shutdown()
+    _announce("✅ results_region_zero_copy_views")
+
+
+def test_results_view_survives_shutdown():
+    """
+    A view held across shutdown keeps its region allocated and releases without error;
+    the region goes with the last release, and a new context on the slot starts afresh.
+    """
+    nodes, edges = _ring_topology(30)
+    w = AntNetWrapper(30, 2, 8)
+    w.update_topology(nodes, edges)
+    assert w.acquire_results() is None
+    res = w.run_all_solvers()
+
+    with w.acquire_results() as view:
+        second = w.acquire_results()
+        w.shutdown()
+        seq = view.read_begin()
+        assert view.path(view.PATH_ACO).tolist() == res["aco"]["nodes"]
+        assert not view.read_retry(seq)
+
+        # The slot is reused while the old regions are still pinned.
+        reused = AntNetWrapper(30, 2, 8)
+        reused.update_topology(nodes, edges)
+        assert reused.acquire_results() is None
+        second.release()
+    assert view.strength is None
+
+    reused.run_all_solvers()
+    with reused.acquire_results() as fresh:
+        assert fresh.version == 1
+    reused.shutdown()
+    _announce("✅ results_view_survives_shutdown")
+
+
+def test_solver_loop_signals_descriptor():
+    """
+    The native loop iterates on its own thread, wakes its descriptor with progress,
+    refreshes the results region, and stops without closing the descriptor.
+    """
+    nodes, edges = _ring_topology(30)
+    w = AntNetWrapper(30, 2, 8)
+    assert w.acquire_results() is None  # turns publishing on
+    fd = w.start_solver_loop(progress_interval_ms=20)
+    w.update_topology(nodes, edges)
+
+    wakes = 0
+    for _ in range(5):
+        readable, _, _ = select.select([fd], [], [], 2.0)
+        if readable and AntNetWrapper.drain_solver_loop_fd(fd):
+            wakes += 1
+    assert wakes == 5
+    status = w.get_solver_loop_status()
+    assert status["running"] and status["iterations"] > 0 and status["improvements"] > 0
+
+    # Calls from Python still interleave with the loop.
+    res = w.run_all_solvers()
+    assert res["aco"]["total_latency"] > 0
+    with w.acquire_results() as view:
+        assert view.strength.shape == (30,) and view.latency(view.PATH_ACO) > 0
+
+    assert w.start_solver_loop(progress_interval_ms=0) == fd
+    w.stop_solver_loop()
+    stopped = w.get_solver_loop_status()
+    assert not stopped["running"]
+    time.sleep(0.05)
+    assert w.get_solver_loop_status()["iterations"] == stopped["iterations"]
+    AntNetWrapper.drain_solver_loop_fd(fd)
+    assert select.select([fd], [], [], 0.05)[0] == []
+
+    w.start_solver_loop()
+    w.shutdown()  # stops the loop and closes the descriptor
+    _announce("✅ solver_loop_signals_descriptor")